@@ -0,0 +1,866 @@
+static const struct caseconv_rule caseconv_rules[] = {
+  {0, 0},
+  {32, 0},
+  {0, -32},
+  {0, 743},
+  {0, 121},
+  {1, 0},
+  {0, -1},
+  {-199, 0},
+  {0, -232},
+  {-121, 0},
+  {0, -300},
+  {0, 195},
+  {210, 0},
+  {206, 0},
+  {205, 0},
+  {79, 0},
+  {202, 0},
+  {203, 0},
+  {207, 0},
+  {0, 97},
+  {211, 0},
+  {209, 0},
+  {0, 163},
+  {213, 0},
+  {0, 130},
+  {214, 0},
+  {218, 0},
+  {217, 0},
+  {219, 0},
+  {0, 56},
+  {2, 0},
+  {1, -1},
+  {0, -2},
+  {0, -79},
+  {-97, 0},
+  {-56, 0},
+  {-130, 0},
+  {10795, 0},
+  {-163, 0},
+  {10792, 0},
+  {0, 10815},
+  {-195, 0},
+  {69, 0},
+  {71, 0},
+  {0, 10783},
+  {0, 10780},
+  {0, 10782},
+  {0, -210},
+  {0, -206},
+  {0, -205},
+  {0, -202},
+  {0, -203},
+  {0, 42319},
+  {0, 42315},
+  {0, -207},
+  {0, 42280},
+  {0, 42308},
+  {0, -209},
+  {0, -211},
+  {0, 10743},
+  {0, 42305},
+  {0, 10749},
+  {0, -213},
+  {0, -214},
+  {0, 10727},
+  {0, -218},
+  {0, 42282},
+  {0, -69},
+  {0, -217},
+  {0, -71},
+  {0, -219},
+  {0, 42261},
+  {0, 42258},
+  {0, 84},
+  {116, 0},
+  {38, 0},
+  {37, 0},
+  {64, 0},
+  {63, 0},
+  {0, -38},
+  {0, -37},
+  {0, -31},
+  {0, -64},
+  {0, -63},
+  {8, 0},
+  {0, -62},
+  {0, -57},
+  {0, -47},
+  {0, -54},
+  {0, -8},
+  {0, -86},
+  {0, -80},
+  {0, 7},
+  {0, -116},
+  {-60, 0},
+  {0, -96},
+  {-7, 0},
+  {80, 0},
+  {15, 0},
+  {0, -15},
+  {48, 0},
+  {0, -48},
+  {7264, 0},
+  {0, 3008},
+  {38864, 0},
+  {0, -6254},
+  {0, -6253},
+  {0, -6244},
+  {0, -6242},
+  {0, -6243},
+  {0, -6236},
+  {0, -6181},
+  {0, 35266},
+  {-3008, 0},
+  {0, 35332},
+  {0, 3814},
+  {0, -59},
+  {-7615, 0},
+  {0, 8},
+  {-8, 0},
+  {0, 74},
+  {0, 86},
+  {0, 100},
+  {0, 128},
+  {0, 112},
+  {0, 126},
+  {0, 9},
+  {-74, 0},
+  {-9, 0},
+  {0, -7205},
+  {-86, 0},
+  {-100, 0},
+  {-112, 0},
+  {-128, 0},
+  {-126, 0},
+  {-7517, 0},
+  {-8383, 0},
+  {-8262, 0},
+  {28, 0},
+  {0, -28},
+  {16, 0},
+  {0, -16},
+  {26, 0},
+  {0, -26},
+  {-10743, 0},
+  {-3814, 0},
+  {-10727, 0},
+  {0, -10795},
+  {0, -10792},
+  {-10780, 0},
+  {-10749, 0},
+  {-10783, 0},
+  {-10782, 0},
+  {-10815, 0},
+  {0, -7264},
+  {-35332, 0},
+  {-42280, 0},
+  {-42308, 0},
+  {-42319, 0},
+  {-42315, 0},
+  {-42305, 0},
+  {-42258, 0},
+  {-42282, 0},
+  {-42261, 0},
+  {928, 0},
+  {0, -928},
+  {0, -38864},
+  {40, 0},
+  {0, -40},
+  {34, 0},
+  {0, -34},
+};
+
+/* generated by mkstages: 1958 pages of 64, 62 blocks,
+   5926 bytes */
+
+#define CASECONV_SHIFT 6
+#define CASECONV_LIMIT 0x1E980
+
+static const unsigned char caseconv_index[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0, 11, 12, 13,
+  14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 25, 0, 0, 26, 0, 0, 27, 27, 28, 27, 29, 30, 31, 32,
+  0, 0, 0, 0, 33, 34, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 36, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  38, 39, 27, 40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 44, 45, 46, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 48, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 52, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 57, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 60, 61,
+};
+
+static const unsigned char caseconv_blocks[] = {
+  /* U+0000 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+0040 */
+  0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 0, 0, 0, 0, 0,
+  /* U+0080 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 3, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+00C0 */
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0,
+  1, 1, 1, 1, 1, 1, 1, 0,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 4,
+  /* U+0100 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  7, 8, 5, 6, 5, 6, 5, 6,
+  0, 5, 6, 5, 6, 5, 6, 5,
+  /* U+0140 */
+  6, 5, 6, 5, 6, 5, 6, 5,
+  6, 0, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  9, 5, 6, 5, 6, 5, 6, 10,
+  /* U+0180 */
+  11, 12, 5, 6, 5, 6, 13, 5,
+  6, 14, 14, 5, 6, 0, 15, 16,
+  17, 5, 6, 14, 18, 19, 20, 21,
+  5, 6, 22, 0, 20, 23, 24, 25,
+  5, 6, 5, 6, 5, 6, 26, 5,
+  6, 26, 0, 0, 5, 6, 26, 5,
+  6, 27, 27, 5, 6, 5, 6, 28,
+  5, 6, 0, 0, 5, 6, 0, 29,
+  /* U+01C0 */
+  0, 0, 0, 0, 30, 31, 32, 30,
+  31, 32, 30, 31, 32, 5, 6, 5,
+  6, 5, 6, 5, 6, 5, 6, 5,
+  6, 5, 6, 5, 6, 33, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  0, 30, 31, 32, 5, 6, 34, 35,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+0200 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  36, 0, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 0, 0, 0, 0,
+  0, 0, 37, 5, 6, 38, 39, 40,
+  /* U+0240 */
+  40, 5, 6, 41, 42, 43, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  44, 45, 46, 47, 48, 0, 49, 49,
+  0, 50, 0, 51, 52, 0, 0, 0,
+  49, 53, 0, 54, 0, 55, 56, 0,
+  57, 58, 56, 59, 60, 0, 0, 58,
+  0, 61, 62, 0, 0, 63, 0, 0,
+  0, 0, 0, 0, 0, 64, 0, 0,
+  /* U+0280 */
+  65, 0, 0, 65, 0, 0, 0, 66,
+  65, 67, 68, 68, 69, 0, 0, 0,
+  0, 0, 70, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 71, 72, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+0340 */
+  0, 0, 0, 0, 0, 73, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  5, 6, 5, 6, 0, 0, 5, 6,
+  0, 0, 0, 24, 24, 24, 0, 74,
+  /* U+0380 */
+  0, 0, 0, 0, 0, 0, 75, 0,
+  76, 76, 76, 0, 77, 0, 78, 78,
+  0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 79, 80, 80, 80,
+  0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  /* U+03C0 */
+  2, 2, 81, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 82, 83, 83, 84,
+  85, 86, 0, 0, 0, 87, 88, 89,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  90, 91, 92, 93, 94, 95, 0, 5,
+  6, 96, 5, 6, 0, 36, 36, 36,
+  /* U+0400 */
+  97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  /* U+0440 */
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 91, 91, 91, 91,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+0480 */
+  5, 6, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+04C0 */
+  98, 5, 6, 5, 6, 5, 6, 5,
+  6, 5, 6, 5, 6, 5, 6, 99,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+0500 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  0, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  /* U+0540 */
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  /* U+0580 */
+  101, 101, 101, 101, 101, 101, 101, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+1080 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102,
+  /* U+10C0 */
+  102, 102, 102, 102, 102, 102, 0, 102,
+  0, 0, 0, 0, 0, 102, 0, 0,
+  103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 0, 0, 103, 103, 103,
+  /* U+1380 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  /* U+13C0 */
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104,
+  84, 84, 84, 84, 84, 84, 0, 0,
+  89, 89, 89, 89, 89, 89, 0, 0,
+  /* U+1C80 */
+  105, 106, 107, 108, 108, 109, 110, 111,
+  112, 0, 0, 0, 0, 0, 0, 0,
+  113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 0, 0, 113, 113, 113,
+  /* U+1D40 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 114, 0, 0, 0, 115, 0, 0,
+  /* U+1E00 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+1E80 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 0, 0,
+  0, 0, 0, 116, 0, 0, 117, 0,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+1F00 */
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 118, 118, 118, 118, 0, 0,
+  119, 119, 119, 119, 119, 119, 0, 0,
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  /* U+1F40 */
+  118, 118, 118, 118, 118, 118, 0, 0,
+  119, 119, 119, 119, 119, 119, 0, 0,
+  0, 118, 0, 118, 0, 118, 0, 118,
+  0, 119, 0, 119, 0, 119, 0, 119,
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  120, 120, 121, 121, 121, 121, 122, 122,
+  123, 123, 124, 124, 125, 125, 0, 0,
+  /* U+1F80 */
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119,
+  118, 118, 0, 126, 0, 0, 0, 0,
+  119, 119, 127, 127, 128, 0, 129, 0,
+  /* U+1FC0 */
+  0, 0, 0, 126, 0, 0, 0, 0,
+  130, 130, 130, 130, 128, 0, 0, 0,
+  118, 118, 0, 0, 0, 0, 0, 0,
+  119, 119, 131, 131, 0, 0, 0, 0,
+  118, 118, 0, 0, 0, 92, 0, 0,
+  119, 119, 132, 132, 96, 0, 0, 0,
+  0, 0, 0, 126, 0, 0, 0, 0,
+  133, 133, 134, 134, 128, 0, 0, 0,
+  /* U+2100 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 135, 0,
+  0, 0, 136, 137, 0, 0, 0, 0,
+  0, 0, 138, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+2140 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 139, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140,
+  141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141,
+  /* U+2180 */
+  0, 0, 0, 5, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+2480 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 142, 142,
+  142, 142, 142, 142, 142, 142, 142, 142,
+  /* U+24C0 */
+  142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 142, 142, 142, 142, 142, 142,
+  143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+2C00 */
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 0,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  /* U+2C40 */
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 0,
+  5, 6, 144, 145, 146, 147, 148, 5,
+  6, 5, 6, 5, 6, 149, 150, 151,
+  152, 0, 5, 6, 0, 5, 6, 0,
+  0, 0, 0, 0, 0, 0, 153, 153,
+  /* U+2CC0 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 0, 0, 0, 0,
+  0, 0, 0, 5, 6, 5, 6, 0,
+  0, 0, 5, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+2D00 */
+  154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 0, 154,
+  0, 0, 0, 0, 0, 154, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+A640 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+A680 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+A700 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  0, 0, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  /* U+A740 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 6, 5, 6, 155, 5, 6,
+  /* U+A780 */
+  5, 6, 5, 6, 5, 6, 5, 6,
+  0, 0, 0, 5, 6, 156, 0, 0,
+  5, 6, 5, 6, 0, 0, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 5, 6, 5, 6, 5, 6,
+  5, 6, 157, 158, 159, 160, 157, 0,
+  161, 162, 163, 164, 5, 6, 5, 6,
+  5, 6, 0, 0, 0, 0, 0, 0,
+  /* U+AB40 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 165, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  /* U+AB80 */
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166,
+  /* U+FF00 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0,
+  /* U+FF40 */
+  0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+10400 */
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  /* U+10440 */
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+10480 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  /* U+104C0 */
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 167, 167, 0, 0, 0, 0,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 0, 0, 0, 0,
+  /* U+10C80 */
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+10CC0 */
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+11880 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  /* U+118C0 */
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+16E40 */
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  /* U+1E900 */
+  169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+1E940 */
+  170, 170, 170, 170, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
@@ -2,6 +2,8 @@
 #include <stdint.h>
 #include "categories.h"
 
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+
 struct _category {
   enum category cat: 8;
   uint_least32_t first: 24;
@@ -38,3 +40,27 @@ enum category category(wint_t ucs)
   return bisearch_cat(ucs, categories,
 		      sizeof(categories) / sizeof(*categories) - 1);
 }
+
+#else /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
+/* catstages.t holds the categories of categories.t in two stages, see
+   mkstages; NOCAT marks the characters in no range.  */
+#define NOCAT 0xff
+#include "catstages.t"
+
+enum category category(wint_t ucs)
+{
+  unsigned char cat;
+
+  if (ucs < 0x100)
+    cat = category_blocks[ucs];
+  else if (ucs < CATEGORY_LIMIT)
+    cat = category_blocks[(category_index[ucs >> CATEGORY_SHIFT]
+			   << CATEGORY_SHIFT)
+			  + (ucs & ((1 << CATEGORY_SHIFT) - 1))];
+  else
+    return -1;
+  return cat == NOCAT ? (enum category) -1 : (enum category) cat;
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
@@ -0,0 +1,4353 @@
+/* generated by mkstages: 7172 pages of 128, 229 blocks,
+   36484 bytes */
+
+#define CATEGORY_SHIFT 7
+#define CATEGORY_LIMIT 0xE0200
+
+static const unsigned char category_index[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 34, 35, 36, 37, 38, 39, 34, 34, 34, 40, 41, 42, 43,
+  44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 8, 56, 57, 58,
+  59, 60, 61, 62, 63, 63, 64, 65, 66, 67, 68, 69, 70, 68, 71, 72,
+  68, 68, 63, 73, 63, 63, 74, 75, 76, 77, 78, 79, 80, 81, 68, 82,
+  83, 84, 85, 86, 87, 88, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 89, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 90,
+  91, 34, 34, 34, 34, 34, 34, 34, 34, 92, 34, 34, 93, 94, 95, 96,
+  97, 98, 99, 100, 101, 102, 103, 104, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 105,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 34, 34, 108, 109, 110, 111, 34, 34, 112, 113, 114, 115, 116, 117,
+  118, 119, 120, 121, 107, 122, 123, 124, 125, 126, 127, 107, 34, 34, 128, 107,
+  129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 107, 140, 107, 141, 107,
+  142, 143, 144, 145, 146, 147, 148, 107, 149, 150, 107, 151, 152, 153, 154, 107,
+  155, 156, 107, 107, 157, 158, 107, 107, 159, 160, 161, 162, 107, 163, 107, 107,
+  34, 34, 34, 34, 34, 34, 34, 164, 165, 34, 166, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 34, 34, 34, 34, 34, 34, 34, 167, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 34, 34, 34, 34, 168, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 34, 34, 34, 169, 170, 171, 172, 107, 107, 107, 107, 173, 174, 175, 176,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 177,
+  34, 34, 34, 34, 34, 178, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 34, 179, 34, 34, 180, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 181, 182, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  68, 183, 184, 185, 186, 187, 188, 107, 189, 190, 191, 192, 193, 194, 195, 196,
+  68, 68, 68, 68, 197, 198, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  199, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 200, 201, 107, 107, 107, 107, 107, 202, 203, 107, 107, 204, 205, 107, 107,
+  206, 207, 208, 209, 210, 107, 68, 211, 68, 68, 68, 68, 68, 212, 213, 214,
+  215, 216, 217, 218, 219, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 220, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 221, 34,
+  222, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 223, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 224, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  34, 34, 34, 34, 225, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  226, 107, 227, 228,
+};
+
+static const unsigned char category_blocks[] = {
+  /* U+0000 */
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Zs, CAT_Po, CAT_Po, CAT_Po, CAT_Sc, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Ps, CAT_Pe, CAT_Po, CAT_Sm, CAT_Po, CAT_Pd, CAT_Po, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Po,
+  CAT_Po, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Ps, CAT_Po, CAT_Pe, CAT_Sk, CAT_Pc,
+  CAT_Sk, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Ps, CAT_Sm, CAT_Pe, CAT_Sm, CAT_Cc,
+  /* U+0080 */
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc, CAT_Cc,
+  CAT_Zs, CAT_Po, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_So, CAT_Po,
+  CAT_Sk, CAT_So, CAT_Lo, CAT_Pi, CAT_Sm, CAT_Cf, CAT_So, CAT_Sk,
+  CAT_So, CAT_Sm, CAT_No, CAT_No, CAT_Sk, CAT_LC, CAT_Po, CAT_Po,
+  CAT_Sk, CAT_No, CAT_Lo, CAT_Pf, CAT_No, CAT_No, CAT_No, CAT_Po,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Sm,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Sm,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0100 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0180 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_Lo, CAT_LC, CAT_LC, CAT_Ll, CAT_LC,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_LC, CAT_Lt, CAT_LC, CAT_LC,
+  CAT_Lt, CAT_LC, CAT_LC, CAT_Lt, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_Lt, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0200 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll,
+  /* U+0280 */
+  CAT_LC, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Lo, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Lm, CAT_Sk, CAT_Lm, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  /* U+0300 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lm, CAT_Sk, CAT_LC, CAT_LC,
+  NOCAT, NOCAT, CAT_Lm, CAT_LC, CAT_LC, CAT_LC, CAT_Po, CAT_LC,
+  /* U+0380 */
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Sk, CAT_Sk, CAT_LC, CAT_Po,
+  CAT_LC, CAT_LC, CAT_LC, NOCAT, CAT_LC, NOCAT, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, NOCAT, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_Lu, CAT_Lu, CAT_Lu, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Sm, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0400 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0480 */
+  CAT_LC, CAT_LC, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Me, CAT_Me, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0500 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  NOCAT, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT,
+  NOCAT, CAT_Lm, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+0580 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_Ll, CAT_Po, CAT_Pd, NOCAT, NOCAT, CAT_So, CAT_So, CAT_Sc,
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Pd, CAT_Mn,
+  CAT_Po, CAT_Mn, CAT_Mn, CAT_Po, CAT_Mn, CAT_Mn, CAT_Po, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0600 */
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Po, CAT_Po, CAT_Sc, CAT_Po, CAT_Po, CAT_So, CAT_So,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Cf, NOCAT, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Lo, CAT_Lo,
+  CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+0680 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Cf, CAT_So, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lm, CAT_Lm, CAT_Mn,
+  CAT_Mn, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_So, CAT_So, CAT_Lo,
+  /* U+0700 */
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, CAT_Cf,
+  CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+0780 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lm, CAT_Lm, CAT_So, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Lm, NOCAT, NOCAT, CAT_Mn, CAT_Sc, CAT_Sc,
+  /* U+0800 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Lm, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lm, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Lm, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Po, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0880 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Cf, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+0900 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Po, CAT_Lm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+0980 */
+  CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Mc,
+  CAT_Mc, NOCAT, NOCAT, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Lo, CAT_Lo, CAT_Sc, CAT_Sc, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_So, CAT_Sc, CAT_Lo, CAT_Po, CAT_Mn, NOCAT,
+  /* U+0A00 */
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, NOCAT, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn,
+  CAT_Mn, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Po, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0A80 */
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_Mn,
+  CAT_Mn, CAT_Mc, NOCAT, CAT_Mc, CAT_Mc, CAT_Mn, NOCAT, NOCAT,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Po, CAT_Sc, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+0B00 */
+  NOCAT, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mn,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Mc,
+  CAT_Mc, NOCAT, NOCAT, CAT_Mc, CAT_Mc, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn, CAT_Mc,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_So, CAT_Lo, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0B80 */
+  NOCAT, NOCAT, CAT_Mn, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, NOCAT, NOCAT, CAT_Mc, CAT_Mc,
+  CAT_Mc, NOCAT, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, NOCAT, NOCAT,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_No, CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_Sc, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0C00 */
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT, CAT_Mn, CAT_Mn,
+  CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn, CAT_Mn, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_So,
+  /* U+0C80 */
+  CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Po, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mn,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT, CAT_Mn, CAT_Mc,
+  CAT_Mc, NOCAT, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc, CAT_Mc, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0D00 */
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_Mc, CAT_Mc,
+  CAT_Mc, NOCAT, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Lo, CAT_So,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_So, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+0D80 */
+  NOCAT, NOCAT, CAT_Mc, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, NOCAT,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  NOCAT, NOCAT, CAT_Mc, CAT_Mc, CAT_Po, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0E00 */
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Sc,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0E80 */
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, CAT_Lo,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lm, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+0F00 */
+  CAT_Lo, CAT_So, CAT_So, CAT_So, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_So, CAT_Po, CAT_So, CAT_So, CAT_So,
+  CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_Mn, CAT_So, CAT_Mn,
+  CAT_So, CAT_Mn, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Mc, CAT_Mc,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  /* U+0F80 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Mn, CAT_Mn,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Mn, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, CAT_So, CAT_So,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1000 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1080 */
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Lo, CAT_Mc,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_So, CAT_So,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, CAT_LC,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_LC, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Po, CAT_Lm, CAT_LC, CAT_LC, CAT_LC,
+  /* U+1100 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1200 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1280 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1300 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT,
+  /* U+1380 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  /* U+1400 */
+  CAT_Pd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1600 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1680 */
+  CAT_Zs, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Ps, CAT_Pe, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, CAT_Po, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1700 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1780 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, CAT_Po, CAT_Lm,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Sc, CAT_Lo, CAT_Mn, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1800 */
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Pd, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Cf, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1880 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1900 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1980 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_No, NOCAT, NOCAT, NOCAT, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1A00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, NOCAT, NOCAT, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mn, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, CAT_Mn,
+  /* U+1A80 */
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Lm,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Me, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1B00 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT,
+  /* U+1B80 */
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  /* U+1C00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Po, CAT_Po,
+  /* U+1C80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Mc,
+  CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D00 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lm, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll,
+  /* U+1D80 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+1E80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+1F00 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  CAT_Ll, CAT_LC, CAT_Ll, CAT_LC, CAT_Ll, CAT_LC, CAT_Ll, CAT_LC,
+  NOCAT, CAT_LC, NOCAT, CAT_LC, NOCAT, CAT_LC, NOCAT, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT,
+  /* U+1F80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt, CAT_Lt,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lt, CAT_Sk, CAT_LC, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Ll, CAT_LC, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lt, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, NOCAT, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Sk, CAT_Sk, CAT_Sk,
+  NOCAT, NOCAT, CAT_Ll, CAT_LC, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lt, CAT_Sk, CAT_Sk, NOCAT,
+  /* U+2000 */
+  CAT_Zs, CAT_Zs, CAT_Zs, CAT_Zs, CAT_Zs, CAT_Zs, CAT_Zs, CAT_Zs,
+  CAT_Zs, CAT_Zs, CAT_Zs, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Pd, CAT_Pd, CAT_Pd, CAT_Pd, CAT_Pd, CAT_Pd, CAT_Po, CAT_Po,
+  CAT_Pi, CAT_Pf, CAT_Ps, CAT_Pi, CAT_Pi, CAT_Pf, CAT_Ps, CAT_Pi,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Zl, CAT_Zp, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Zs,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Pi, CAT_Pf, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Pc,
+  CAT_Pc, CAT_Po, CAT_Po, CAT_Po, CAT_Sm, CAT_Ps, CAT_Pe, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Sm, CAT_Po, CAT_Pc, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Zs,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, NOCAT, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_No, CAT_Lm, NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe, CAT_Lm,
+  /* U+2080 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe, NOCAT,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, NOCAT, NOCAT, NOCAT,
+  CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc,
+  CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc,
+  CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc,
+  CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc, CAT_Sc,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Me, CAT_Me, CAT_Me,
+  CAT_Me, CAT_Mn, CAT_Me, CAT_Me, CAT_Me, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2100 */
+  CAT_So, CAT_So, CAT_Lu, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Lu,
+  CAT_So, CAT_So, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_So, CAT_Lu, CAT_So, CAT_So,
+  CAT_Sm, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_Lu, CAT_So, CAT_LC, CAT_So,
+  CAT_Lu, CAT_So, CAT_LC, CAT_LC, CAT_Lu, CAT_Lu, CAT_So, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_LC, CAT_Lu, CAT_Ll, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Ll, CAT_So, CAT_So, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_So, CAT_Sm, CAT_So, CAT_So, CAT_LC, CAT_So,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  /* U+2180 */
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_LC, CAT_LC, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_No, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Sm, CAT_So, CAT_So, CAT_Sm, CAT_So, CAT_So, CAT_Sm, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_Sm,
+  CAT_So, CAT_So, CAT_Sm, CAT_So, CAT_Sm, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  /* U+2200 */
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  /* U+2300 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_Ps, CAT_Pe, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_So, CAT_So, CAT_So,
+  /* U+2380 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+2400 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+2480 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+2500 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+2580 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_Sm, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  /* U+2600 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Sm,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+2700 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+2780 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  /* U+2980 */
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps,
+  CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps,
+  CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps,
+  CAT_Pe, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Ps, CAT_Pe, CAT_Sm, CAT_Sm,
+  /* U+2B00 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_Sm,
+  CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+2B80 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  /* U+2C00 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_Ll, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lm, CAT_Lm, CAT_LC, CAT_LC,
+  /* U+2C80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_No, CAT_Po, CAT_Po,
+  /* U+2D00 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, CAT_LC,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_LC, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lm,
+  CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn,
+  /* U+2D80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+2E00 */
+  CAT_Po, CAT_Po, CAT_Pi, CAT_Pf, CAT_Pi, CAT_Pf, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Pi, CAT_Pf, CAT_Po, CAT_Pi, CAT_Pf, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Pd,
+  CAT_Po, CAT_Po, CAT_Pd, CAT_Po, CAT_Pi, CAT_Pf, CAT_Po, CAT_Po,
+  CAT_Pi, CAT_Pf, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe,
+  CAT_Ps, CAT_Pe, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Lm,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Pd, CAT_Pd, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Pd, CAT_Po, CAT_Ps, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2E80 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2F80 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+3000 */
+  CAT_Zs, CAT_Po, CAT_Po, CAT_Po, CAT_So, CAT_Lm, CAT_Lo, CAT_Nl,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe,
+  CAT_Ps, CAT_Pe, CAT_So, CAT_So, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe,
+  CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Pd, CAT_Ps, CAT_Pe, CAT_Pe,
+  CAT_So, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Pd, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_So, CAT_So,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Lm, CAT_Lo, CAT_Po, CAT_So, CAT_So,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+3080 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Sk, CAT_Sk, CAT_Lm, CAT_Lm, CAT_Lo,
+  CAT_Pd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lo,
+  /* U+3100 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+3180 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_So, CAT_So, CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+3200 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_So, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+3280 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  /* U+4D80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+9F80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+A000 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+A480 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Po, CAT_Po,
+  /* U+A600 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lo, CAT_Mn,
+  CAT_Me, CAT_Me, CAT_Me, CAT_Po, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Lm,
+  /* U+A680 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Lm, CAT_Lm, CAT_Mn, CAT_Mn,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+A700 */
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Sk, CAT_Sk, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Ll, CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+A780 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lm, CAT_Sk, CAT_Sk, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Lo,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll, CAT_Ll, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Ll,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lm, CAT_Lm, CAT_Ll, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+A800 */
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_So,
+  CAT_Sc, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+A880 */
+  CAT_Mc, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Lo, CAT_Po, CAT_Lo, CAT_Lo, CAT_Mn,
+  /* U+A900 */
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  /* U+A980 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, CAT_Lm,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lm, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  /* U+AA00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_So,
+  CAT_So, CAT_So, CAT_Lo, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo,
+  /* U+AA80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mn, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Mn,
+  CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Lo, CAT_Mn, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Po, CAT_Po, CAT_Lo, CAT_Lm, CAT_Lm, CAT_Mc, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+AB00 */
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_LC, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Sk, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+AB80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Po, CAT_Mc, CAT_Mn, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+D780 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+D800 */
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs, CAT_Cs,
+  /* U+E000 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+FA00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FA80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+FB00 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Mn, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Sm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FB80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  CAT_Sk, CAT_Sk, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FD00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Pe, CAT_Ps,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FD80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Sc, CAT_So, NOCAT, NOCAT,
+  /* U+FE00 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Ps,
+  CAT_Pe, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Po, CAT_Pd, CAT_Pd, CAT_Pc, CAT_Pc, CAT_Ps, CAT_Pe, CAT_Ps,
+  CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps,
+  CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Po, CAT_Po, CAT_Ps,
+  CAT_Pe, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Pc, CAT_Pc, CAT_Pc,
+  CAT_Po, CAT_Po, CAT_Po, NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Pd, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Ps, CAT_Pe, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Sm, CAT_Pd, CAT_Sm, CAT_Sm, CAT_Sm, NOCAT,
+  CAT_Po, CAT_Sc, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FE80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Cf,
+  /* U+FF00 */
+  NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Sc, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Ps, CAT_Pe, CAT_Po, CAT_Sm, CAT_Po, CAT_Pd, CAT_Po, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Po, CAT_Po, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Po,
+  CAT_Po, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Ps, CAT_Po, CAT_Pe, CAT_Sk, CAT_Pc,
+  CAT_Sk, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_Ps, CAT_Sm, CAT_Pe, CAT_Sm, CAT_Ps,
+  CAT_Pe, CAT_Po, CAT_Ps, CAT_Pe, CAT_Po, CAT_Po, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lm, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+FF80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lm, CAT_Lm,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  CAT_Sc, CAT_Sc, CAT_Sm, CAT_Sk, CAT_So, CAT_Sc, CAT_Sc, NOCAT,
+  CAT_So, CAT_Sm, CAT_Sm, CAT_Sm, CAT_Sm, CAT_So, CAT_So, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Cf, CAT_Cf, CAT_Cf, CAT_So, CAT_So, NOCAT, NOCAT,
+  /* U+10000 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10080 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10100 */
+  CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+10180 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_No, CAT_No, CAT_So, CAT_So, CAT_So, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Mn, NOCAT, NOCAT,
+  /* U+10280 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10300 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Nl, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Nl, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10380 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Po, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10400 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+10480 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10500 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10700 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10800 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Po,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_So,
+  CAT_So, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+10880 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+10900 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10980 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_No, CAT_No, CAT_Lo, CAT_Lo,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+10A00 */
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_No, CAT_No, CAT_Po,
+  /* U+10A80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_No, CAT_No, CAT_No,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_So, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10B00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+10B80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10C00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10C80 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+10D00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+10E00 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT,
+  /* U+10F00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_No, CAT_No, CAT_No, CAT_No, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11000 */
+  CAT_Mc, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT,
+  NOCAT, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn,
+  /* U+11080 */
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, CAT_Cf, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Cf, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11100 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Lo, CAT_Mc, CAT_Mc, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Po, CAT_Po, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11180 */
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Lo, CAT_Po, CAT_Lo, CAT_Po, CAT_Po, CAT_Po,
+  NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11200 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11280 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11300 */
+  CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT, NOCAT, CAT_Mc,
+  CAT_Mc, NOCAT, NOCAT, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT, NOCAT,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mc,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, NOCAT, NOCAT, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11400 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, CAT_Po, NOCAT, CAT_Po, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11480 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Po, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11580 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11600 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Po, CAT_Po, CAT_Po, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11680 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11700 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_No, CAT_No, CAT_Po, CAT_Po, CAT_Po, CAT_So,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11800 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11880 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo,
+  /* U+11A00 */
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+11A80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Po, CAT_Po, CAT_Po, CAT_Lo, CAT_Po, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11C00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mc,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Lo, CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT,
+  CAT_Po, CAT_Po, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+11C80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11D00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, NOCAT, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lo, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo,
+  CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+11D80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT,
+  CAT_Mn, CAT_Mn, NOCAT, CAT_Mc, CAT_Mc, CAT_Mn, CAT_Mc, CAT_Mn,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+11E80 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Mn, CAT_Mn, CAT_Mc, CAT_Mc, CAT_Po,
+  CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+12380 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+12400 */
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl,
+  CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, CAT_Nl, NOCAT,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+12500 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+13400 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+14600 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+16A00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+16A80 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+16B00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Po, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+16B80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+16E00 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  /* U+16E80 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+16F00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, CAT_Mc, NOCAT,
+  /* U+16F80 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm, CAT_Lm,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lm, CAT_Lm, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+18780 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+18A80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1B100 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+1B280 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1BC00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  /* U+1BC80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_So, CAT_Mn, CAT_Mn, CAT_Po,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D080 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D100 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Mc, CAT_Mc, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_So, CAT_Mc, CAT_Mc, CAT_Mc,
+  CAT_Mc, CAT_Mc, CAT_Mc, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+1D180 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D200 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D280 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D300 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1D400 */
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  /* U+1D480 */
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, NOCAT, CAT_Lu, CAT_Lu,
+  NOCAT, NOCAT, CAT_Lu, NOCAT, NOCAT, CAT_Lu, CAT_Lu, NOCAT,
+  NOCAT, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, NOCAT, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, NOCAT, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, NOCAT, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  /* U+1D500 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, NOCAT, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, NOCAT, NOCAT, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, NOCAT, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, NOCAT, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, NOCAT, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, NOCAT,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, NOCAT, CAT_Lu, NOCAT,
+  NOCAT, NOCAT, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, NOCAT, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  /* U+1D580 */
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  /* U+1D600 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  /* U+1D680 */
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, NOCAT, NOCAT,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  /* U+1D700 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Sm, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Sm, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Sm,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Sm,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  /* U+1D780 */
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu, CAT_Lu,
+  CAT_Lu, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Ll, CAT_Sm, CAT_Ll, CAT_Ll, CAT_Ll, CAT_Ll,
+  CAT_Ll, CAT_Ll, CAT_Lu, CAT_Ll, NOCAT, NOCAT, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  /* U+1DA00 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_Mn, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1DA80 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_Mn, CAT_So, CAT_So, CAT_Po,
+  CAT_Po, CAT_Po, CAT_Po, CAT_Po, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1E000 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, NOCAT, NOCAT, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn, NOCAT, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1E880 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1E900 */
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_LC,
+  CAT_LC, CAT_LC, CAT_LC, CAT_LC, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd, CAT_Nd,
+  CAT_Nd, CAT_Nd, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Po, CAT_Po,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1EC00 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  /* U+1EC80 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_So, CAT_No, CAT_No, CAT_No,
+  CAT_Sc, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1EE00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, CAT_Lo,
+  NOCAT, CAT_Lo, NOCAT, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  NOCAT, CAT_Lo, NOCAT, CAT_Lo, NOCAT, CAT_Lo, NOCAT, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT, NOCAT, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, NOCAT,
+  /* U+1EE80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Sm, CAT_Sm, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F000 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1F080 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F100 */
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, CAT_No,
+  CAT_No, CAT_No, CAT_No, CAT_No, CAT_No, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1F180 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1F200 */
+  CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F380 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk, CAT_Sk,
+  /* U+1F680 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F700 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F780 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F800 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1F880 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+1F900 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, NOCAT, NOCAT, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT,
+  NOCAT, NOCAT, CAT_So, NOCAT, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1F980 */
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  /* U+1FA00 */
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So,
+  CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, CAT_So, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2A680 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2B700 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+2B800 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+2CE80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  /* U+2EB80 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+2FA00 */
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo,
+  CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, CAT_Lo, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  /* U+E0000 */
+  NOCAT, CAT_Cf, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf, CAT_Cf,
+  /* U+E0100 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  /* U+E0180 */
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn, CAT_Mn,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+  NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT, NOCAT,
+};
@@ -5,6 +5,8 @@
 //#include <errno.h>
 #include "local.h"
 
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+
 /*
    struct caseconv_entry describes the case conversion behaviour
    of a range of Unicode characters.
@@ -139,6 +141,43 @@ touupper (wint_t c)
   return c;
 }
 
+#else /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
+/* casestages.t holds the conversions of caseconv.t in two stages, see
+   mkstages: for each character the index of the caseconv_rule that
+   gives the offsets towlower and towupper add to it.  */
+struct caseconv_rule {
+  int_least32_t lower;
+  int_least32_t upper;
+};
+#include "casestages.t"
+
+static inline const struct caseconv_rule *
+caseconv_rule (wint_t c)
+{
+  if (c < 0x100)
+    return &caseconv_rules[caseconv_blocks[c]];
+  if (c >= CASECONV_LIMIT)
+    return &caseconv_rules[0];
+  return &caseconv_rules[caseconv_blocks[(caseconv_index[c >> CASECONV_SHIFT]
+					  << CASECONV_SHIFT)
+					 + (c & ((1 << CASECONV_SHIFT) - 1))]];
+}
+
+static wint_t
+toulower (wint_t c)
+{
+  return c + caseconv_rule (c)->lower;
+}
+
+static wint_t
+touupper (wint_t c)
+{
+  return c + caseconv_rule (c)->upper;
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
+
 wint_t
 towctrans_l (wint_t c, wctrans_t w, struct __locale_t *locale)
 {
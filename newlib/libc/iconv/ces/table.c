@@ -165,6 +165,25 @@ table_convert_from_ucs (void *data,
   *outbytesleft -= 2;
   return 2; 
 }
+
+#ifdef ICONV_BULK_CONVERSION
+static size_t
+table_convert_from_ucs_bulk (void *data,
+                                    const ucs4_t *in,
+                                    size_t inlen,
+                                    unsigned char **outbuf,
+                                    size_t *outbytesleft)
+{
+  size_t n;
+
+  for (n = 0; n < inlen && *outbytesleft > 0; n++)
+    if ((__int32_t)table_convert_from_ucs (data, in[n], outbuf,
+                                           outbytesleft) <= 0)
+      break;
+
+  return n;
+}
+#endif
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
 #if defined (ICONV_TO_UCS_CES_TABLE)
@@ -245,6 +264,49 @@ table_convert_to_ucs (void *data,
   *inbytesleft -= 2;
   return (ucs4_t)ucs; 
 }
+
+#ifdef ICONV_BULK_CONVERSION
+static size_t
+table_convert_to_ucs_bulk (void *data,
+                                  const unsigned char **inbuf,
+                                  size_t *inbytesleft,
+                                  ucs4_t *out,
+                                  size_t outlen)
+{
+  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  const unsigned char *in = *inbuf;
+  ucs4_t ucs;
+  size_t n;
+
+  if (ccsp->bits == TABLE_8BIT)
+    {
+      if (outlen > *inbytesleft)
+        outlen = *inbytesleft;
+
+      for (n = 0; n < outlen; n++)
+        {
+          ucs = (ucs4_t)ccsp->tbl[in[n]];
+          if (ucs == INVALC)
+            break;
+          out[n] = ucs;
+        }
+
+      *inbuf += n;
+      *inbytesleft -= n;
+      return n;
+    }
+
+  for (n = 0; n < outlen && *inbytesleft > 0; n++)
+    {
+      ucs = table_convert_to_ucs (data, inbuf, inbytesleft);
+      if ((__int32_t)ucs < 0)
+        break;
+      out[n] = ucs;
+    }
+
+  return n;
+}
+#endif
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
 static int
@@ -264,7 +326,10 @@ _iconv_to_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_to_ucs
+  table_convert_to_ucs,
+#ifdef ICONV_BULK_CONVERSION
+  table_convert_to_ucs_bulk
+#endif
 };
 #endif /* ICONV_FROM_UCS_CES_TABLE */
 
@@ -278,7 +343,10 @@ _iconv_from_ucs_ces_handlers_table =
   NULL,
   NULL,
   NULL,
-  table_convert_from_ucs
+  table_convert_from_ucs,
+#ifdef ICONV_BULK_CONVERSION
+  table_convert_from_ucs_bulk
+#endif
 };
 #endif /* ICONV_TO_UCS_CES_TABLE */
 
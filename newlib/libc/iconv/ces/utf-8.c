@@ -120,6 +120,32 @@ convert_from_ucs (void *data,
   
   return bytes;
 }
+
+#ifdef ICONV_BULK_CONVERSION
+static size_t
+convert_from_ucs_bulk (void *data,
+                              const ucs4_t *in,
+                              size_t inlen,
+                              unsigned char **outbuf,
+                              size_t *outbytesleft)
+{
+  size_t n;
+
+  for (n = 0; n < inlen; n++)
+    {
+      if (in[n] < 0x80 && *outbytesleft > 0)
+        {
+          *(*outbuf)++ = (unsigned char)in[n];
+          *outbytesleft -= 1;
+        }
+      else if ((__int32_t)convert_from_ucs (data, in[n], outbuf,
+                                            outbytesleft) <= 0)
+        break;
+    }
+
+  return n;
+}
+#endif
 #endif /* ICONV_FROM_UCS_CES_UTF_8 */
 
 #if defined (ICONV_TO_UCS_CES_UTF_8)
@@ -254,6 +280,35 @@ convert_to_ucs (void *data,
 
   return res;
 }
+
+#ifdef ICONV_BULK_CONVERSION
+static size_t
+convert_to_ucs_bulk (void *data,
+                            const unsigned char **inbuf,
+                            size_t *inbytesleft,
+                            ucs4_t *out,
+                            size_t outlen)
+{
+  ucs4_t res;
+  size_t n;
+
+  for (n = 0; n < outlen && *inbytesleft > 0; n++)
+    {
+      if (**inbuf < 0x80)
+        {
+          out[n] = (ucs4_t)*(*inbuf)++;
+          *inbytesleft -= 1;
+          continue;
+        }
+      res = convert_to_ucs (data, inbuf, inbytesleft);
+      if ((__int32_t)res < 0)
+        break;
+      out[n] = res;
+    }
+
+  return n;
+}
+#endif
 #endif /* ICONV_TO_UCS_CES_UTF_8 */
 
 static int
@@ -272,7 +327,10 @@ _iconv_to_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_to_ucs
+  convert_to_ucs,
+#ifdef ICONV_BULK_CONVERSION
+  convert_to_ucs_bulk
+#endif
 };
 #endif
 
@@ -286,7 +344,10 @@ _iconv_from_ucs_ces_handlers_utf_8 =
   NULL,
   NULL,
   NULL,
-  convert_from_ucs
+  convert_from_ucs,
+#ifdef ICONV_BULK_CONVERSION
+  convert_from_ucs_bulk
+#endif
 };
 #endif
 
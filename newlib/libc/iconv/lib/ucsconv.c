@@ -39,6 +39,26 @@ static int
 find_encoding_name (const char *searchee,
                             const char **names);
 
+#ifdef ICONV_BULK_CONVERSION
+/*
+ * Most UCS codes converted at a time by convert_bulk; it starts with
+ * fewer so that little is decoded in vain when a character soon stops it.
+ */
+#define BULK_CHUNK 64
+#define BULK_CHUNK_FIRST 4
+
+static void
+make_direct (struct _reent *rptr,
+                    iconv_ucs_conversion_t *uc);
+
+static size_t
+convert_bulk (iconv_ucs_conversion_t *uc,
+                     const unsigned char **inbuf,
+                     size_t *inbytesleft,
+                     unsigned char **outbuf,
+                     size_t *outbytesleft);
+#endif
+
 
 /*
  * UCS-based conversion interface functions implementation.
@@ -109,6 +129,10 @@ ucs_based_conversion_open (struct _reent *rptr,
   else
     uc->from_ucs.data = (void *)&fake_data;
 
+#ifdef ICONV_BULK_CONVERSION
+  make_direct (rptr, uc);
+#endif
+
   return uc;
 
 error:
@@ -135,6 +159,8 @@ ucs_based_conversion_close (struct _reent *rptr,
   if (uc->to_ucs.handlers->close != NULL)
     res |= uc->to_ucs.handlers->close (rptr, uc->to_ucs.data);
 
+  if (uc->direct != NULL)
+    _free_r (rptr, (void *)uc->direct);
   _free_r (rptr, (void *)data);
 
   return res;
@@ -168,6 +194,16 @@ ucs_based_conversion_convert (struct _reent *rptr,
           return (size_t)-1;
         }
 
+#ifdef ICONV_BULK_CONVERSION
+      /*
+       * Convert what can be converted in runs; the character that stops
+       * them is left to the code below, which deals with errors.
+       */
+      if (!(flags & ICONV_DONT_SAVE_BIT)
+          && convert_bulk (uc, inbuf, inbytesleft, outbuf, outbytesleft) > 0)
+        continue;
+#endif
+
       ch = uc->to_ucs.handlers->convert_to_ucs (uc->to_ucs.data,
                                                 inbuf, inbytesleft);
 
@@ -333,6 +369,167 @@ _iconv_ucs_conversion_handlers =
  * Supplementary functions.
  */
 
+#ifdef ICONV_BULK_CONVERSION
+/*
+ * make_direct - set up direct conversion from a single-byte encoding.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process;
+ *    iconv_ucs_conversion_t *uc - conversion whose 'direct' table to fill.
+ *
+ * DESCRIPTION:
+ *    If the source encoding is a stateless single-byte one and the
+ *    destination CES converter has convert_from_ucs_bulk, converts each
+ *    byte value once and stores the result in uc->direct, so that
+ *    convert_bulk needs one table lookup per byte. Byte values which are
+ *    invalid, have no corresponding character or take more than 3 bytes
+ *    get length 0. Leaves uc->direct NULL otherwise, or if there is no
+ *    memory for it.
+ */
+static void
+make_direct (struct _reent *rptr,
+                    iconv_ucs_conversion_t *uc)
+{
+  unsigned char byte[1];
+  const unsigned char *inbuf;
+  unsigned char *outbuf;
+  size_t inbytesleft, outbytesleft, bytes;
+  ucs4_t ch;
+  int i;
+
+  if (uc->to_ucs.handlers->convert_to_ucs_bulk == NULL
+      || uc->from_ucs.handlers->convert_from_ucs_bulk == NULL
+      || uc->to_ucs.handlers->get_mb_cur_max (uc->to_ucs.data) != 1)
+    return;
+
+  uc->direct = (unsigned char (*)[4])_malloc_r (rptr, 256 * 4);
+  if (uc->direct == NULL)
+    return;
+
+  for (i = 0; i < 256; i++)
+    {
+      byte[0] = (unsigned char)i;
+      inbuf = &byte[0];
+      inbytesleft = 1;
+      outbuf = &uc->direct[i][1];
+      outbytesleft = 3;
+
+      ch = uc->to_ucs.handlers->convert_to_ucs (uc->to_ucs.data,
+                                                &inbuf, &inbytesleft);
+      if ((__int32_t)ch < 0)
+        bytes = 0;
+      else
+        bytes = uc->from_ucs.handlers->convert_from_ucs (uc->from_ucs.data,
+                                                         ch, &outbuf,
+                                                         &outbytesleft);
+      uc->direct[i][0] = (__int32_t)bytes < 0 ? 0 : (unsigned char)bytes;
+    }
+}
+
+/*
+ * convert_bulk - convert a run of characters.
+ *
+ * PARAMETERS:
+ *    iconv_ucs_conversion_t *uc - conversion;
+ *    const unsigned char **inbuf - input buffer;
+ *    size_t *inbytesleft - input buffer bytes count;
+ *    unsigned char **outbuf - output buffer;
+ *    size_t *outbytesleft - output buffer bytes count.
+ *
+ * DESCRIPTION:
+ *    Converts characters from 'inbuf' up to the first one that
+ *    ucs_based_conversion_convert has to convert on its own: one that is
+ *    invalid or incomplete, has no corresponding character or does not
+ *    fit into 'outbuf'. Does nothing unless both CES converters provide
+ *    bulk conversion.
+ *
+ * RETURN:
+ *    Number of characters converted.
+ */
+static size_t
+convert_bulk (iconv_ucs_conversion_t *uc,
+                     const unsigned char **inbuf,
+                     size_t *inbytesleft,
+                     unsigned char **outbuf,
+                     size_t *outbytesleft)
+{
+  ucs4_t ucs[BULK_CHUNK];
+  const unsigned char *inbuf_save;
+  size_t inbytesleft_save;
+  size_t n, k, res = 0;
+  size_t chunk = BULK_CHUNK_FIRST;
+
+  if (uc->direct != NULL)
+    {
+      const unsigned char *in = *inbuf;
+      const unsigned char *end = in + *inbytesleft;
+      const unsigned char *d;
+      unsigned char *out = *outbuf;
+      size_t left = *outbytesleft;
+
+      for (; in < end; in++)
+        {
+          d = uc->direct[*in];
+          if (d[0] == 0 || d[0] > left)
+            break;
+          out[0] = d[1];
+          if (d[0] > 1)
+            {
+              out[1] = d[2];
+              if (d[0] > 2)
+                out[2] = d[3];
+            }
+          out += d[0];
+          left -= d[0];
+        }
+
+      res = in - *inbuf;
+      *inbuf = in;
+      *inbytesleft -= res;
+      *outbuf = out;
+      *outbytesleft = left;
+      return res;
+    }
+
+  if (uc->to_ucs.handlers->convert_to_ucs_bulk == NULL
+      || uc->from_ucs.handlers->convert_from_ucs_bulk == NULL)
+    return 0;
+
+  while (*inbytesleft > 0 && *outbytesleft > 0)
+    {
+      inbuf_save = *inbuf;
+      inbytesleft_save = *inbytesleft;
+
+      n = uc->to_ucs.handlers->convert_to_ucs_bulk (uc->to_ucs.data,
+                                                    inbuf, inbytesleft,
+                                                    ucs, chunk);
+      if (n == 0)
+        break;
+
+      k = uc->from_ucs.handlers->convert_from_ucs_bulk (uc->from_ucs.data,
+                                                        ucs, n, outbuf,
+                                                        outbytesleft);
+      res += k;
+      if (k < n)
+        {
+          /* Step back to just after the characters that were written */
+          *inbuf = inbuf_save;
+          *inbytesleft = inbytesleft_save;
+          if (k > 0)
+            uc->to_ucs.handlers->convert_to_ucs_bulk (uc->to_ucs.data,
+                                                      inbuf, inbytesleft,
+                                                      ucs, k);
+          break;
+        }
+
+      if (chunk < BULK_CHUNK)
+        chunk *= 2;
+    }
+
+  return res;
+}
+#endif /* ICONV_BULK_CONVERSION */
+
 static int
 find_encoding_name (const char *searchee,
                            const char **names)
@@ -41,6 +41,15 @@
 /* All unknown characters are marked by this code */
 #define DEFAULT_CHARACTER 0x3f /* ASCII '?' */
 
+/*
+ * Stateless CES converters provide convert_to_ucs_bulk and
+ * convert_from_ucs_bulk, which ucsconv.c uses to convert runs of
+ * characters through a buffer of UCS codes.  Not when optimizing for size.
+ */
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+#  define ICONV_BULK_CONVERSION
+#endif
+
 
 /*
  * iconv_to_ucs_ces_handlers_t - "to UCS" CES converter handlers.
@@ -158,6 +167,31 @@ typedef struct
   ucs4_t (*convert_to_ucs) (void *data,
                                  const unsigned char **inbuf,
                                  size_t *inbytesleft);
+
+  /*
+   * convert_to_ucs_bulk - convert a run of characters to UCS.
+   *
+   * PARAMETERS:
+   *   void *data               - CES converter-specific data;
+   *   const unsigned char **inbuf - buffer with input byte sequence;
+   *   size_t *inbytesleft          - input buffer bytes count;
+   *   ucs4_t *out                 - buffer for the resulting UCS codes;
+   *   size_t outlen                - number of codes 'out' can hold.
+   *
+   * DESCRIPTION:
+   *   Does what up to 'outlen' calls of convert_to_ucs would do, but
+   *   stops before the first character for which convert_to_ucs would
+   *   return an error, leaving it to convert_to_ucs. May be NULL; only
+   *   stateless CES converters provide it.
+   *
+   * RETURN:
+   *   Returns the number of UCS codes stored into 'out'.
+   */
+  size_t (*convert_to_ucs_bulk) (void *data,
+                                 const unsigned char **inbuf,
+                                 size_t *inbytesleft,
+                                 ucs4_t *out,
+                                 size_t outlen);
 } iconv_to_ucs_ces_handlers_t;
 
 
@@ -219,6 +253,33 @@ typedef struct
                                    ucs4_t in,
                                    unsigned char **outbuf,
                                    size_t *outbytesleft);
+
+  /*
+   * convert_from_ucs_bulk - convert a run of UCS characters to destination
+   * encoding.
+   *
+   * PARAMETERS:
+   *   void *data         - CES converter-specific data;
+   *   const ucs4_t *in       - input UCS-4 characters;
+   *   size_t inlen           - number of characters in 'in';
+   *   unsigned char **outbuf - output buffer for the result;
+   *   size_t *outbytesleft   - output buffer bytes count.
+   *
+   * DESCRIPTION:
+   *   Does what convert_from_ucs would do for each character of 'in', but
+   *   stops before the first character for which convert_from_ucs would
+   *   not succeed, either because it has no corresponding character or
+   *   because it does not fit. May be NULL; only stateless CES converters
+   *   provide it.
+   *
+   * RETURN:
+   *   Returns the number of characters from 'in' that were converted.
+   */
+  size_t (*convert_from_ucs_bulk) (void *data,
+                                   const ucs4_t *in,
+                                   size_t inlen,
+                                   unsigned char **outbuf,
+                                   size_t *outbytesleft);
 } iconv_from_ucs_ces_handlers_t;
 
 
@@ -276,6 +337,14 @@ typedef struct
 
   /* UCS -> destination encoding CES converter. */
   iconv_from_ucs_ces_desc_t from_ucs;
+
+  /*
+   * For a single-byte source encoding and a destination CES converter
+   * with convert_from_ucs_bulk, the destination bytes for each source
+   * byte: their number (0 if the byte takes the character by character
+   * path), then up to 3 bytes. NULL otherwise.
+   */
+  unsigned char (*direct)[4];
 } iconv_ucs_conversion_t;
 
 
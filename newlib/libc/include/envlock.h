@@ -12,4 +12,16 @@
 void __env_lock (struct _reent *reent);
 void __env_unlock (struct _reent *reent);
 
+/* Bumped by the setenv family, with the environment locked, whenever it
+   changes environ, so that a reader which saw a value of it can tell
+   without the lock whether what it read from environ still holds.  */
+extern unsigned int __env_generation;
+
+#ifdef __SINGLE_THREAD__
+#define ENV_CHANGED (++__env_generation)
+#else
+#define ENV_CHANGED __atomic_store_n (&__env_generation, \
+				      __env_generation + 1, __ATOMIC_RELEASE)
+#endif
+
 #endif /* _INCLUDE_ENVLOCK_H_ */
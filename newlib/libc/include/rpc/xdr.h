@@ -379,6 +379,23 @@ extern bool_t xdrrec_skiprecord (XDR *);
 extern bool_t xdrrec_eof (XDR *);
 extern u_int xdrrec_readbytes (XDR *, caddr_t, u_int);
 
+/* a buffer of a vectored write, laid out as a struct iovec */
+struct xdr_iovec
+{
+  void *iov_base;
+  size_t iov_len;
+};
+
+/* send opaque data of sendsize bytes or more straight from the caller's
+   memory, after the buffered bytes, with one vectored write */
+extern bool_t xdrrec_setwritev (XDR *,
+                                int (*) (void *, const struct xdr_iovec *,
+                                         int));
+
+/* read opaque data of recvsize bytes or more straight into the caller's
+   memory */
+extern bool_t xdrrec_setdirectread (XDR *, bool_t);
+
 /* free memory buffers for xdr */
 extern void xdr_free (xdrproc_t, void *);
 
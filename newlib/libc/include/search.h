@@ -33,7 +33,13 @@ typedef enum {
 typedef struct node {
 	char         *key;
 	struct node  *llink, *rlink;
+	int           height;	/* of the AVL subtree rooted here */
 } node_t;
+
+/* An AVL tree of n nodes is less than 1.5 log2(n) high.  */
+#define TREE_MAX_HEIGHT (sizeof(void *) * 8 * 3 / 2)
+
+int __tree_balance(node_t **);
 #endif
 
 struct hsearch_data
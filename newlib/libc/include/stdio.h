@@ -100,6 +100,9 @@ typedef _fpos64_t fpos64_t;
 
 /* _flags2 flags */
 #define	__SNLK  0x0001		/* stdio functions do not lock streams themselves */
+#define	__SLBR  0x0002		/* stream is on the line buffered stream registry */
+#define	__SGLU  0x0004		/* FILE lives in the global glue, reusable by __sfp */
+#define	__SFRE  0x0008		/* FILE is on the free list of __sfp */
 #define	__SWID	0x2000		/* true => stream orientation wide, false => byte, only valid if __SORD in _flags is true */
 
 /*
@@ -548,6 +551,24 @@ char *  fgets_unlocked (char *__restrict, int, FILE *__restrict);
 int	fputs_unlocked (const char *__restrict, FILE *__restrict);
 #endif
 
+#if __MISC_VISIBLE /* Newlib-specific */
+#if !defined(__CYGWIN__) || defined(_COMPILING_NEWLIB)
+typedef struct __printf_compiled printf_compiled_t;
+
+#ifndef _REENT_ONLY
+printf_compiled_t *printf_compile (const char *);
+void	printf_compiled_free (printf_compiled_t *);
+int	fprintf_compiled (FILE *__restrict, const printf_compiled_t *, ...);
+int	vfprintf_compiled (FILE *__restrict, const printf_compiled_t *,
+			   __VALIST);
+#endif /* !_REENT_ONLY */
+printf_compiled_t *_printf_compile_r (struct _reent *, const char *);
+void	_printf_compiled_free_r (struct _reent *, printf_compiled_t *);
+int	_vfprintf_compiled_r (struct _reent *, FILE *__restrict,
+			      const printf_compiled_t *, __VALIST);
+#endif /* !__CYGWIN__ */
+#endif /* __MISC_VISIBLE */
+
 #ifdef __LARGE64_FILES
 #if !defined(__CYGWIN__) || defined(_COMPILING_NEWLIB)
 FILE *	fdopen64 (int, const char *);
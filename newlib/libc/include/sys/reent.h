@@ -44,6 +44,9 @@ struct _reent;
 
 struct __locale_t;
 
+struct _malloc_tcache;
+struct __arc4random_state;
+
 /*
  * If _REENT_SMALL is defined, we make struct _reent as small as possible,
  * by having nearly everything possible allocated at first use.
@@ -421,6 +424,8 @@ struct _reent
   __FILE *__sf;			        /* file descriptors */
   struct _misc_reent *_misc;            /* strtok, multibyte states */
   char *_signal_buf;                    /* strsignal */
+  struct _malloc_tcache *_malloc_tcache; /* chunks cached by malloc */
+  struct __arc4random_state *_arc4random; /* arc4random generator */
 };
 
 #ifdef _REENT_GLOBAL_STDIO_STREAMS
@@ -607,6 +612,8 @@ extern const struct __sFILE_fake __sf_fake_stderr;
 #define _REENT_L64A_BUF(ptr)    ((ptr)->_misc->_l64a_buf)
 #define _REENT_GETDATE_ERR_P(ptr) (&((ptr)->_misc->_getdate_err))
 #define _REENT_SIGNAL_BUF(ptr)  ((ptr)->_signal_buf)
+#define _REENT_MALLOC_TCACHE(ptr) ((ptr)->_malloc_tcache)
+#define _REENT_ARC4RANDOM(ptr)  ((ptr)->_arc4random)
 
 #else /* !_REENT_SMALL */
 
@@ -663,6 +670,10 @@ struct _reent
           _mbstate_t _wcrtomb_state;
           _mbstate_t _wcsrtombs_state;
 	  int _h_errno;
+	  /* chunks cached by malloc, in space once used by _unused */
+	  struct _malloc_tcache *_malloc_tcache;
+	  /* this thread's arc4random generator, likewise */
+	  struct __arc4random_state *_arc4random;
         } _reent;
   /* Two next two fields were once used by malloc.  They are no longer
      used. They are used to preserve the space used before so as to
@@ -794,6 +805,8 @@ extern __FILE __sf[3];
 #define _REENT_L64A_BUF(ptr)    ((ptr)->_new._reent._l64a_buf)
 #define _REENT_SIGNAL_BUF(ptr)  ((ptr)->_new._reent._signal_buf)
 #define _REENT_GETDATE_ERR_P(ptr) (&((ptr)->_new._reent._getdate_err))
+#define _REENT_MALLOC_TCACHE(ptr) ((ptr)->_new._reent._malloc_tcache)
+#define _REENT_ARC4RANDOM(ptr)  ((ptr)->_new._reent._arc4random)
 
 #endif /* !_REENT_SMALL */
 
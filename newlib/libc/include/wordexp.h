@@ -40,9 +40,9 @@ enum {
   WRDE_NOSYS
 };
 
-/* Note: This implementation of wordexp requires a version of bash
-   that supports the --wordexp and --protected arguments to be present
-   on the system.  It does not support the WRDE_UNDEF flag. */
+/* Note: Words are expanded without running a shell, except for command
+   substitution, which requires a version of bash that supports the
+   --wordexp argument to be present on the system. */
 int wordexp(const char *__restrict, wordexp_t *__restrict, int);
 void wordfree(wordexp_t *);
 
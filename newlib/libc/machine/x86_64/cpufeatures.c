@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Processor features the string kernels choose between, see strvec.h */
+
+#include <cpuid.h>
+#include "strvec.h"
+
+int __x86_64_cpu_features;
+
+int
+__x86_64_init_cpu_features (void)
+{
+  unsigned int eax, ebx, ecx, edx;
+  unsigned int xcr0_lo, xcr0_hi;
+  int features = X86_64_PROBED;
+
+  /* AVX2 needs the processor to have it and the operating system to
+     save the upper halves of the ymm registers.  */
+  if (__get_cpuid (1, &eax, &ebx, &ecx, &edx)
+      && (ecx & bit_OSXSAVE) && (ecx & bit_AVX))
+    {
+      __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+      if ((xcr0_lo & 0x6) == 0x6
+	  && __get_cpuid_max (0, NULL) >= 7)
+	{
+	  __cpuid_count (7, 0, eax, ebx, ecx, edx);
+	  if (ebx & bit_AVX2)
+	    features |= X86_64_AVX2;
+	}
+    }
+
+  __x86_64_cpu_features = features;
+  return features;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/memchr.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "memchr.c"
+#undef VEC
+#define VEC 32
+#include "memchr.c"
+#undef VEC
+
+DISPATCH (void *, memchr, (const void *src, int c, size_t n), (src, c, n))
+
+#else /* VEC */
+
+static void * VEC_TARGET
+VEC_FN (memchr) (const void *src, int c, size_t n)
+{
+  const unsigned char *s = (const unsigned char *) src;
+  const unsigned char *p = VEC_ALIGN (s);
+  size_t off = s - p;
+  vec_t cv = vec_set1 (c);
+  vec_t a, b, d, e;
+  vec_mask m;
+
+  if (n == 0)
+    return NULL;
+  m = vec_movemask (vec_eq (vec_load (p), cv)) >> off;
+  if (n < VEC - off)
+    m &= VEC_LOW (n);
+  if (m)
+    return (void *) (s + VEC_FIRST (m));
+  if (n <= VEC - off)
+    return NULL;
+
+  /* n bytes are left from p */
+  n -= VEC - off;
+  for (p += VEC; n >= 4 * VEC; p += 4 * VEC, n -= 4 * VEC)
+    {
+      a = vec_eq (vec_load (p), cv);
+      b = vec_eq (vec_load (p + VEC), cv);
+      d = vec_eq (vec_load (p + 2 * VEC), cv);
+      e = vec_eq (vec_load (p + 3 * VEC), cv);
+      if (vec_movemask (vec_or (vec_or (a, b), vec_or (d, e))))
+	break;
+    }
+  for (; n >= VEC; p += VEC, n -= VEC)
+    if ((m = vec_movemask (vec_eq (vec_load (p), cv))))
+      return (void *) (p + VEC_FIRST (m));
+  if (n > 0 && (m = vec_movemask (vec_eq (vec_load (p), cv)) & VEC_LOW (n)))
+    return (void *) (p + VEC_FIRST (m));
+  return NULL;
+}
+
+#endif /* VEC */
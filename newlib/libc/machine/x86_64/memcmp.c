@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/memcmp.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "memcmp.c"
+#undef VEC
+#define VEC 32
+#include "memcmp.c"
+#undef VEC
+
+DISPATCH (int, memcmp, (const void *m1, const void *m2, size_t n), (m1, m2, n))
+
+#else /* VEC */
+
+static int VEC_TARGET
+VEC_FN (memcmp) (const void *m1, const void *m2, size_t n)
+{
+  const unsigned char *s1 = (const unsigned char *) m1;
+  const unsigned char *s2 = (const unsigned char *) m2;
+  vec_t a, b, d, e;
+  vec_mask m;
+  size_t i;
+
+  if (n < VEC)
+    {
+      if (n == 0)
+	return 0;
+      if (VEC_PAGE_OK (s1) && VEC_PAGE_OK (s2))
+	{
+	  m = ~vec_movemask (vec_eq (vec_loadu (s1), vec_loadu (s2)))
+	      & VEC_LOW (n);
+	  if (!m)
+	    return 0;
+	  i = VEC_FIRST (m);
+	  return s1[i] - s2[i];
+	}
+      for (; n > 0; s1++, s2++, n--)
+	if (*s1 != *s2)
+	  return *s1 - *s2;
+      return 0;
+    }
+
+  for (; n >= 4 * VEC; s1 += 4 * VEC, s2 += 4 * VEC, n -= 4 * VEC)
+    {
+      a = vec_eq (vec_loadu (s1), vec_loadu (s2));
+      b = vec_eq (vec_loadu (s1 + VEC), vec_loadu (s2 + VEC));
+      d = vec_eq (vec_loadu (s1 + 2 * VEC), vec_loadu (s2 + 2 * VEC));
+      e = vec_eq (vec_loadu (s1 + 3 * VEC), vec_loadu (s2 + 3 * VEC));
+      if (vec_movemask (vec_and (vec_and (a, b), vec_and (d, e))) != VEC_ALL)
+	break;
+    }
+  for (; n >= VEC; s1 += VEC, s2 += VEC, n -= VEC)
+    if ((m = vec_movemask (vec_eq (vec_loadu (s1), vec_loadu (s2))) ^ VEC_ALL))
+      {
+	i = VEC_FIRST (m);
+	return s1[i] - s2[i];
+      }
+
+  /* The last vector of both, which overlaps the ones compared */
+  if (n > 0)
+    {
+      s1 += n - VEC;
+      s2 += n - VEC;
+      if ((m = vec_movemask (vec_eq (vec_loadu (s1), vec_loadu (s2))) ^ VEC_ALL))
+	{
+	  i = VEC_FIRST (m);
+	  return s1[i] - s2[i];
+	}
+    }
+  return 0;
+}
+
+#endif /* VEC */
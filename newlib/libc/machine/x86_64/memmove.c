@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/memmove.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+/* Move n < 16 bytes.  Everything is loaded before anything is stored,
+   so the areas may overlap.  */
+static __inline__ __attribute__ ((__always_inline__)) void
+move_small (unsigned char *d, const unsigned char *s, size_t n)
+{
+  uint64_t q0, q1;
+  uint32_t l0, l1;
+  uint16_t w0, w1;
+
+  if (n >= 8)
+    {
+      __builtin_memcpy (&q0, s, 8);
+      __builtin_memcpy (&q1, s + n - 8, 8);
+      __builtin_memcpy (d, &q0, 8);
+      __builtin_memcpy (d + n - 8, &q1, 8);
+    }
+  else if (n >= 4)
+    {
+      __builtin_memcpy (&l0, s, 4);
+      __builtin_memcpy (&l1, s + n - 4, 4);
+      __builtin_memcpy (d, &l0, 4);
+      __builtin_memcpy (d + n - 4, &l1, 4);
+    }
+  else if (n >= 2)
+    {
+      __builtin_memcpy (&w0, s, 2);
+      __builtin_memcpy (&w1, s + n - 2, 2);
+      __builtin_memcpy (d, &w0, 2);
+      __builtin_memcpy (d + n - 2, &w1, 2);
+    }
+  else if (n == 1)
+    *d = *s;
+}
+
+#define VEC 16
+#include "memmove.c"
+#undef VEC
+#define VEC 32
+#include "memmove.c"
+#undef VEC
+
+DISPATCH (void *, memmove, (void *dst, const void *src, size_t n),
+	  (dst, src, n))
+
+#else /* VEC */
+
+static void * VEC_TARGET
+VEC_FN (memmove) (void *dst, const void *src, size_t n)
+{
+  unsigned char *d = (unsigned char *) dst;
+  const unsigned char *s = (const unsigned char *) src;
+  vec_t head, tail, a, b;
+  size_t i;
+
+  if (n < 16)
+    {
+      move_small (d, s, n);
+      return dst;
+    }
+  if (n <= 2 * VEC)
+    {
+#if VEC == 32
+      if (n < VEC)
+	{
+	  __m128i h = vec_loadu_16 (s), t = vec_loadu_16 (s + n - 16);
+	  vec_storeu_16 (d, h);
+	  vec_storeu_16 (d + n - 16, t);
+	  return dst;
+	}
+#endif
+      head = vec_loadu (s);
+      tail = vec_loadu (s + n - VEC);
+      vec_storeu (d, head);
+      vec_storeu (d + n - VEC, tail);
+      return dst;
+    }
+
+  /* Copy forwards unless that would overwrite bytes of src before they
+     are read.  The vector at the far end is loaded first, and stored
+     last, to finish the copy.  */
+  if ((uintptr_t) d - (uintptr_t) s >= n)
+    {
+      tail = vec_loadu (s + n - VEC);
+      for (i = 0; i + 2 * VEC < n; i += 2 * VEC)
+	{
+	  a = vec_loadu (s + i);
+	  b = vec_loadu (s + i + VEC);
+	  vec_storeu (d + i, a);
+	  vec_storeu (d + i + VEC, b);
+	}
+      if (i + VEC < n)
+	vec_storeu (d + i, vec_loadu (s + i));
+      vec_storeu (d + n - VEC, tail);
+    }
+  else
+    {
+      head = vec_loadu (s);
+      for (i = n; i > 2 * VEC; i -= 2 * VEC)
+	{
+	  a = vec_loadu (s + i - VEC);
+	  b = vec_loadu (s + i - 2 * VEC);
+	  vec_storeu (d + i - VEC, a);
+	  vec_storeu (d + i - 2 * VEC, b);
+	}
+      if (i > VEC)
+	vec_storeu (d + i - VEC, vec_loadu (s + i - VEC));
+      vec_storeu (d, head);
+    }
+  return dst;
+}
+
+#endif /* VEC */
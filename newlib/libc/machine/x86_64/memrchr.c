@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/memrchr.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "memrchr.c"
+#undef VEC
+#define VEC 32
+#include "memrchr.c"
+#undef VEC
+
+DISPATCH (void *, memrchr, (const void *src, int c, size_t n), (src, c, n))
+
+#else /* VEC */
+
+static void * VEC_TARGET
+VEC_FN (memrchr) (const void *src, int c, size_t n)
+{
+  const unsigned char *s = (const unsigned char *) src;
+  const unsigned char *p;
+  vec_t cv = vec_set1 (c);
+  vec_t a, b, d, e;
+  vec_mask m;
+  size_t left;
+
+  if (n == 0)
+    return NULL;
+
+  /* The vector holding the last byte, then left bytes before p */
+  p = VEC_ALIGN (s + n - 1);
+  m = vec_movemask (vec_eq (vec_load (p), cv));
+  if ((size_t) (s + n - p) < VEC)
+    m &= VEC_LOW (s + n - p);
+  if (p <= s)
+    {
+      m &= ~VEC_LOW (s - p);
+      return m ? (void *) (p + VEC_LAST (m)) : NULL;
+    }
+  if (m)
+    return (void *) (p + VEC_LAST (m));
+
+  for (left = p - s; left >= 4 * VEC; left -= 4 * VEC)
+    {
+      p -= 4 * VEC;
+      a = vec_eq (vec_load (p), cv);
+      b = vec_eq (vec_load (p + VEC), cv);
+      d = vec_eq (vec_load (p + 2 * VEC), cv);
+      e = vec_eq (vec_load (p + 3 * VEC), cv);
+      if (vec_movemask (vec_or (vec_or (a, b), vec_or (d, e))))
+	{
+	  if ((m = vec_movemask (e)))
+	    return (void *) (p + 3 * VEC + VEC_LAST (m));
+	  if ((m = vec_movemask (d)))
+	    return (void *) (p + 2 * VEC + VEC_LAST (m));
+	  if ((m = vec_movemask (b)))
+	    return (void *) (p + VEC + VEC_LAST (m));
+	  m = vec_movemask (a);
+	  return (void *) (p + VEC_LAST (m));
+	}
+    }
+  for (; left >= VEC; left -= VEC)
+    {
+      p -= VEC;
+      if ((m = vec_movemask (vec_eq (vec_load (p), cv))))
+	return (void *) (p + VEC_LAST (m));
+    }
+  if (left > 0)
+    {
+      p -= VEC;
+      m = vec_movemask (vec_eq (vec_load (p), cv)) & ~VEC_LOW (VEC - left);
+      if (m)
+	return (void *) (p + VEC_LAST (m));
+    }
+  return NULL;
+}
+
+#endif /* VEC */
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/strchr.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "strchr.c"
+#undef VEC
+#define VEC 32
+#include "strchr.c"
+#undef VEC
+
+DISPATCH (char *, strchr, (const char *str, int c), (str, c))
+
+#else /* VEC */
+
+/* Bytes of x that are c or NUL are zero in the result */
+#define CHR_OR_NUL(x, cv)	vec_min (vec_xor (x, cv), x)
+
+static char * VEC_TARGET
+VEC_FN (strchr) (const char *str, int c)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  const unsigned char *p = VEC_ALIGN (s);
+  vec_t cv = vec_set1 (c);
+  vec_t zero = vec_set1 (0);
+  vec_t a, b, d, e;
+  vec_mask m;
+
+  m = vec_movemask (vec_eq (CHR_OR_NUL (vec_load (p), cv), zero)) >> (s - p);
+  if (m)
+    {
+      p = s + VEC_FIRST (m);
+      goto found;
+    }
+
+  /* One vector at a time up to a boundary of four, then four at a time */
+  for (p += VEC; (uintptr_t) p & (4 * VEC - 1); p += VEC)
+    if ((m = vec_movemask (vec_eq (CHR_OR_NUL (vec_load (p), cv), zero))))
+      goto found_in_vec;
+  for (;; p += 4 * VEC)
+    {
+      a = CHR_OR_NUL (vec_load (p), cv);
+      b = CHR_OR_NUL (vec_load (p + VEC), cv);
+      d = CHR_OR_NUL (vec_load (p + 2 * VEC), cv);
+      e = CHR_OR_NUL (vec_load (p + 3 * VEC), cv);
+      if (vec_movemask (vec_eq (vec_min (vec_min (a, b), vec_min (d, e)),
+				zero)))
+	break;
+    }
+  for (;; p += VEC)
+    if ((m = vec_movemask (vec_eq (CHR_OR_NUL (vec_load (p), cv), zero))))
+      break;
+
+found_in_vec:
+  p += VEC_FIRST (m);
+found:
+  return *p == (unsigned char) c ? (char *) p : NULL;
+}
+
+#undef CHR_OR_NUL
+
+#endif /* VEC */
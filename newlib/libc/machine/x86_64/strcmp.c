@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/strcmp.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "strcmp.c"
+#undef VEC
+#define VEC 32
+#include "strcmp.c"
+#undef VEC
+
+DISPATCH (int, strcmp, (const char *s1, const char *s2), (s1, s2))
+
+#else /* VEC */
+
+/* Bytes that differ or are NUL in x are zero in the result */
+#define DIFF_OR_NUL(x, y)	vec_min (vec_eq (x, y), x)
+
+static int VEC_TARGET
+VEC_FN (strcmp) (const char *str1, const char *str2)
+{
+  const unsigned char *s1 = (const unsigned char *) str1;
+  const unsigned char *s2 = (const unsigned char *) str2;
+  vec_t zero = vec_set1 (0);
+  vec_mask m;
+  size_t i;
+
+  if (VEC_PAGE_OK (s1) && VEC_PAGE_OK (s2))
+    {
+      m = vec_movemask (vec_eq (DIFF_OR_NUL (vec_loadu (s1), vec_loadu (s2)),
+				zero));
+      if (m)
+	{
+	  i = VEC_FIRST (m);
+	  return s1[i] - s2[i];
+	}
+      /* Go on from where s1 is aligned */
+      i = VEC - ((uintptr_t) s1 & (VEC - 1));
+      s1 += i;
+      s2 += i;
+    }
+  else
+    for (; (uintptr_t) s1 & (VEC - 1); s1++, s2++)
+      if (*s1 != *s2 || *s1 == '\0')
+	return *s1 - *s2;
+
+  for (;;)
+    {
+      if (VEC_PAGE_OK (s2))
+	{
+	  m = vec_movemask (vec_eq (DIFF_OR_NUL (vec_load (s1),
+						  vec_loadu (s2)), zero));
+	  if (m)
+	    {
+	      i = VEC_FIRST (m);
+	      return s1[i] - s2[i];
+	    }
+	}
+      else
+	for (i = 0; i < VEC; i++)
+	  if (s1[i] != s2[i] || s1[i] == '\0')
+	    return s1[i] - s2[i];
+      s1 += VEC;
+      s2 += VEC;
+    }
+}
+
+#undef DIFF_OR_NUL
+
+#endif /* VEC */
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/strlen.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "strlen.c"
+#undef VEC
+#define VEC 32
+#include "strlen.c"
+#undef VEC
+
+DISPATCH (size_t, strlen, (const char *str), (str))
+
+#else /* VEC */
+
+static size_t VEC_TARGET
+VEC_FN (strlen) (const char *str)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  const unsigned char *p = VEC_ALIGN (s);
+  vec_t zero = vec_set1 (0);
+  vec_t a, b, c, d;
+  vec_mask m;
+
+  m = vec_movemask (vec_eq (vec_load (p), zero)) >> (s - p);
+  if (m)
+    return VEC_FIRST (m);
+
+  /* One vector at a time up to a boundary of four, then four at a time */
+  for (p += VEC; (uintptr_t) p & (4 * VEC - 1); p += VEC)
+    if ((m = vec_movemask (vec_eq (vec_load (p), zero))))
+      return p + VEC_FIRST (m) - s;
+  for (;; p += 4 * VEC)
+    {
+      a = vec_load (p);
+      b = vec_load (p + VEC);
+      c = vec_load (p + 2 * VEC);
+      d = vec_load (p + 3 * VEC);
+      if (vec_movemask (vec_eq (vec_min (vec_min (a, b), vec_min (c, d)),
+				zero)))
+	break;
+    }
+  for (;; p += VEC)
+    if ((m = vec_movemask (vec_eq (vec_load (p), zero))))
+      return p + VEC_FIRST (m) - s;
+}
+
+#endif /* VEC */
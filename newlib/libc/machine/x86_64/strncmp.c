@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/strncmp.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "strncmp.c"
+#undef VEC
+#define VEC 32
+#include "strncmp.c"
+#undef VEC
+
+DISPATCH (int, strncmp, (const char *s1, const char *s2, size_t n), (s1, s2, n))
+
+#else /* VEC */
+
+/* Bytes that differ or are NUL in x are zero in the result */
+#define DIFF_OR_NUL(x, y)	vec_min (vec_eq (x, y), x)
+
+static int VEC_TARGET
+VEC_FN (strncmp) (const char *str1, const char *str2, size_t n)
+{
+  const unsigned char *s1 = (const unsigned char *) str1;
+  const unsigned char *s2 = (const unsigned char *) str2;
+  vec_t zero = vec_set1 (0);
+  vec_mask m;
+  size_t i;
+
+  if (n == 0)
+    return 0;
+  if (VEC_PAGE_OK (s1) && VEC_PAGE_OK (s2))
+    {
+      m = vec_movemask (vec_eq (DIFF_OR_NUL (vec_loadu (s1), vec_loadu (s2)),
+				zero));
+      if (n < VEC)
+	m &= VEC_LOW (n);
+      if (m)
+	{
+	  i = VEC_FIRST (m);
+	  return s1[i] - s2[i];
+	}
+      if (n <= VEC)
+	return 0;
+      /* Go on from where s1 is aligned */
+      i = VEC - ((uintptr_t) s1 & (VEC - 1));
+      s1 += i;
+      s2 += i;
+      n -= i;
+    }
+  else
+    for (; (uintptr_t) s1 & (VEC - 1); s1++, s2++, n--)
+      {
+	if (n == 0)
+	  return 0;
+	if (*s1 != *s2 || *s1 == '\0')
+	  return *s1 - *s2;
+      }
+
+  /* n bytes are left to compare */
+  for (; n > 0; s1 += VEC, s2 += VEC, n -= VEC)
+    {
+      if (VEC_PAGE_OK (s2))
+	{
+	  m = vec_movemask (vec_eq (DIFF_OR_NUL (vec_load (s1),
+						  vec_loadu (s2)), zero));
+	  if (n < VEC)
+	    m &= VEC_LOW (n);
+	  if (m)
+	    {
+	      i = VEC_FIRST (m);
+	      return s1[i] - s2[i];
+	    }
+	}
+      else
+	for (i = 0; i < VEC && i < n; i++)
+	  if (s1[i] != s2[i] || s1[i] == '\0')
+	    return s1[i] - s2[i];
+      if (n <= VEC)
+	return 0;
+    }
+  return 0;
+}
+
+#undef DIFF_OR_NUL
+
+#endif /* VEC */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/strnlen.c"
+#elif !defined (VEC)
+
+#include <string.h>
+#include "strvec.h"
+
+#define VEC 16
+#include "strnlen.c"
+#undef VEC
+#define VEC 32
+#include "strnlen.c"
+#undef VEC
+
+DISPATCH (size_t, strnlen, (const char *str, size_t n), (str, n))
+
+#else /* VEC */
+
+static size_t VEC_TARGET
+VEC_FN (strnlen) (const char *str, size_t n)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  const unsigned char *p = VEC_ALIGN (s);
+  vec_t zero = vec_set1 (0);
+  vec_t a, b, c, d;
+  vec_mask m;
+  size_t len;
+
+  if (n == 0)
+    return 0;
+  m = vec_movemask (vec_eq (vec_load (p), zero)) >> (s - p);
+  if (m)
+    {
+      len = VEC_FIRST (m);
+      return len < n ? len : n;
+    }
+
+  /* One vector at a time up to a boundary of four, then four at a time.
+     p - s bytes have been checked.  */
+  for (p += VEC; (uintptr_t) p & (4 * VEC - 1); p += VEC)
+    {
+      if ((size_t) (p - s) >= n)
+	return n;
+      if ((m = vec_movemask (vec_eq (vec_load (p), zero))))
+	{
+	  len = p + VEC_FIRST (m) - s;
+	  return len < n ? len : n;
+	}
+    }
+  for (; (size_t) (p - s) < n; p += 4 * VEC)
+    {
+      a = vec_load (p);
+      b = vec_load (p + VEC);
+      c = vec_load (p + 2 * VEC);
+      d = vec_load (p + 3 * VEC);
+      if (vec_movemask (vec_eq (vec_min (vec_min (a, b), vec_min (c, d)),
+				zero)))
+	break;
+    }
+  for (; (size_t) (p - s) < n; p += VEC)
+    if ((m = vec_movemask (vec_eq (vec_load (p), zero))))
+      {
+	len = p + VEC_FIRST (m) - s;
+	return len < n ? len : n;
+      }
+  return n;
+}
+
+#endif /* VEC */
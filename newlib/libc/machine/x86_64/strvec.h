@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Vector string kernels.
+
+   Each kernel is written once in terms of the vec_* operations below
+   and compiled twice by including its own file again, the way
+   regexec.c includes engine.c: once with VEC defined to 16 for SSE2,
+   which every x86_64 processor has, and once with VEC defined to 32
+   for AVX2.  DISPATCH then defines the public function, which calls
+   the AVX2 kernel when cpuid says the processor and the operating
+   system support it.  The choice is made on the first call.
+
+   Kernels may load past the end of a string or past the length they
+   were given, but never into a page the data does not reach: aligned
+   loads stay within their page, and unaligned ones past the bounds are
+   only done where VEC_PAGE_OK says they do not cross a page boundary.
+   Only the bytes within the bounds count toward the result.  */
+
+#ifndef _STRVEC_H_
+#define _STRVEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+#define X86_64_PROBED	0x1
+#define X86_64_AVX2	0x2
+
+extern int __x86_64_cpu_features;
+int __x86_64_init_cpu_features (void);
+
+static __inline__ int
+__x86_64_have_avx2 (void)
+{
+  int features = __x86_64_cpu_features;
+
+  if (!features)
+    features = __x86_64_init_cpu_features ();
+  return features & X86_64_AVX2;
+}
+
+#define PAGE_SIZE_MIN	4096
+
+typedef unsigned int vec_mask;
+
+#define VEC_TARGET_16
+#define VEC_TARGET_32	__attribute__ ((__target__ ("avx2")))
+
+#define VEC_INLINE_16	static __inline__ __attribute__ ((__always_inline__))
+#define VEC_INLINE_32	VEC_INLINE_16 VEC_TARGET_32
+
+VEC_INLINE_16 __m128i vec_load_16 (const void *p)
+{ return _mm_load_si128 ((const __m128i *) p); }
+VEC_INLINE_16 __m128i vec_loadu_16 (const void *p)
+{ return _mm_loadu_si128 ((const __m128i *) p); }
+VEC_INLINE_16 void vec_storeu_16 (void *p, __m128i x)
+{ _mm_storeu_si128 ((__m128i *) p, x); }
+VEC_INLINE_16 __m128i vec_set1_16 (int c)
+{ return _mm_set1_epi8 ((char) c); }
+VEC_INLINE_16 __m128i vec_eq_16 (__m128i x, __m128i y)
+{ return _mm_cmpeq_epi8 (x, y); }
+VEC_INLINE_16 __m128i vec_min_16 (__m128i x, __m128i y)
+{ return _mm_min_epu8 (x, y); }
+VEC_INLINE_16 __m128i vec_or_16 (__m128i x, __m128i y)
+{ return _mm_or_si128 (x, y); }
+VEC_INLINE_16 __m128i vec_and_16 (__m128i x, __m128i y)
+{ return _mm_and_si128 (x, y); }
+VEC_INLINE_16 __m128i vec_xor_16 (__m128i x, __m128i y)
+{ return _mm_xor_si128 (x, y); }
+VEC_INLINE_16 vec_mask vec_movemask_16 (__m128i x)
+{ return (vec_mask) _mm_movemask_epi8 (x); }
+
+VEC_INLINE_32 __m256i vec_load_32 (const void *p)
+{ return _mm256_load_si256 ((const __m256i *) p); }
+VEC_INLINE_32 __m256i vec_loadu_32 (const void *p)
+{ return _mm256_loadu_si256 ((const __m256i *) p); }
+VEC_INLINE_32 void vec_storeu_32 (void *p, __m256i x)
+{ _mm256_storeu_si256 ((__m256i *) p, x); }
+VEC_INLINE_32 __m256i vec_set1_32 (int c)
+{ return _mm256_set1_epi8 ((char) c); }
+VEC_INLINE_32 __m256i vec_eq_32 (__m256i x, __m256i y)
+{ return _mm256_cmpeq_epi8 (x, y); }
+VEC_INLINE_32 __m256i vec_min_32 (__m256i x, __m256i y)
+{ return _mm256_min_epu8 (x, y); }
+VEC_INLINE_32 __m256i vec_or_32 (__m256i x, __m256i y)
+{ return _mm256_or_si256 (x, y); }
+VEC_INLINE_32 __m256i vec_and_32 (__m256i x, __m256i y)
+{ return _mm256_and_si256 (x, y); }
+VEC_INLINE_32 __m256i vec_xor_32 (__m256i x, __m256i y)
+{ return _mm256_xor_si256 (x, y); }
+VEC_INLINE_32 vec_mask vec_movemask_32 (__m256i x)
+{ return (vec_mask) _mm256_movemask_epi8 (x); }
+
+typedef __m128i vec_t_16;
+typedef __m256i vec_t_32;
+
+#define VEC_CAT(a, b)	VEC_CAT1 (a, b)
+#define VEC_CAT1(a, b)	a##b
+
+/* Names for the kernel being compiled */
+#define VEC_FN(f)	VEC_CAT (f##_vec, VEC)
+#define VEC_TARGET	VEC_CAT (VEC_TARGET_, VEC)
+#define vec_t		VEC_CAT (vec_t_, VEC)
+#define vec_load	VEC_CAT (vec_load_, VEC)
+#define vec_loadu	VEC_CAT (vec_loadu_, VEC)
+#define vec_storeu	VEC_CAT (vec_storeu_, VEC)
+#define vec_set1	VEC_CAT (vec_set1_, VEC)
+#define vec_eq		VEC_CAT (vec_eq_, VEC)
+#define vec_min		VEC_CAT (vec_min_, VEC)
+#define vec_or		VEC_CAT (vec_or_, VEC)
+#define vec_and		VEC_CAT (vec_and_, VEC)
+#define vec_xor		VEC_CAT (vec_xor_, VEC)
+#define vec_movemask	VEC_CAT (vec_movemask_, VEC)
+
+/* Mask of all VEC bytes, and of the first n < VEC bytes */
+#define VEC_ALL		((vec_mask) ((VEC == 32) ? 0xffffffffu : 0xffffu))
+#define VEC_LOW(n)	((vec_mask) ((1u << (n)) - 1))
+
+/* The aligned vector holding p */
+#define VEC_ALIGN(p)	\
+  ((const unsigned char *) ((uintptr_t) (p) & -(uintptr_t) VEC))
+
+/* Whether a vector loaded from p stays within its page */
+#define VEC_PAGE_OK(p)	\
+  (((uintptr_t) (p) & (PAGE_SIZE_MIN - 1)) <= PAGE_SIZE_MIN - VEC)
+
+#define VEC_FIRST(m)	__builtin_ctz (m)
+#define VEC_LAST(m)	(31 - __builtin_clz (m))
+
+#define DISPATCH(ret, name, params, args)				\
+static ret name##_resolve params;					\
+static ret (*name##_impl) params = name##_resolve;			\
+									\
+static ret								\
+name##_resolve params							\
+{									\
+  name##_impl = __x86_64_have_avx2 () ? name##_vec32 : name##_vec16;	\
+  return name##_impl args;						\
+}									\
+									\
+ret									\
+name params								\
+{									\
+  return name##_impl args;						\
+}
+
+#endif /* _STRVEC_H_ */
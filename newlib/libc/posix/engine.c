@@ -46,6 +46,7 @@
 #ifdef SNAMES
 #define	matcher	smatcher
 #define	fast	sfast
+#define	dfast	sdfast
 #define	slow	sslow
 #define	dissect	sdissect
 #define	backref	sbackref
@@ -57,6 +58,7 @@
 #ifdef LNAMES
 #define	matcher	lmatcher
 #define	fast	lfast
+#define	dfast	ldfast
 #define	slow	lslow
 #define	dissect	ldissect
 #define	backref	lbackref
@@ -93,6 +95,7 @@ static int matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pm
 static char *dissect(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *backref(struct match *m, char *start, char *stop, sopno startst, sopno stopst, sopno lev);
 static char *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static char *dfast(struct match *m, struct re_dfa *d, char *start, char *stop, sopno startst, sopno stopst, states fresh, states *stp, char **coldpp);
 static char *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
 #define	BOL	(OUT+1)
@@ -760,6 +763,7 @@ sopno stopst;
 	int flagch;
 	int i;
 	char *coldp;		/* last p after which no match was underway */
+	struct re_dfa *d;
 
 	CLEAR(st);
 	SET1(st, startst);
@@ -767,6 +771,18 @@ sopno stopst;
 	ASSIGN(fresh, st);
 	SP("start", st, *p);
 	coldp = NULL;
+
+	/* let the DFA cache take us as far as it can */
+	if (!m->g->backrefs && startst == m->g->firststate+1 &&
+			stopst == m->g->laststate &&
+			(d = dfa_take(m->g, NSETBYTES)) != NULL) {
+		p = dfast(m, d, start, stop, startst, stopst, fresh, &st,
+								&coldp);
+		dfa_give(m->g, d);
+		c = (p == m->beginp) ? OUT : *(p-1);
+		SP("dfa", st, *p);
+	}
+
 	for (;;) {
 		/* next character */
 		lastc = c;
@@ -829,6 +845,105 @@ sopno stopst;
 		return(NULL);
 }
 
+/*
+ - dfast - step through the string with the DFA cache
+ == static char *dfast(struct match *m, struct re_dfa *d, char *start, \
+ ==	char *stop, sopno startst, sopno stopst, states fresh, \
+ ==	states *stp, char **coldpp);
+ *
+ * Does what fast() does, but looks up the states reachable after each
+ * character in the cache, stepping only on a miss.  Stops at stop, at
+ * the character before which the stop state is reached, or when the
+ * cache thrashes; sets *stp to the states reachable there before any
+ * ^, $ or word boundary, so that fast() can take over.
+ */
+static char *			/* where fast() should go on from */
+dfast(m, d, start, stop, startst, stopst, fresh, stp, coldpp)
+struct match *m;
+struct re_dfa *d;
+char *start;
+char *stop;
+sopno startst;
+sopno stopst;
+states fresh;
+states *stp;
+char **coldpp;
+{
+	states st = m->st;
+	states tmp = m->tmp;
+	struct dfa_state *s;
+	struct dfa_state *n;
+	char *p = start;
+	char *flushp = start;	/* where the pool was last emptied */
+	unsigned int flushes = d->flushes;
+	int thrash = 0;
+	int cl, c, flagch, i;
+
+	if (start == m->beginp)
+		cl = (m->eflags&REG_NOTBOL) ? DFA_OUT : DFA_OUTBOL;
+	else
+		cl = dfa_lastclass(m->g, *(start-1));
+	s = dfa_state(d, SETBYTES(fresh), cl, SETBYTES(fresh));
+	flushes = d->flushes;
+	while (p < stop && !thrash) {
+		if (s->fresh)
+			*coldpp = p;
+		cl = d->classes[(uch)*p];
+		n = s->next[cl];
+		if (n == NULL) {
+			/* as in fast(), knowing only the class of lastc */
+			c = *p;
+			memcpy(SETBYTES(st), DFA_SET(d, s), NSETBYTES);
+			flagch = '\0';
+			i = 0;
+			if (s->last == DFA_NEWLINE || s->last == DFA_OUTBOL) {
+				flagch = BOL;
+				i = m->g->nbol;
+			}
+			if (c == '\n' && m->g->cflags&REG_NEWLINE) {
+				flagch = (flagch == BOL) ? BOLEOL : EOL;
+				i += m->g->neol;
+			}
+			for (; i > 0; i--)
+				st = step(m->g, startst, stopst, st, flagch, st);
+			if ((flagch == BOL || s->last == DFA_NEWLINE ||
+					s->last == DFA_OTHER) && ISWORD(c))
+				flagch = BOW;
+			if (s->last == DFA_WORD &&
+					(flagch == EOL || !ISWORD(c)))
+				flagch = EOW;
+			if (flagch == BOW || flagch == EOW)
+				st = step(m->g, startst, stopst, st, flagch, st);
+
+			if (ISSET(st, stopst))
+				n = DFA_MATCH;
+			else {
+				ASSIGN(tmp, st);
+				ASSIGN(st, fresh);
+				st = step(m->g, startst, stopst, tmp, c, st);
+				n = dfa_state(d, SETBYTES(st),
+					dfa_lastclass(m->g, c), SETBYTES(fresh));
+			}
+
+			if (d->flushes == flushes)
+				s->next[cl] = n;
+			else {		/* s went with the pool */
+				flushes = d->flushes;
+				if (p - flushp < DFA_THRASH*d->maxstates)
+					thrash = 1;
+				flushp = p;
+			}
+		}
+		if (n == DFA_MATCH)
+			break;
+		s = n;
+		p++;
+	}
+
+	memcpy(SETBYTES(*stp), DFA_SET(d, s), NSETBYTES);
+	return(p);
+}
+
 /*
  - slow - step through the string more deliberately
  == static char *slow(struct match *m, char *start, \
@@ -1132,6 +1247,7 @@ int ch;
 
 #undef	matcher
 #undef	fast
+#undef	dfast
 #undef	slow
 #undef	dissect
 #undef	backref
@@ -253,6 +253,8 @@ int cflags;
 	g->categories = &g->catspace[-(CHAR_MIN)];
 	(void) memset((char *)g->catspace, 0, NC*sizeof(cat_t));
 	g->backrefs = 0;
+	g->dfa = NULL;
+	g->dfabig = 0;
 
 	/* do it */
 	EMIT(OEND, 0);
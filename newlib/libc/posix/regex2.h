@@ -168,6 +168,8 @@ struct re_guts {
 	size_t nsub;		/* copy of re_nsub */
 	int backrefs;		/* does it use back references? */
 	sopno nplus;		/* how deep does it nest +s? */
+	struct re_dfa *dfa;	/* transitions cached by regexec */
+	size_t dfabig;		/* least set size with too big a DFA, or 0 */
 	/* catspace must be last */
 	cat_t catspace[1];	/* actually [NC] */
 };
@@ -54,6 +54,8 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <ctype.h>
 #include <regex.h>
+#include <stddef.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -62,6 +64,236 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 static int nope = 0;		/* for use in asserts; shuts lint up */
 #endif
 
+/*
+ * fast() runs the state machine over the whole string, one step() per
+ * character, so it keeps a cache of the transitions it has computed:
+ * a lazily built DFA whose states are (set of NFA states, class of the
+ * previous character) pairs.  The previous character matters only for
+ * ^, $ and word boundaries, so it is reduced to one of five classes.
+ * Bytes which no part of the RE tells apart share one byte class and
+ * one transition.
+ *
+ * The cache is one allocation of DFA_SIZE bytes hung off the re_guts.
+ * States are carved from its pool as they are met and found again
+ * through a hash table; when the pool is full it is emptied and
+ * refilled.  A regexec() call takes the cache for itself while it
+ * runs, so that concurrent calls with the same RE never share one.
+ */
+#define	DFA_SIZE	16384
+#define	DFA_BUCKETS	64
+#define	DFA_THRASH	4	/* bytes per state below which we give up */
+
+/* classes of the previous character */
+#define	DFA_OUTBOL	0	/* none, beginning of line */
+#define	DFA_OUT		1	/* none, REG_NOTBOL */
+#define	DFA_NEWLINE	2
+#define	DFA_WORD	3
+#define	DFA_OTHER	4
+
+struct dfa_state {
+	struct dfa_state *hnext;	/* hash chain */
+	unsigned int hash;
+	unsigned char last;		/* class of the previous character */
+	unsigned char fresh;		/* the set is that of a fresh start */
+	struct dfa_state *next[1];	/* [nclasses], NULL until known */
+	/* followed by the set of NFA states */
+};
+#define	DFA_MATCH	((struct dfa_state *)1)	/* stop state reached */
+#define	DFA_SET(d, s)	((char *)(s) + (d)->setoff)
+
+struct re_dfa {
+	size_t setsize;		/* bytes in a set of NFA states */
+	size_t setoff;		/* offset of the set in a dfa_state */
+	size_t statesize;	/* bytes in a dfa_state */
+	size_t maxstates;	/* that fit in the pool */
+	char *pool;		/* the states */
+	char *poolnext;
+	char *poolend;
+	unsigned int flushes;	/* times the pool was emptied */
+	struct dfa_state *buckets[DFA_BUCKETS];
+	uch classes[NC];	/* byte -> byte class */
+};
+
+#ifndef __SINGLE_THREAD__
+__LOCK_INIT(static, __regex_dfa_lock);
+#define	DFA_LOCK()	__lock_acquire(__regex_dfa_lock)
+#define	DFA_UNLOCK()	__lock_release(__regex_dfa_lock)
+#else
+#define	DFA_LOCK()
+#define	DFA_UNLOCK()
+#endif
+
+static int
+dfa_lastclass(struct re_guts *g, int c)
+{
+	if (c == '\n' && (g->cflags&REG_NEWLINE))
+		return(DFA_NEWLINE);
+	return(ISWORD(c) ? DFA_WORD : DFA_OTHER);
+}
+
+/*
+ - dfa_refine - split each byte class into the bytes in and not in a set
+ */
+static int			/* number of classes */
+dfa_refine(uch *classes, int n, const char *in)
+{
+	short map[2*NC];
+	int c, k;
+
+	for (k = 0; k < 2*n; k++)
+		map[k] = -1;
+	n = 0;
+	for (c = 0; c < NC; c++) {
+		k = 2*classes[c] + (in[c] != 0);
+		if (map[k] < 0)
+			map[k] = n++;
+		classes[c] = map[k];
+	}
+	return(n);
+}
+
+/*
+ - dfa_classify - split the bytes into classes by everything that can
+ - tell them apart: word characters, newline, and each character and
+ - set in the RE
+ */
+static int			/* number of classes */
+dfa_classify(struct re_guts *g, uch *classes)
+{
+	char in[NC];
+	int n = 1;
+	int c;
+	sopno pc;
+	sop s;
+
+	memset(classes, 0, NC);
+	for (c = 0; c < NC; c++)
+		in[c] = ISWORD(c);
+	n = dfa_refine(classes, n, in);
+	for (c = 0; c < NC; c++)
+		in[c] = (c == '\n');
+	n = dfa_refine(classes, n, in);
+	for (pc = g->firststate+1; pc < g->laststate; pc++) {
+		s = g->strip[pc];
+		if (OP(s) == OCHAR)
+			for (c = 0; c < NC; c++)
+				in[c] = ((char)c == (char)OPND(s));
+		else if (OP(s) == OANYOF)
+			for (c = 0; c < NC; c++)
+				in[c] = CHIN(&g->sets[OPND(s)], c) != 0;
+		else
+			continue;
+		n = dfa_refine(classes, n, in);
+	}
+	return(n);
+}
+
+/*
+ - dfa_take - take the RE's DFA cache for this call, making it if need be
+ */
+static struct re_dfa *
+dfa_take(struct re_guts *g, size_t setsize)
+{
+	struct re_dfa *d;
+	uch classes[NC];
+	size_t setoff, statesize;
+	int n, big;
+
+	DFA_LOCK();
+	big = g->dfabig != 0 && setsize >= g->dfabig;
+	if (big)
+		d = NULL;	/* leave another representation's cache */
+	else {
+		d = g->dfa;
+		g->dfa = NULL;
+	}
+	DFA_UNLOCK();
+	if (big)
+		return(NULL);
+	if (d != NULL && d->setsize == setsize)
+		return(d);
+	free(d);		/* made for the other representation */
+
+	n = dfa_classify(g, classes);
+	setoff = offsetof(struct dfa_state, next) +
+					n*sizeof(struct dfa_state *);
+	statesize = (setoff + setsize + sizeof(void *) - 1) &
+						~(sizeof(void *) - 1);
+	if (sizeof(*d) + DFA_THRASH*statesize > DFA_SIZE) {
+		/* too few states to be worth it, for this or larger sets */
+		DFA_LOCK();
+		if (g->dfabig == 0 || setsize < g->dfabig)
+			g->dfabig = setsize;
+		DFA_UNLOCK();
+		return(NULL);
+	}
+	d = (struct re_dfa *)malloc(DFA_SIZE);
+	if (d == NULL)
+		return(NULL);
+	d->setsize = setsize;
+	d->setoff = setoff;
+	d->statesize = statesize;
+	d->pool = (char *)d + ((sizeof(*d) + sizeof(void *) - 1) &
+						~(sizeof(void *) - 1));
+	d->poolnext = d->pool;
+	d->maxstates = (DFA_SIZE - (d->pool - (char *)d)) / statesize;
+	d->poolend = d->pool + d->maxstates*statesize;
+	d->flushes = 0;
+	memset(d->buckets, 0, sizeof(d->buckets));
+	memcpy(d->classes, classes, NC);
+	return(d);
+}
+
+/*
+ - dfa_give - hand the DFA cache back to the RE for later calls
+ */
+static void
+dfa_give(struct re_guts *g, struct re_dfa *d)
+{
+	struct re_dfa *old;
+
+	DFA_LOCK();
+	old = g->dfa;
+	g->dfa = d;
+	DFA_UNLOCK();
+	free(old);		/* another call's, put back meanwhile */
+}
+
+/*
+ - dfa_state - find the DFA state for a set and previous character
+ - class, making it if need be; this may empty the pool
+ */
+static struct dfa_state *
+dfa_state(struct re_dfa *d, char *set, int last, char *fresh)
+{
+	struct dfa_state *s;
+	unsigned int h = last;
+	size_t i;
+
+	for (i = 0; i < d->setsize; i++)
+		h = h*31 + (uch)set[i];
+	for (s = d->buckets[h % DFA_BUCKETS]; s != NULL; s = s->hnext)
+		if (s->hash == h && s->last == last &&
+				memcmp(DFA_SET(d, s), set, d->setsize) == 0)
+			return(s);
+
+	if (d->poolnext == d->poolend) {
+		d->poolnext = d->pool;
+		d->flushes++;
+		memset(d->buckets, 0, sizeof(d->buckets));
+	}
+	s = (struct dfa_state *)d->poolnext;
+	d->poolnext += d->statesize;
+	memset(s, 0, d->setoff);
+	s->hash = h;
+	s->last = last;
+	memcpy(DFA_SET(d, s), set, d->setsize);
+	s->fresh = (memcmp(set, fresh, d->setsize) == 0);
+	s->hnext = d->buckets[h % DFA_BUCKETS];
+	d->buckets[h % DFA_BUCKETS] = s;
+	return(s);
+}
+
 /* macros for manipulating states, small version */
 #define	states	long
 #define	states1	states		/* for later use in regexec() decision */
@@ -84,6 +316,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) << (n))
 #define	BACK(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) >> (n))
 #define	ISSETBACK(v, n)	(((v) & ((unsigned long)here >> (n))) != 0)
+/* the bytes of a set, and how many there are */
+#define	SETBYTES(v)	((char *)&(v))
+#define	NSETBYTES	sizeof(states1)
 /* function names */
 #define SNAMES			/* engine.c looks after details */
 
@@ -108,6 +343,8 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #undef	FWD
 #undef	BACK
 #undef	ISSETBACK
+#undef	SETBYTES
+#undef	NSETBYTES
 #undef	SNAMES
 
 /* macros for manipulating states, large version */
@@ -133,6 +370,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst)[here+(n)] |= (src)[here])
 #define	BACK(dst, src, n)	((dst)[here-(n)] |= (src)[here])
 #define	ISSETBACK(v, n)	((v)[here - (n)])
+/* the bytes of a set, and how many there are */
+#define	SETBYTES(v)	(v)
+#define	NSETBYTES	((size_t)m->g->nstates)
 /* function names */
 #define	LNAMES			/* flag */
 
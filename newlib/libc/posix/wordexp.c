@@ -11,7 +11,9 @@
 #include <ctype.h>
 #include <dirent.h>
 #include <errno.h>
+#include <fnmatch.h>
 #include <glob.h>
+#include <limits.h>
 #include <pwd.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,17 +27,825 @@
 
 #define MAXLINELEN 500
 
-/* Note: This implementation of wordexp requires a version of bash
-   that supports the --wordexp and --protected arguments to be present
-   on the system.  It does not support the WRDE_UNDEF flag. */
-int
-wordexp(const char *__restrict words, wordexp_t *__restrict pwordexp, int flags)
+#define WRDE_SHELL	(-1)	/* Words need the shell to be expanded. */
+
+#define IFS_DEFAULT	" \t\n"
+#define GLOBCHARS	"*?["
+
+/* A growing string. */
+struct wbuf
+{
+  char *s;
+  size_t len;
+  size_t size;
+};
+
+/* State of an in-process expansion.  Fields are built in field, with
+   quotes removed, and in pat, as a glob pattern with the quoted
+   characters escaped.  Finished fields are kept in words, each
+   terminated by a NUL. */
+struct wexp
+{
+  int flags;
+  const char *ifs;
+  int string;		/* Expanding to a single string: no splitting,
+			   no pathname expansion. */
+  struct wbuf words;
+  size_t nwords;
+  struct wbuf field;
+  struct wbuf pat;
+  int infield;		/* A field has been started. */
+  int magic;		/* pat has unquoted glob characters. */
+};
+
+static int scan(struct wexp *, const char *, const char *, int, int);
+
+static int
+wbuf_add(struct wbuf *b, const char *s, size_t n)
+{
+  char *t;
+  size_t size;
+
+  if (b->len + n >= b->size)
+    {
+      for (size = b->size ? b->size * 2 : 64; b->len + n >= size; size *= 2)
+        ;
+      if (!(t = (char *)realloc(b->s, size)))
+        return WRDE_NOSPACE;
+      b->s = t;
+      b->size = size;
+    }
+  if (n)
+    memcpy(b->s + b->len, s, n);
+  b->len += n;
+  b->s[b->len] = '\0';
+  return WRDE_SUCCESS;
+}
+
+static int
+pushword(struct wexp *we, const char *s, size_t n)
+{
+  if (wbuf_add(&we->words, s, n) || wbuf_add(&we->words, "", 1))
+    return WRDE_NOSPACE;
+  we->nwords++;
+  return WRDE_SUCCESS;
+}
+
+/* Add character c to the field being built. */
+static int
+addchar(struct wexp *we, char c, int quoted)
+{
+  if (wbuf_add(&we->field, &c, 1))
+    return WRDE_NOSPACE;
+  if ((quoted && strchr(GLOBCHARS "]\\", c)) || c == '\\')
+    if (wbuf_add(&we->pat, "\\", 1))
+      return WRDE_NOSPACE;
+  if (!quoted && strchr(GLOBCHARS, c))
+    we->magic = 1;
+  we->infield = 1;
+  return wbuf_add(&we->pat, &c, 1);
+}
+
+/* Finish the field being built, expanding pathnames in it. */
+static int
+endfield(struct wexp *we)
+{
+  glob_t g;
+  int err = WRDE_SUCCESS;
+  int i, r;
+
+  if (!we->infield)
+    return WRDE_SUCCESS;
+  g.gl_pathc = 0;
+  if (we->magic)
+    {
+      r = glob(we->pat.s, GLOB_QUOTE, NULL, &g);
+      if (r == GLOB_NOSPACE)
+        err = WRDE_NOSPACE;
+      for (i = 0; err == WRDE_SUCCESS && i < g.gl_pathc; i++)
+        err = pushword(we, g.gl_pathv[i], strlen(g.gl_pathv[i]));
+      if (r != GLOB_NOSPACE)
+        globfree(&g);
+    }
+  if (err == WRDE_SUCCESS && g.gl_pathc == 0)
+    err = pushword(we, we->field.s, we->field.len);
+  we->field.len = we->pat.len = 0;
+  we->infield = we->magic = 0;
+  return err;
+}
+
+/* Add the result of an expansion, splitting it into fields at the
+   characters in IFS unless it is quoted. */
+static int
+emit(struct wexp *we, const char *s, size_t n, int quoted)
+{
+  int nonws = !we->infield;	/* An IFS character now ends an empty field. */
+  int err = WRDE_SUCCESS;
+
+  for (; err == WRDE_SUCCESS && n > 0; s++, n--)
+    if (quoted || we->string || *s == '\0' || !strchr(we->ifs, *s))
+      {
+        err = addchar(we, *s, quoted);
+        nonws = 0;
+      }
+    else if (*s == ' ' || *s == '\t' || *s == '\n')
+      err = endfield(we);
+    else
+      {
+        if (we->infield)
+          err = endfield(we);
+        else if (nonws)
+          err = pushword(we, "", 0);
+        nonws = 1;
+      }
+  return err;
+}
+
+/* Expand the words from p to e to a single string in field and pat of
+   sub, which the caller frees. */
+static int
+expandstring(struct wexp *we, struct wexp *sub, const char *p, const char *e)
+{
+  int err;
+
+  memset(sub, 0, sizeof(*sub));
+  sub->flags = we->flags;
+  sub->ifs = we->ifs;
+  sub->string = 1;
+  err = scan(sub, p, e, 0, 0);
+  if (err == WRDE_SUCCESS && (wbuf_add(&sub->field, "", 0)
+                              || wbuf_add(&sub->pat, "", 0)))
+    err = WRDE_NOSPACE;
+  return err;
+}
+
+static void
+freestring(struct wexp *sub)
+{
+  free(sub->field.s);
+  free(sub->pat.s);
+  free(sub->words.s);
+}
+
+/* Return the end of the word starting at p, at the '}' closing a
+   ${...} expansion or the ')' closing a $(...) one, or NULL if there is
+   none before e. */
+static const char *
+skipword(const char *p, const char *e, char close)
+{
+  int inq = 0;
+
+  for (; p < e; p++)
+    switch (*p)
+      {
+      case '\\':
+        p++;
+        break;
+      case '\'':
+        if (!inq && !(p = memchr(p + 1, '\'', e - p - 1)))
+          return NULL;
+        break;
+      case '"':
+        inq = !inq;
+        break;
+      case '`':
+        if (!(p = memchr(p + 1, '`', e - p - 1)))
+          return NULL;
+        break;
+      case '$':
+        if (p + 1 < e && (p[1] == '{' || p[1] == '('))
+          {
+            if (!(p = skipword(p + 2, e, p[1] == '{' ? '}' : ')')))
+              return NULL;
+          }
+        break;
+      case '(':
+        if (close == ')' && !inq && !(p = skipword(p + 1, e, ')')))
+          return NULL;
+        break;
+      default:
+        if (*p == close && !inq)
+          return p;
+        break;
+      }
+  return NULL;
+}
+
+/* Arithmetic expansion */
+
+struct arith
+{
+  const char *p;
+  int err;
+};
+
+static const struct
+{
+  const char op[3];
+  int prec;
+} arith_ops[] = {
+  { "||", 1 }, { "&&", 2 }, { "|", 3 }, { "^", 4 }, { "&", 5 },
+  { "==", 6 }, { "!=", 6 }, { "<=", 7 }, { ">=", 7 }, { "<<", 8 },
+  { ">>", 8 }, { "<", 7 }, { ">", 7 }, { "+", 9 }, { "-", 9 },
+  { "*", 10 }, { "/", 10 }, { "%", 10 }
+};
+
+#define NARITH_OPS (sizeof(arith_ops) / sizeof(arith_ops[0]))
+
+static long arith_binary(struct arith *, int);
+
+static long
+arith_unary(struct arith *a)
+{
+  const char *name, *v;
+  char *end;
+  long n;
+  size_t len;
+
+  while (isspace((unsigned char)*a->p))
+    a->p++;
+  switch (*a->p)
+    {
+    case '(':
+      a->p++;
+      n = arith_binary(a, 1);
+      while (isspace((unsigned char)*a->p))
+        a->p++;
+      if (*a->p++ != ')')
+        a->err = WRDE_SYNTAX;
+      return n;
+    case '-':
+      a->p++;
+      return -(unsigned long)arith_unary(a);
+    case '+':
+      a->p++;
+      return arith_unary(a);
+    case '!':
+      a->p++;
+      return !arith_unary(a);
+    case '~':
+      a->p++;
+      return ~arith_unary(a);
+    }
+  if (isdigit((unsigned char)*a->p))
+    {
+      n = strtol(a->p, &end, 0);
+      a->p = end;
+      return n;
+    }
+  if (isalpha((unsigned char)*a->p) || *a->p == '_')
+    {
+      for (name = a->p; isalnum((unsigned char)*a->p) || *a->p == '_'; a->p++)
+        ;
+      len = a->p - name;
+      if (!(end = (char *)malloc(len + 1)))
+        {
+          a->err = WRDE_NOSPACE;
+          return 0;
+        }
+      memcpy(end, name, len);
+      end[len] = '\0';
+      v = getenv(end);
+      free(end);
+      return v ? strtol(v, NULL, 0) : 0;
+    }
+  a->err = WRDE_SYNTAX;
+  return 0;
+}
+
+static long
+arith_binary(struct arith *a, int minprec)
+{
+  long l, r;
+  int i;
+
+  l = arith_unary(a);
+  while (a->err == WRDE_SUCCESS)
+    {
+      while (isspace((unsigned char)*a->p))
+        a->p++;
+      for (i = 0; i < NARITH_OPS; i++)
+        if (!strncmp(a->p, arith_ops[i].op, strlen(arith_ops[i].op)))
+          break;
+      if (i == NARITH_OPS || arith_ops[i].prec < minprec)
+        break;
+      a->p += strlen(arith_ops[i].op);
+      r = arith_binary(a, arith_ops[i].prec + 1);
+      switch (arith_ops[i].op[0] << 8 | arith_ops[i].op[1])
+        {
+        case '|' << 8 | '|': l = l || r; break;
+        case '&' << 8 | '&': l = l && r; break;
+        case '|' << 8: l |= r; break;
+        case '^' << 8: l ^= r; break;
+        case '&' << 8: l &= r; break;
+        case '=' << 8 | '=': l = l == r; break;
+        case '!' << 8 | '=': l = l != r; break;
+        case '<' << 8 | '=': l = l <= r; break;
+        case '>' << 8 | '=': l = l >= r; break;
+        case '<' << 8 | '<': l = (unsigned long)l << (r & 63); break;
+        case '>' << 8 | '>': l >>= r & 63; break;
+        case '<' << 8: l = l < r; break;
+        case '>' << 8: l = l > r; break;
+        case '+' << 8: l = (unsigned long)l + r; break;
+        case '-' << 8: l = (unsigned long)l - r; break;
+        case '*' << 8: l = (unsigned long)l * r; break;
+        default:
+          if (r == 0 || (r == -1 && l == LONG_MIN))
+            a->err = WRDE_SYNTAX;
+          else if (arith_ops[i].op[0] == '/')
+            l /= r;
+          else
+            l %= r;
+          break;
+        }
+    }
+  return l;
+}
+
+/* Expand $((expr)), with p at expr and e at the closing "))". */
+static int
+arith(struct wexp *we, const char *p, const char *e, int quoted)
+{
+  struct wexp sub;
+  struct arith a;
+  char num[24];
+  long n = 0;
+  int err;
+
+  err = expandstring(we, &sub, p, e);
+  if (err == WRDE_SUCCESS)
+    {
+      a.p = sub.field.s ? sub.field.s : "";
+      a.err = WRDE_SUCCESS;
+      n = arith_binary(&a, 1);
+      while (isspace((unsigned char)*a.p))
+        a.p++;
+      if ((err = a.err) == WRDE_SUCCESS && *a.p != '\0')
+        err = WRDE_SYNTAX;
+    }
+  freestring(&sub);
+  if (err == WRDE_SUCCESS)
+    {
+      sprintf(num, "%ld", n);
+      err = emit(we, num, strlen(num), quoted);
+    }
+  return err;
+}
+
+/* Parameter expansion */
+
+static int
+isname(const char *p, size_t len)
+{
+  size_t i;
+
+  if (len == 0 || isdigit((unsigned char)*p))
+    return 0;
+  for (i = 0; i < len; i++)
+    if (!isalnum((unsigned char)p[i]) && p[i] != '_')
+      return 0;
+  return 1;
+}
+
+/* Return the length of the parameter name at p, or 0 if there is none. */
+static size_t
+namelen(const char *p, const char *e)
+{
+  const char *q;
+
+  if (p < e && strchr("@*#?$!-0123456789", *p))
+    return 1;
+  for (q = p; q < e && (isalnum((unsigned char)*q) || *q == '_'); q++)
+    ;
+  return isdigit((unsigned char)*p) ? 0 : q - p;
+}
+
+/* Look up parameter name, returning NULL if it is unset.  Special
+   parameters are those of a shell started without arguments. */
+static const char *
+getparam(const char *name, char *num)
+{
+  if (name[1] == '\0')
+    switch (name[0])
+      {
+      case '$':
+        sprintf(num, "%ld", (long)getpid());
+        return num;
+      case '#':
+      case '?':
+        return "0";
+      case '@':
+      case '*':
+      case '-':
+        return "";
+      case '0':
+        return "sh";
+      }
+  if (!isname(name, strlen(name)))
+    return NULL;
+  return getenv(name);
+}
+
+static int
+showerr(struct wexp *we, const char *name, const char *msg, int err)
+{
+  if (we->flags & WRDE_SHOWERR)
+    fprintf(stderr, "%s: %s\n", name, msg);
+  return err;
+}
+
+/* Remove from v the shortest or longest prefix or suffix matching pat,
+   as ${name#pat}, ${name##pat}, ${name%pat} and ${name%%pat} do. */
+static int
+trim(struct wexp *we, const char *v, const char *pat, int op, int longest,
+     int quoted)
+{
+  size_t len = strlen(v);
+  size_t i, n;
+  char *t;
+  char c;
+  int err;
+
+  if (!(t = (char *)malloc(len + 1)))
+    return WRDE_NOSPACE;
+  memcpy(t, v, len + 1);
+  for (n = 0; n <= len; n++)
+    {
+      i = longest ? len - n : n;
+      if (op == '#')
+        {
+          c = t[i];
+          t[i] = '\0';
+          if (!fnmatch(pat, t, 0))
+            {
+              t[i] = c;
+              memmove(t, t + i, len - i + 1);
+              break;
+            }
+          t[i] = c;
+        }
+      else if (!fnmatch(pat, t + len - i, 0))
+        {
+          t[len - i] = '\0';
+          break;
+        }
+    }
+  err = emit(we, t, strlen(t), quoted);
+  free(t);
+  return err;
+}
+
+/* Expand ${...}, with p after the '{' and e at the closing '}'. */
+static int
+brace(struct wexp *we, const char *p, const char *e, int quoted)
+{
+  struct wexp sub;
+  char num[24];
+  char *name;
+  const char *v;
+  size_t len;
+  int length = 0;
+  int colon = 0;
+  int op, useword, err;
+
+  if (*p == '#' && p + 1 < e)
+    {
+      length = 1;
+      p++;
+    }
+  if ((len = namelen(p, e)) == 0)
+    return WRDE_SYNTAX;
+  if (!(name = (char *)malloc(len + 1)))
+    return WRDE_NOSPACE;
+  memcpy(name, p, len);
+  name[len] = '\0';
+  p += len;
+  v = getparam(name, num);
+
+  op = p < e ? *p++ : '}';
+  if (op == ':' && p < e && strchr("-=?+", *p))
+    {
+      colon = 1;
+      op = *p++;
+    }
+  if (length && op != '}')
+    op = 0;
+
+  err = WRDE_SUCCESS;
+  useword = !v || (colon && *v == '\0');
+  switch (op)
+    {
+    case '}':
+    case '%':
+    case '#':
+      if (!v && (we->flags & WRDE_UNDEF))
+        {
+          err = showerr(we, name, "unbound variable", WRDE_BADVAL);
+          break;
+        }
+      if (!v)
+        v = "";
+      if (length)
+        {
+          sprintf(num, "%lu", (unsigned long)strlen(v));
+          err = emit(we, num, strlen(num), quoted);
+        }
+      else if (op == '}')
+        err = emit(we, v, strlen(v), quoted);
+      else
+        {
+          len = p < e && *p == op;
+          if ((err = expandstring(we, &sub, p + len, e)) == WRDE_SUCCESS)
+            err = trim(we, v, sub.pat.s, op, len, quoted);
+          freestring(&sub);
+        }
+      break;
+    case '-':
+      err = useword ? scan(we, p, e, quoted, 0)
+                    : emit(we, v, strlen(v), quoted);
+      break;
+    case '+':
+      if (!useword)
+        err = scan(we, p, e, quoted, 0);
+      break;
+    case '=':
+    case '?':
+      if (!useword)
+        {
+          err = emit(we, v, strlen(v), quoted);
+          break;
+        }
+      if ((err = expandstring(we, &sub, p, e)) == WRDE_SUCCESS)
+        {
+          if (op == '?')
+            err = showerr(we, name, p < e ? sub.field.s
+                                           : "parameter null or not set",
+                          WRDE_BADVAL);
+          else if (!isname(name, strlen(name)))
+            err = WRDE_SYNTAX;
+          else if (setenv(name, sub.field.s, 1))
+            err = WRDE_NOSPACE;
+          else
+            err = emit(we, sub.field.s, sub.field.len, quoted);
+        }
+      freestring(&sub);
+      break;
+    default:
+      err = WRDE_SYNTAX;
+      break;
+    }
+  free(name);
+  return err;
+}
+
+/* Expand the $ expression at *pp, leaving *pp after it. */
+static int
+dollar(struct wexp *we, const char **pp, const char *e, int quoted)
+{
+  const char *p = *pp + 1;
+  const char *q;
+  char num[24];
+  char *name;
+  const char *v;
+  size_t len;
+  int err;
+
+  if (p < e && *p == '(')
+    {
+      if (p + 1 < e && p[1] == '(' && (q = skipword(p + 2, e, ')'))
+          && q + 1 < e && q[1] == ')')
+        {
+          *pp = q + 2;
+          return arith(we, p + 2, q, quoted);
+        }
+      return (we->flags & WRDE_NOCMD) ? WRDE_CMDSUB : WRDE_SHELL;
+    }
+  if (p < e && *p == '{')
+    {
+      if (!(q = skipword(p + 1, e, '}')))
+        return WRDE_SYNTAX;
+      *pp = q + 1;
+      return brace(we, p + 1, q, quoted);
+    }
+  if ((len = namelen(p, e)) == 0)
+    {
+      *pp = p;
+      return addchar(we, '$', quoted);
+    }
+  if (!(name = (char *)malloc(len + 1)))
+    return WRDE_NOSPACE;
+  memcpy(name, p, len);
+  name[len] = '\0';
+  *pp = p + len;
+  if ((v = getparam(name, num)))
+    err = emit(we, v, strlen(v), quoted);
+  else if (we->flags & WRDE_UNDEF)
+    err = showerr(we, name, "unbound variable", WRDE_BADVAL);
+  else
+    err = WRDE_SUCCESS;
+  free(name);
+  return err;
+}
+
+/* Expand ~ or ~user at *pp, leaving *pp after it.  A prefix with
+   quotes or expansions in it is left alone. */
+static int
+tilde(struct wexp *we, const char **pp, const char *e)
+{
+  const char *p = *pp + 1;
+  const char *q;
+  const char *home = NULL;
+  struct passwd *pw;
+  char *name;
+
+  *pp = p;
+  for (q = p; q < e && *q != '/' && *q != ' ' && *q != '\t'; q++)
+    if (strchr("\\'\"$`", *q))
+      return addchar(we, '~', 0);
+  if (q == p)
+    {
+      if (!(home = getenv("HOME")) && (pw = getpwuid(getuid())))
+        home = pw->pw_dir;
+    }
+  else
+    {
+      if (!(name = (char *)malloc(q - p + 1)))
+        return WRDE_NOSPACE;
+      memcpy(name, p, q - p);
+      name[q - p] = '\0';
+      if ((pw = getpwnam(name)))
+        home = pw->pw_dir;
+      free(name);
+    }
+  if (!home)
+    return addchar(we, '~', 0);
+  *pp = q;
+  we->infield = 1;
+  return emit(we, home, strlen(home), 1);
+}
+
+/* Expand the words from p to e.  If quoted they are within double
+   quotes.  Only the words given to wordexp are checked for characters
+   that are special to the shell. */
+static int
+scan(struct wexp *we, const char *p, const char *e, int quoted, int top)
+{
+  const char *begin = p;
+  const char *q;
+  int inq = 0;
+  int err = WRDE_SUCCESS;
+
+  while (err == WRDE_SUCCESS && p < e)
+    {
+      if (quoted || inq)
+        switch (*p)
+          {
+          case '"':
+            inq = !inq;
+            p++;
+            continue;
+          case '\\':
+            if (p + 1 < e && strchr("$`\"\\\n", p[1]))
+              {
+                if (p[1] != '\n')
+                  err = addchar(we, p[1], 1);
+                p += 2;
+                continue;
+              }
+            err = addchar(we, *p++, 1);
+            continue;
+          case '$':
+            err = dollar(we, &p, e, 1);
+            continue;
+          case '`':
+            return (we->flags & WRDE_NOCMD) ? WRDE_CMDSUB : WRDE_SHELL;
+          default:
+            err = addchar(we, *p++, 1);
+            continue;
+          }
+
+      switch (*p)
+        {
+        case ' ':
+        case '\t':
+          err = we->string ? addchar(we, *p, 0) : endfield(we);
+          p++;
+          break;
+        case '"':
+          inq = 1;
+          we->infield = 1;
+          p++;
+          break;
+        case '\'':
+          if (!(q = memchr(p + 1, '\'', e - p - 1)))
+            return WRDE_SYNTAX;
+          we->infield = 1;
+          for (p++; err == WRDE_SUCCESS && p < q; p++)
+            err = addchar(we, *p, 1);
+          p++;
+          break;
+        case '\\':
+          if (p + 1 == e)
+            err = addchar(we, *p++, 1);
+          else
+            {
+              if (p[1] != '\n')
+                err = addchar(we, p[1], 1);
+              p += 2;
+            }
+          break;
+        case '$':
+          err = dollar(we, &p, e, 0);
+          break;
+        case '`':
+          return (we->flags & WRDE_NOCMD) ? WRDE_CMDSUB : WRDE_SHELL;
+        case '~':
+          if (!we->infield && (p == begin || p[-1] == ' ' || p[-1] == '\t'))
+            err = tilde(we, &p, e);
+          else
+            err = addchar(we, *p++, 0);
+          break;
+        default:
+          if (top && strchr("|&;<>(){}\n", *p))
+            return WRDE_BADCHAR;
+          err = addchar(we, *p++, 0);
+          break;
+        }
+    }
+  if (err == WRDE_SUCCESS && inq)
+    err = WRDE_SYNTAX;
+  return err;
+}
+
+/* Expand words without the shell, appending them to pwordexp. */
+static int
+wordexp_native(const char *words, wordexp_t *pwordexp, int offs, int flags)
+{
+  struct wexp we;
+  ext_wordv_t *wordv = NULL;
+  struct ewords_entry *entry = NULL;
+  char *eword;
+  size_t i;
+  int err;
+
+  memset(&we, 0, sizeof(we));
+  we.flags = flags;
+  if (!(we.ifs = getenv("IFS")))
+    we.ifs = IFS_DEFAULT;
+
+  err = scan(&we, words, words + strlen(words), 0, 1);
+  if (err == WRDE_SUCCESS)
+    err = endfield(&we);
+  if (err != WRDE_SUCCESS)
+    goto cleanup;
+
+  err = WRDE_NOSPACE;
+  if (we.words.len)
+    {
+      if (!(entry = (struct ewords_entry *)malloc(sizeof(struct ewords_entry) + we.words.len)))
+        goto cleanup;
+      memcpy(entry->ewords, we.words.s, we.words.len);
+    }
+
+  if (pwordexp->we_wordv)
+    wordv = WE_WORDV_TO_EXT_WORDV(pwordexp->we_wordv);
+  wordv = (ext_wordv_t *)realloc(wordv, sizeof(ext_wordv_t) + (offs + pwordexp->we_wordc + we.nwords) * sizeof(char *));
+  if (!wordv)
+    {
+      free(entry);
+      goto cleanup;
+    }
+  if (!pwordexp->we_wordv)
+    SLIST_INIT(&wordv->list);
+  pwordexp->we_wordv = wordv->we_wordv;
+
+  if (entry)
+    SLIST_INSERT_HEAD(&wordv->list, entry, next);
+
+  /* Store each entry in pwordexp's we_wordv vector. */
+  eword = entry ? entry->ewords : NULL;
+  for (i = 0; i < we.nwords; i++, eword += strlen(eword) + 1)
+    pwordexp->we_wordv[offs + pwordexp->we_wordc + i] = eword;
+  pwordexp->we_wordv[offs + pwordexp->we_wordc + i] = NULL;
+  pwordexp->we_wordc += we.nwords;
+  err = WRDE_SUCCESS;
+
+cleanup:
+  free(we.words.s);
+  free(we.field.s);
+  free(we.pat.s);
+  return err;
+}
+
+/* Expand words by running them through bash.  This requires a version
+   of bash that supports the --wordexp and --protected arguments. */
+static int
+wordexp_shell(const char *words, wordexp_t *pwordexp, int offs, int flags)
 {
   FILE *f = NULL;
   FILE *f_err = NULL;
   char tmp[MAXLINELEN];
   int i = 0;
-  int offs = 0;
   char *iter;
   pid_t pid;
   int num_words = 0;
@@ -47,37 +857,6 @@ wordexp(const char *__restrict words, wordexp_t *__restrict pwordexp, int flags)
   char *eword;
   struct ewords_entry *entry;
 
-  if (pwordexp == NULL)
-    {
-      return WRDE_NOSPACE;
-    }
-
-  if (flags & WRDE_REUSE)
-    wordfree(pwordexp);
-
-  if ((flags & WRDE_APPEND) == 0)
-    {
-      pwordexp->we_wordc = 0;
-      pwordexp->we_wordv = NULL;
-    }
-
-  if (flags & WRDE_DOOFFS)
-    {
-      offs = pwordexp->we_offs;
-
-      if (pwordexp->we_wordv)
-        wordv = WE_WORDV_TO_EXT_WORDV(pwordexp->we_wordv);
-      wordv = (ext_wordv_t *)realloc(wordv, sizeof(ext_wordv_t) + (offs + pwordexp->we_wordc) * sizeof(char *));
-      if (!wordv)
-        return err;
-      if (!pwordexp->we_wordv)
-        SLIST_INIT(&wordv->list);
-      pwordexp->we_wordv = wordv->we_wordv;
-
-      for (i = 0; i < offs; i++)
-        pwordexp->we_wordv[i] = NULL;
-    }
-
   if (pipe(fd))
     return err;
   if (pipe(fd_err))
@@ -240,4 +1019,51 @@ cleanup:
     }
   return WRDE_SUCCESS;
 }
+
+/* Words are expanded in-process.  Only command substitution, when it
+   is allowed, is left to the shell; see wordexp_shell. */
+int
+wordexp(const char *__restrict words, wordexp_t *__restrict pwordexp, int flags)
+{
+  int i = 0;
+  int offs = 0;
+  int err = WRDE_NOSPACE;
+  ext_wordv_t *wordv = NULL;
+
+  if (pwordexp == NULL)
+    {
+      return WRDE_NOSPACE;
+    }
+
+  if (flags & WRDE_REUSE)
+    wordfree(pwordexp);
+
+  if ((flags & WRDE_APPEND) == 0)
+    {
+      pwordexp->we_wordc = 0;
+      pwordexp->we_wordv = NULL;
+    }
+
+  if (flags & WRDE_DOOFFS)
+    {
+      offs = pwordexp->we_offs;
+
+      if (pwordexp->we_wordv)
+        wordv = WE_WORDV_TO_EXT_WORDV(pwordexp->we_wordv);
+      wordv = (ext_wordv_t *)realloc(wordv, sizeof(ext_wordv_t) + (offs + pwordexp->we_wordc) * sizeof(char *));
+      if (!wordv)
+        return err;
+      if (!pwordexp->we_wordv)
+        SLIST_INIT(&wordv->list);
+      pwordexp->we_wordv = wordv->we_wordv;
+
+      for (i = 0; i < offs; i++)
+        pwordexp->we_wordv[i] = NULL;
+    }
+
+  err = wordexp_native(words, pwordexp, offs, flags);
+  if (err == WRDE_SHELL)
+    err = wordexp_shell(words, pwordexp, offs, flags);
+  return err;
+}
 #endif /* !_NO_WORDEXP  */
@@ -79,6 +79,9 @@ DESCRIPTION
 
 #ifndef NO_FORK
 
+/* Defined by arc4random.c, whose generators rekey when it changes.  */
+extern int __arc4random_forkgen __attribute__((weak));
+
 int
 _fork_r (struct _reent *ptr)
 {
@@ -87,6 +90,8 @@ _fork_r (struct _reent *ptr)
   errno = 0;
   if ((ret = _fork ()) == -1 && errno != 0)
     ptr->_errno = errno;
+  else if (ret == 0 && &__arc4random_forkgen)
+    __arc4random_forkgen++;
   return ret;
 }
 
@@ -27,6 +27,19 @@ int errno;
 
 #endif
 
+#ifndef _REENT_SMALL
+/* Members added to _new._reent must fit in the space that _unused keeps
+   for them, or the layout of struct _reent changes.  */
+typedef char __reent_new_fits[sizeof (((struct _reent *) 0)->_new._reent)
+			      <= sizeof (((struct _reent *) 0)->_new._unused)
+			      ? 1 : -1];
+#endif
+
+/* Defined by mallocr.c, which also sets _REENT_MALLOC_TCACHE.  */
+extern void __malloc_tcache_reclaim (struct _reent *) __attribute__((weak));
+/* Defined by arc4random.c, which also sets _REENT_ARC4RANDOM.  */
+extern void __arc4random_reclaim (struct _reent *) __attribute__((weak));
+
 /* Interim cleanup code */
 
 void
@@ -128,6 +141,14 @@ _reclaim_reent (struct _reent *ptr)
 	    cleanup_glue (ptr, ptr->__sglue._next);
 	}
 
+      /* The thread's arc4random key must not outlive it.  */
+      if (_REENT_ARC4RANDOM (ptr) && __arc4random_reclaim)
+	__arc4random_reclaim (ptr);
+
+      /* Small chunks this thread freed and malloc kept for it.  */
+      if (_REENT_MALLOC_TCACHE (ptr) && __malloc_tcache_reclaim)
+	__malloc_tcache_reclaim (ptr);
+
       /* Malloc memory not reclaimed; no good way to return memory anyway. */
 
     }
@@ -49,40 +49,148 @@ __RCSID("$NetBSD: hcreate.c,v 1.2 2001/02/19 21:26:04 ross Exp $");
 #endif
 
 #include <sys/types.h>
-#include <sys/queue.h>
 #include <errno.h>
 #include <search.h>
 #include <stdlib.h>
 #include <string.h>
 
 /*
- * DO NOT MAKE THIS STRUCTURE LARGER THAN 32 BYTES (4 ptrs on 64-bit
- * ptr machine) without adjusting MAX_BUCKETS_LG2 below.
+ * The table is open addressed with linear probing, kept in Robin Hood
+ * order: an entry being inserted takes the slot of any entry that is
+ * closer to its home slot, so that a search can stop at the first
+ * entry closer to home than itself.  Each slot holds the hash of its
+ * entry, so that probing reads no keys but the ones that are likely to
+ * match.  The table doubles in size once it is three quarters full.
+ *
+ * The ENTRYs themselves live in blocks which never move, so that the
+ * pointers hsearch_r returns stay valid however much the table grows.
+ * Each block holds as many entries as all the blocks before it.
  */
-struct internal_entry {
-	SLIST_ENTRY(internal_entry) link;
-	ENTRY ent;
+struct internal_slot {
+	__uint32_t hash;
+	ENTRY *ent;			/* NULL if the slot is empty */
+};
+
+struct entry_block {
+	struct entry_block *next;
+	ENTRY ent[1];
+};
+
+struct internal_head {
+	struct internal_slot *slots;	/* htablesize of them */
+	size_t count;			/* entries in the table */
+	struct entry_block *blocks;	/* newest first */
+	ENTRY *next_ent, *end_ent;	/* unused part of the newest block */
 };
-SLIST_HEAD(internal_head, internal_entry);
 
 #define	MIN_BUCKETS_LG2	4
 #define	MIN_BUCKETS	(1 << MIN_BUCKETS_LG2)
 
 /*
- * max * sizeof internal_entry must fit into size_t.
- * assumes internal_entry is <= 32 (2^5) bytes.
+ * max * sizeof internal_slot must fit into size_t.
+ * assumes internal_slot is <= 16 (2^4) bytes.
  */
-#define	MAX_BUCKETS_LG2	(sizeof (size_t) * 8 - 1 - 5)
+#define	MAX_BUCKETS_LG2	(sizeof (size_t) * 8 - 1 - 4)
 #define	MAX_BUCKETS	((size_t)1 << MAX_BUCKETS_LG2)
 
+/* Distance of slot i holding hash from its home slot */
+#define	DISTANCE(i, hash, mask)	(((i) - (hash)) & (mask))
+
 /* Default hash function, from db/hash/hash_func.c */
 extern __uint32_t (*__default_hash)(const void *, size_t);
 
+/*
+ * The default hash gives keys differing only in their last character
+ * consecutive values, which linear probing would pile up into long
+ * runs.  Mix all the bits into the low ones (the MurmurHash3 finalizer).
+ */
+static inline __uint32_t
+mix(__uint32_t h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+
+static void
+insert_slot(struct internal_slot *slots, size_t mask, __uint32_t hash,
+    ENTRY *ent)
+{
+	struct internal_slot *s;
+	size_t i, dist, d;
+	__uint32_t th;
+	ENTRY *te;
+
+	for (i = hash & mask, dist = 0; ; i = (i + 1) & mask, dist++) {
+		s = &slots[i];
+		if (s->ent == NULL) {
+			s->hash = hash;
+			s->ent = ent;
+			return;
+		}
+		d = DISTANCE(i, s->hash, mask);
+		if (d < dist) {
+			/* Take the slot, and move its entry further on */
+			th = s->hash;
+			te = s->ent;
+			s->hash = hash;
+			s->ent = ent;
+			hash = th;
+			ent = te;
+			dist = d;
+		}
+	}
+}
+
+static int
+grow(struct hsearch_data *htab)
+{
+	struct internal_head *head = htab->htable;
+	struct internal_slot *slots;
+	size_t idx, size = htab->htablesize * 2;
+
+	if (size > MAX_BUCKETS)
+		return 0;
+	slots = calloc(size, sizeof slots[0]);
+	if (slots == NULL)
+		return 0;
+	for (idx = 0; idx < htab->htablesize; idx++)
+		if (head->slots[idx].ent != NULL)
+			insert_slot(slots, size - 1, head->slots[idx].hash,
+			    head->slots[idx].ent);
+	free(head->slots);
+	head->slots = slots;
+	htab->htablesize = size;
+	return 1;
+}
+
+static ENTRY *
+new_entry(struct internal_head *head)
+{
+	struct entry_block *b;
+	size_t n;
+
+	if (head->next_ent == head->end_ent) {
+		n = head->count < MIN_BUCKETS ? MIN_BUCKETS : head->count;
+		b = malloc(sizeof *b + (n - 1) * sizeof b->ent[0]);
+		if (b == NULL)
+			return NULL;
+		b->next = head->blocks;
+		head->blocks = b;
+		head->next_ent = b->ent;
+		head->end_ent = b->ent + n;
+	}
+	return head->next_ent++;
+}
+
 int
 hcreate_r(size_t nel, struct hsearch_data *htab)
 {
-	size_t idx;
-	unsigned int p2;
+	struct internal_head *head;
+	size_t size;
 
 	/* Make sure this this isn't called when a table already exists. */
 	if (htab->htable != NULL) {
@@ -90,32 +198,29 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 		return 0;
 	}
 
-	/* If nel is too small, make it min sized. */
-	if (nel < MIN_BUCKETS)
-		nel = MIN_BUCKETS;
-
-	/* If it's too large, cap it. */
-	if (nel > MAX_BUCKETS)
-		nel = MAX_BUCKETS;
+	/* Leave room for nel entries without growing, up to the cap. */
+	if (nel > MAX_BUCKETS / 4 * 3)
+		nel = MAX_BUCKETS / 4 * 3;
+	for (size = MIN_BUCKETS; size / 4 * 3 < nel; size *= 2)
+		continue;
 
-	/* If it's is not a power of two in size, round up. */
-	if ((nel & (nel - 1)) != 0) {
-		for (p2 = 0; nel != 0; p2++)
-			nel >>= 1;
-		nel = 1 << p2;
-	}
-	
 	/* Allocate the table. */
-	htab->htablesize = nel;
-	htab->htable = malloc(htab->htablesize * sizeof htab->htable[0]);
-	if (htab->htable == NULL) {
+	head = malloc(sizeof *head);
+	if (head == NULL) {
 		errno = ENOMEM;
 		return 0;
 	}
-
-	/* Initialize it. */
-	for (idx = 0; idx < htab->htablesize; idx++)
-		SLIST_INIT(&(htab->htable[idx]));
+	head->slots = calloc(size, sizeof head->slots[0]);
+	if (head->slots == NULL) {
+		free(head);
+		errno = ENOMEM;
+		return 0;
+	}
+	head->count = 0;
+	head->blocks = NULL;
+	head->next_ent = head->end_ent = NULL;
+	htab->htable = head;
+	htab->htablesize = size;
 
 	return 1;
 }
@@ -123,67 +228,71 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 void
 hdestroy_r(struct hsearch_data *htab)
 {
-#if 0
-	struct internal_entry *ie;
-	size_t idx;
-#endif
-	if (htab->htable == NULL)
+	struct internal_head *head = htab->htable;
+	struct entry_block *b;
+
+	if (head == NULL)
 		return;
 
-#if 0
-	for (idx = 0; idx < htab->htablesize; idx++) {
-		while (!SLIST_EMPTY(&(htab->htable[idx]))) {
-			ie = SLIST_FIRST(&(htab->htable[idx]));
-			SLIST_REMOVE_HEAD(&(htab->htable[idx]), link);
-                        free(ie->ent.key);
-			free(ie);
-		}
+	/* The keys belong to the caller, as in the SysV implementation. */
+	while ((b = head->blocks) != NULL) {
+		head->blocks = b->next;
+		free(b);
 	}
-#endif
-	free(htab->htable);
+	free(head->slots);
+	free(head);
 	htab->htable = NULL;
 }
 
 int
 hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 {
-	struct internal_head *head;
-	struct internal_entry *ie;
+	struct internal_head *head = htab->htable;
+	struct internal_slot *s;
+	ENTRY *ent;
 	__uint32_t hashval;
-	size_t len;
+	size_t len, i, dist, mask;
 
 	len = strlen(item.key);
-	hashval = (*__default_hash)(item.key, len);
-
-        head = &(htab->htable[hashval & (htab->htablesize - 1)]);
-	ie = SLIST_FIRST(head);
-	while (ie != NULL) {
-		if (strcmp(ie->ent.key, item.key) == 0)
-			break;
-		ie = SLIST_NEXT(ie, link);
-	}
+	hashval = mix((*__default_hash)(item.key, len));
 
-	if (ie != NULL)
+	mask = htab->htablesize - 1;
+	for (i = hashval & mask, dist = 0; ; i = (i + 1) & mask, dist++) {
+		s = &head->slots[i];
+		if (s->ent == NULL || DISTANCE(i, s->hash, mask) < dist)
+			break;			/* it would be here by now */
+		if (s->hash == hashval && strcmp(s->ent->key, item.key) == 0)
           {
-            *retval = &ie->ent;
+            *retval = s->ent;
             return 1;
           }
-	else if (action == FIND)
+	}
+
+	if (action == FIND)
           {
             *retval = NULL;
             return 0;
           }
 
-	ie = malloc(sizeof *ie);
-	if (ie == NULL)
+	/* Grow if needed, or failing that keep one slot empty. */
+	if (head->count + 1 > htab->htablesize / 4 * 3
+	    && !grow(htab) && head->count + 1 >= htab->htablesize)
+          {
+            errno = ENOMEM;
+            *retval = NULL;
+            return 0;
+          }
+	ent = new_entry(head);
+	if (ent == NULL)
           {
             *retval = NULL;
             return 0;
           }
-	ie->ent.key = item.key;
-	ie->ent.data = item.data;
+	ent->key = item.key;
+	ent->data = item.data;
 
-	SLIST_INSERT_HEAD(head, ie, link);
-        *retval = &ie->ent;
+	insert_slot(head->slots, htab->htablesize - 1, hashval, ent);
+	head->count++;
+        *retval = ent;
 	return 1;
 }
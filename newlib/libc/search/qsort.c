@@ -65,6 +65,7 @@ PORTABILITY
 #include <_ansi.h>
 #include <sys/cdefs.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #ifndef __GNUC__
 #define inline
@@ -77,14 +78,52 @@ typedef int		 cmp_t(const void *, const void *, void *);
 #else
 typedef int		 cmp_t(const void *, const void *);
 #endif
-static inline char	*med3 (char *, char *, char *, cmp_t *, void *);
-static inline void	 swapfunc (char *, char *, int, int);
 
-#define min(a, b)	(a) < (b) ? a : b
+/*
+ * Pattern-defeating quicksort, after Orson Peters' pdqsort: quicksort
+ * with a median of 3 (or, for large arrays, a ninther) pivot, insertion
+ * sort for short arrays, and
+ *
+ *  - a heapsort fallback once too many partitions have been badly
+ *    unbalanced, so that the worst case is O(n log n);
+ *  - a few swaps after each badly unbalanced partition, which break up
+ *    the patterns that make the pivot choice fail;
+ *  - a partial insertion sort of both parts when partitioning moved
+ *    nothing, so that sorted and nearly sorted arrays take O(n);
+ *  - putting all elements equal to the pivot on the left when the pivot
+ *    equals the element just before the array, which is the pivot of an
+ *    earlier partition, so that many duplicates take O(n log k) for k
+ *    distinct values.
+ *
+ * Every scan is bounded by the ends of the array, so that a comparison
+ * function which is not a consistent ordering leaves the array
+ * unsorted but never makes the sort go outside it.
+ */
+#define INSERTION_SORT_THRESHOLD	12
+#define NINTHER_THRESHOLD		128
+#define PARTIAL_INSERTION_SORT_LIMIT	8
 
 /*
- * Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ * Elements of 4, 8 and 16 bytes, and elements made of longs, are
+ * swapped and moved as such when the array is suitably aligned.
  */
+#define SWAP_INT32	0
+#define SWAP_INT64	1
+#define SWAP_INT128	2
+#define SWAP_LONGS	3
+#define SWAP_BYTES	4
+
+typedef struct { uint64_t w[2]; } int128_elem;
+
+#define ALIGNED(a, es, type) \
+	(((char *)a - (char *)0) % sizeof(type) == 0 && es % sizeof(type) == 0)
+
+#define SWAPINIT(a, es) swaptype = \
+	es == 4 && ALIGNED(a, es, uint32_t) ? SWAP_INT32 : \
+	es == 8 && ALIGNED(a, es, uint64_t) ? SWAP_INT64 : \
+	es == 16 && ALIGNED(a, es, uint64_t) ? SWAP_INT128 : \
+	ALIGNED(a, es, long) ? SWAP_LONGS : SWAP_BYTES;
+
 #define swapcode(TYPE, parmi, parmj, n) { 		\
 	long i = (n) / sizeof (TYPE); 			\
 	TYPE *pi = (TYPE *) (parmi); 		\
@@ -96,30 +135,32 @@ static inline void	 swapfunc (char *, char *, int, int);
         } while (--i > 0);				\
 }
 
-#define SWAPINIT(a, es) swaptype = ((char *)a - (char *)0) % sizeof(long) || \
-	es % sizeof(long) ? 2 : es == sizeof(long)? 0 : 1;
-
 static inline void
 swapfunc (char *a,
 	char *b,
-	int n,
+	size_t n,
 	int swaptype)
 {
-	if(swaptype <= 1)
+	switch (swaptype) {
+	case SWAP_INT32:
+		swapcode(uint32_t, a, b, 4)
+		break;
+	case SWAP_INT64:
+		swapcode(uint64_t, a, b, 8)
+		break;
+	case SWAP_INT128:
+		swapcode(int128_elem, a, b, 16)
+		break;
+	case SWAP_LONGS:
 		swapcode(long, a, b, n)
-	else
+		break;
+	default:
 		swapcode(char, a, b, n)
+		break;
+	}
 }
 
-#define swap(a, b)					\
-	if (swaptype == 0) {				\
-		long t = *(long *)(a);			\
-		*(long *)(a) = *(long *)(b);		\
-		*(long *)(b) = t;			\
-	} else						\
-		swapfunc(a, b, es, swaptype)
-
-#define vecswap(a, b, n) 	if ((n) > 0) swapfunc(a, b, n, swaptype)
+#define swap(a, b)	swapfunc(a, b, es, swaptype)
 
 #if defined(I_AM_QSORT_R)
 #define	CMP(t, x, y) (cmp((t), (x), (y)))
@@ -129,20 +170,260 @@ swapfunc (char *a,
 #define	CMP(t, x, y) (cmp((x), (y)))
 #endif
 
-static inline char *
-med3 (char *a,
+#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
+#define THUNK_UNUSED __unused
+#else
+#define THUNK_UNUSED
+#endif
+
+/*
+ * Insert each element in turn into the sorted run before it, moving
+ * the elements it passes up by one.  Its place is found while it is
+ * still in the array, as cmp may only be given pointers into the
+ * array.  Give up, returning 0, once more than limit elements have
+ * been moved.
+ */
+#define insertcode(TYPE, a, n, limit) {				\
+	TYPE *pi, *pj, *pk, t;					\
+	for (pi = (TYPE *) (a) + 1; pi < (TYPE *) (a) + (n); pi++) { \
+		if (CMP(thunk, pi, pi - 1) >= 0)		\
+			continue;				\
+		pj = pi - 1;					\
+		while (pj > (TYPE *) (a) && CMP(thunk, pi, pj - 1) < 0) \
+			pj--;					\
+		t = *pi;					\
+		for (pk = pi; pk > pj; pk--)			\
+			*pk = pk[-1];				\
+		*pj = t;					\
+		moves += pi - pj;				\
+		if (moves > (limit))				\
+			return 0;				\
+	}							\
+}
+
+static int
+insertion_sort (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	size_t limit,
+	cmp_t *cmp,
+	void *thunk THUNK_UNUSED)
+{
+	char *pl, *pm;
+	size_t moves = 0;
+
+	switch (swaptype) {
+	case SWAP_INT32:
+		insertcode(uint32_t, a, n, limit)
+		break;
+	case SWAP_INT64:
+		insertcode(uint64_t, a, n, limit)
+		break;
+	case SWAP_INT128:
+		insertcode(int128_elem, a, n, limit)
+		break;
+	default:
+		for (pm = a + es; pm < a + n * es; pm += es) {
+			for (pl = pm; pl > a && CMP(thunk, pl - es, pl) > 0;
+			     pl -= es)
+				swap(pl, pl - es);
+			moves += (pm - pl) / es;
+			if (moves > limit)
+				return 0;
+		}
+		break;
+	}
+	return 1;
+}
+
+static void
+sift_down (char *a,
+	size_t i,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk THUNK_UNUSED)
+{
+	size_t c;
+
+	while ((c = 2 * i + 1) < n) {
+		if (c + 1 < n && CMP(thunk, a + c * es, a + (c + 1) * es) < 0)
+			c++;
+		if (CMP(thunk, a + i * es, a + c * es) >= 0)
+			break;
+		swap(a + i * es, a + c * es);
+		i = c;
+	}
+}
+
+static void
+heap_sort (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk)
+{
+	size_t i;
+
+	for (i = n / 2; i > 0; i--)
+		sift_down(a, i - 1, n, es, swaptype, cmp, thunk);
+	for (i = n - 1; i > 0; i--) {
+		swap(a, a + i * es);
+		sift_down(a, 0, i, es, swaptype, cmp, thunk);
+	}
+}
+
+/* Order the elements at a, b and c.  */
+static inline void
+sort3 (char *a,
 	char *b,
 	char *c,
+	size_t es,
+	int swaptype,
 	cmp_t *cmp,
-	void *thunk
-#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
-__unused
-#endif
-)
+	void *thunk THUNK_UNUSED)
+{
+	if (CMP(thunk, b, a) < 0)
+		swap(a, b);
+	if (CMP(thunk, c, b) < 0) {
+		swap(b, c);
+		if (CMP(thunk, b, a) < 0)
+			swap(a, b);
+	}
+}
+
+/*
+ * Move the pivot, the median of 3 or the ninther, to the start of the
+ * array.  Either way there is an element >= the pivot in the last 3.
+ */
+static void
+choose_pivot (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk)
+{
+	char *pm = a + (n / 2) * es;
+	char *pn = a + (n - 1) * es;
+
+	if (n > NINTHER_THRESHOLD) {
+		sort3(a, pm, pn, es, swaptype, cmp, thunk);
+		sort3(a + es, pm - es, pn - es, es, swaptype, cmp, thunk);
+		sort3(a + 2 * es, pm + es, pn - 2 * es, es, swaptype, cmp,
+		      thunk);
+		sort3(pm - es, pm, pm + es, es, swaptype, cmp, thunk);
+		swap(a, pm);
+	}
+	else
+		sort3(pm, a, pn, es, swaptype, cmp, thunk);
+}
+
+/*
+ * Partition the array around the pivot at its start:
+ * { elements < pivot, pivot, elements >= pivot }
+ * Return the new position of the pivot, and set *already_partitioned
+ * if no element had to be moved.
+ */
+static char *
+partition_right (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	int *already_partitioned,
+	cmp_t *cmp,
+	void *thunk THUNK_UNUSED)
 {
-	return CMP(thunk, a, b) < 0 ?
-	       (CMP(thunk, b, c) < 0 ? b : (CMP(thunk, a, c) < 0 ? c : a ))
-              :(CMP(thunk, b, c) > 0 ? b : (CMP(thunk, a, c) < 0 ? a : c ));
+	char *pn = a + n * es;
+	char *first = a + es;
+	char *last = pn;
+
+	while (first < pn && CMP(thunk, first, a) < 0)
+		first += es;
+	do
+		last -= es;
+	while (last > first && CMP(thunk, last, a) >= 0);
+
+	*already_partitioned = first >= last;
+	while (first < last) {
+		swap(first, last);
+		do
+			first += es;
+		while (first < pn && CMP(thunk, first, a) < 0);
+		do
+			last -= es;
+		while (last > a && CMP(thunk, last, a) >= 0);
+	}
+
+	first -= es;
+	swap(a, first);
+	return first;
+}
+
+/*
+ * Partition the array around the pivot at its start:
+ * { elements <= pivot, pivot, elements > pivot }
+ * Return the new position of the pivot.
+ */
+static char *
+partition_left (char *a,
+	size_t n,
+	size_t es,
+	int swaptype,
+	cmp_t *cmp,
+	void *thunk THUNK_UNUSED)
+{
+	char *pn = a + n * es;
+	char *first = a;
+	char *last = pn;
+
+	do
+		last -= es;
+	while (last > a && CMP(thunk, a, last) < 0);
+	do
+		first += es;
+	while (first < last && CMP(thunk, a, first) >= 0);
+
+	while (first < last) {
+		swap(first, last);
+		do
+			last -= es;
+		while (last > a && CMP(thunk, a, last) < 0);
+		do
+			first += es;
+		while (first < pn && CMP(thunk, a, first) >= 0);
+	}
+
+	swap(a, last);
+	return last;
+}
+
+/*
+ * Swap a few elements of one side of an unbalanced partition with
+ * elements further in, so that the next pivot comes from elsewhere.
+ */
+static void
+break_patterns (char *a,
+	size_t n,
+	size_t es,
+	int swaptype)
+{
+	char *pn = a + n * es;
+	size_t q = n / 4;
+
+	if (n < INSERTION_SORT_THRESHOLD)
+		return;
+	swap(a, a + q * es);
+	swap(pn - es, pn - q * es);
+	if (n > NINTHER_THRESHOLD) {
+		swap(a + es, a + (q + 1) * es);
+		swap(a + 2 * es, a + (q + 2) * es);
+		swap(pn - 2 * es, pn - (q + 1) * es);
+		swap(pn - 3 * es, pn - (q + 2) * es);
+	}
 }
 
 /*
@@ -161,185 +442,155 @@ __unused
  */
 #define PARAMETER_STACK_LEVELS 8u
 
-#if defined(I_AM_QSORT_R)
-void
-__bsd_qsort_r (void *a,
-	size_t n,
-	size_t es,
-	void *thunk,
-	cmp_t *cmp)
-#elif defined(I_AM_GNU_QSORT_R)
-void
-qsort_r (void *a,
+/*
+ * Sort the n elements at a.  bad_allowed is the number of badly
+ * unbalanced partitions left before falling back to heapsort, and
+ * leftmost is zero if the element before a is the pivot of an earlier
+ * partition, <= every element of the array.
+ */
+static void
+pdqsort (char *a,
 	size_t n,
 	size_t es,
+	int swaptype,
+	int bad_allowed,
+	int leftmost,
 	cmp_t *cmp,
 	void *thunk)
-#else
-#define thunk NULL
-void
-qsort (void *a,
-	size_t n,
-	size_t es,
-	cmp_t *cmp)
-#endif
 {
-	char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
+	char *pm, *pa;
 	size_t d, r;
-	int cmp_result;
-	int swaptype, swap_cnt;
+	int already_partitioned;
 	size_t recursion_level = 0;
-	struct { void *a; size_t n; } parameter_stack[PARAMETER_STACK_LEVELS];
+	struct {
+		char *a;
+		size_t n;
+		int bad_allowed;
+		int leftmost;
+	} parameter_stack[PARAMETER_STACK_LEVELS];
 
-	SWAPINIT(a, es);
-loop:	swap_cnt = 0;
-	if (n < 7) {
-		/* Short arrays are insertion sorted. */
-		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
-			for (pl = pm; pl > (char *) a && CMP(thunk, pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
+loop:
+	if (n < INSERTION_SORT_THRESHOLD) {
+		insertion_sort(a, n, es, swaptype, (size_t) -1, cmp, thunk);
 		goto pop;
 	}
 
-	/* Select a pivot element, move it to the left. */
-	pm = (char *) a + (n / 2) * es;
-	if (n > 7) {
-		pl = a;
-		pn = (char *) a + (n - 1) * es;
-		if (n > 40) {
-			d = (n / 8) * es;
-			pl = med3(pl, pl + d, pl + 2 * d, cmp, thunk);
-			pm = med3(pm - d, pm, pm + d, cmp, thunk);
-			pn = med3(pn - 2 * d, pn - d, pn, cmp, thunk);
-		}
-		pm = med3(pl, pm, pn, cmp, thunk);
-	}
-	swap(a, pm);
+	choose_pivot(a, n, es, swaptype, cmp, thunk);
 
 	/*
-	 * Sort the array relative the pivot in four ranges as follows:
-	 * { elems == pivot, elems < pivot, elems > pivot, elems == pivot }
+	 * If the pivot equals the pivot of an earlier partition, there is
+	 * no element less than it: take out everything equal to it.
 	 */
-	pa = pb = (char *) a + es;
-	pc = pd = (char *) a + (n - 1) * es;
-	for (;;) {
-		/* Scan left to right stopping at first element > pivot. */
-		while (pb <= pc && (cmp_result = CMP(thunk, pb, a)) <= 0) {
-			/* Move elements == pivot to the left (to pa) */
-			if (cmp_result == 0) {
-				swap_cnt = 1;
-				swap(pa, pb);
-				pa += es;
-			}
-			pb += es;
-		}
-		/* Scan right to left stopping at first element < pivot. */
-		while (pb <= pc && (cmp_result = CMP(thunk, pc, a)) >= 0) {
-			/* Move elements == pivot to the right (to pd) */
-			if (cmp_result == 0) {
-				swap_cnt = 1;
-				swap(pc, pd);
-				pd -= es;
-			}
-			pc -= es;
+	if (!leftmost && CMP(thunk, a - es, a) >= 0) {
+		pm = partition_left(a, n, es, swaptype, cmp, thunk) + es;
+		n -= (pm - a) / es;
+		a = pm;
+		goto loop;
+	}
+
+	pm = partition_right(a, n, es, swaptype, &already_partitioned,
+			     cmp, thunk);
+	d = (pm - a) / es;	/* d = Size of left part. */
+	r = n - d - 1;		/* r = Size of right part. */
+
+	if (d < n / 8 || r < n / 8) {
+		if (--bad_allowed == 0) {
+			heap_sort(a, n, es, swaptype, cmp, thunk);
+			goto pop;
 		}
-		if (pb > pc)
-			break;
-		/* The scan has found two elements to swap with each other. */
-		swap(pb, pc);
-		swap_cnt = 1;
-		pb += es;
-		pc -= es;
+		break_patterns(a, d, es, swaptype);
+		break_patterns(pm + es, r, es, swaptype);
 	}
-	if (swap_cnt == 0) {  /* Switch to insertion sort */
-		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
-			for (pl = pm; pl > (char *) a && CMP(thunk, pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
+	else if (already_partitioned
+		 && insertion_sort(a, d, es, swaptype,
+				   PARTIAL_INSERTION_SORT_LIMIT, cmp, thunk)
+		 && insertion_sort(pm + es, r, es, swaptype,
+				   PARTIAL_INSERTION_SORT_LIMIT, cmp, thunk))
 		goto pop;
-	}
-
-	/*
-	 * Rearrange the array in three parts sorted like this:
-	 * { elements < pivot, elements == pivot, elements > pivot }
-	 */
-	pn = (char *) a + n * es;
-	r = min(pa - (char *)a, pb - pa);
-	vecswap(a, pb - r, r);
-	r = min(pd - pc, pn - pd - es);
-	vecswap(pb, pn - r, r);
-	d = pb - pa; /* d = Size of left part. */
-	r = pd - pc; /* r = Size of right part. */
-	pn -= r;     /* pn = Base of right part. */
 
 	/*
-	 * Check which of the left and right parts are larger.
-	 * Set (a, n)  to (base, size) of the larger part.
-	 * Set (pa, r) to (base, size) of the smaller part.
+	 * Sort the smaller part first, leaving the larger part for later,
+	 * which bounds the recursion depth by log2(n).
+	 * Set (a, n)  to (base, size) of the smaller part.
+	 * Set (pa, r) to (base, size) of the larger part.
 	 */
 	if (r > d) { /* Right part is the larger part */
+		pa = pm + es;
+		n = d;
+	}
+	else { /* Left part is the larger part, or both are equal. */
 		pa = a;
-		a = pn;
+		a = pm + es;
 		n = r;
 		r = d;
 	}
-	else { /* Left part is the larger part, or both are equal. */
-		pa = pn;
-		n = d;
-	}
 
-	/*
-	 * The left and right parts each need further sorting if they
-	 * contain two elements or more. If both need sorting we use
-	 * recursion to sort the smaller part and save the larger part
-	 * to be sorted by iteration after the recursion.
-	 * Using recursion only for the smaller part guarantees a
-	 * recursion depth that is bounded to be less than (log2(n)).
-	 */
-	if (r > es) {  /* Smaller part > 1 element. Both parts need sorting. */
-		if (recursion_level < PARAMETER_STACK_LEVELS) {
-			/*
-			 * The smaller part needs to be recursively sorted
-			 * before the larger part is sorted. To avoid function
-			 * call recursion the parameters for the larger part
-			 * are pushed on the parameter_stack array. The smaller
-			 * part is sorted using iteration and the larger part
-			 * will be sorted when the parameter_stack is popped
-			 * after the smaller part has been sorted.
-			 */
-			parameter_stack[recursion_level].a = a;
-			parameter_stack[recursion_level].n = n / es;
-			recursion_level++;
-			a = pa;
-			n = r / es;
-			goto loop;
-		}
-		else {
-			/*
-			 * The parameter_stack array is full. The smaller part
-			 * is sorted using function call recursion. The larger
-			 * part will be sorted after the function call returns.
-			 */
-#if defined(I_AM_QSORT_R)
-			__bsd_qsort_r(pa, r / es, es, thunk, cmp);
-#elif defined(I_AM_GNU_QSORT_R)
-			qsort_r(pa, r / es, es, cmp, thunk);
-#else
-			qsort(pa, r / es, es, cmp);
-#endif
-		}
-	}
-	if (n > es) {  /* The larger part needs sorting. Iterate to sort.  */
-		n = n / es;
+	if (recursion_level < PARAMETER_STACK_LEVELS) {
+		/*
+		 * To avoid function call recursion the parameters for the
+		 * larger part are pushed on the parameter_stack array, and
+		 * popped after the smaller part has been sorted.
+		 */
+		parameter_stack[recursion_level].a = pa;
+		parameter_stack[recursion_level].n = r;
+		parameter_stack[recursion_level].bad_allowed = bad_allowed;
+		parameter_stack[recursion_level].leftmost =
+			leftmost && pa < a;
+		recursion_level++;
+		leftmost = leftmost && a < pa;
 		goto loop;
 	}
-	/* Both left and right parts are one element or less - level done. */
+	/*
+	 * The parameter_stack array is full. The smaller part is sorted
+	 * using function call recursion, and the larger part by iteration.
+	 */
+	pdqsort(a, n, es, swaptype, bad_allowed, leftmost && a < pa, cmp,
+		thunk);
+	leftmost = leftmost && pa < a;
+	a = pa;
+	n = r;
+	goto loop;
+
 pop:
 	if (recursion_level != 0) {
 		recursion_level--;
 		a = parameter_stack[recursion_level].a;
 		n = parameter_stack[recursion_level].n;
+		bad_allowed = parameter_stack[recursion_level].bad_allowed;
+		leftmost = parameter_stack[recursion_level].leftmost;
 		goto loop;
 	}
 }
+
+#if defined(I_AM_QSORT_R)
+void
+__bsd_qsort_r (void *a,
+	size_t n,
+	size_t es,
+	void *thunk,
+	cmp_t *cmp)
+#elif defined(I_AM_GNU_QSORT_R)
+void
+qsort_r (void *a,
+	size_t n,
+	size_t es,
+	cmp_t *cmp,
+	void *thunk)
+#else
+#define thunk NULL
+void
+qsort (void *a,
+	size_t n,
+	size_t es,
+	cmp_t *cmp)
+#endif
+{
+	int swaptype;
+	int bad_allowed = 0;
+	size_t m;
+
+	SWAPINIT(a, es);
+	for (m = n; m > 1; m >>= 1)
+		bad_allowed++;
+	pdqsort(a, n, es, swaptype, bad_allowed, 1, cmp, thunk);
+}
@@ -31,36 +31,53 @@ tdelete (const void *__restrict vkey,	/* key to be deleted */
 	int       (*compar)(const void *, const void *))
 {
 	node_t **rootp = (node_t **)vrootp;
-	node_t *p, *q, *r;
-	int  cmp;
+	node_t **path[TREE_MAX_HEIGHT + 1];	/* links followed from root */
+	node_t *p, *q, *r, *s;
+	int  cmp, i = 0, j;
 
 	if (rootp == NULL || (p = *rootp) == NULL)
 		return NULL;
 
 	while ((cmp = (*compar)(vkey, (*rootp)->key)) != 0) {
 		p = *rootp;
+		path[i++] = rootp;
 		rootp = (cmp < 0) ?
 		    &(*rootp)->llink :		/* follow llink branch */
 		    &(*rootp)->rlink;		/* follow rlink branch */
 		if (*rootp == NULL)
 			return NULL;		/* key not found */
 	}
-	r = (*rootp)->rlink;			/* D1: */
-	if ((q = (*rootp)->llink) == NULL)	/* Left NULL? */
-		q = r;
-	else if (r != NULL) {			/* Right link is NULL? */
-		if (r->llink == NULL) {		/* D2: Find successor */
-			r->llink = q;
-			q = r;
-		} else {			/* D3: Find NULL link */
-			for (q = r->llink; q->llink != NULL; q = r->llink)
-				r = q;
-			r->llink = q->rlink;
-			q->llink = (*rootp)->llink;
-			q->rlink = (*rootp)->rlink;
+	q = *rootp;
+	if (q->llink == NULL)			/* Left NULL? */
+		r = q->rlink;
+	else {
+		/*
+		 * Move the preceding node into its place, so that the links
+		 * to rebalance are all on one path and the nodes that stay
+		 * keep their keys.
+		 */
+		path[j = i++] = rootp;
+		rootp = &q->llink;
+		while ((*rootp)->rlink != NULL) {
+			path[i++] = rootp;
+			rootp = &(*rootp)->rlink;
+		}
+		s = *rootp;
+		r = s->llink;
+		*path[j] = s;
+		s->rlink = q->rlink;
+		s->height = q->height;
+		if (rootp == &q->llink)		/* q's own left child */
+			rootp = &s->llink;
+		else {
+			s->llink = q->llink;
+			path[j + 1] = &s->llink;
 		}
 	}
-	free(*rootp);				/* D4: Free node */
-	*rootp = q;				/* link parent to new node */
+	free(q);				/* D4: Free node */
+	*rootp = r;				/* link parent to new node */
+	/* rebalance the path up to where its height is unchanged */
+	while (--i >= 0 && __tree_balance(path[i]))
+		continue;
 	return p;
 }
@@ -2,7 +2,9 @@
 
 /*
  * Tree search generalized from Knuth (6.2.2) Algorithm T just like
- * the AT&T man page says.
+ * the AT&T man page says, keeping the tree balanced as an AVL tree
+ * (Knuth 6.2.3) so that the search is O(log n) whatever the order of
+ * insertions.
  *
  * The node_t structure is for internal use only, lint doesn't grok it.
  *
@@ -23,6 +25,71 @@ __RCSID("$NetBSD: tsearch.c,v 1.3 1999/09/16 11:45:37 lukem Exp $");
 #include <search.h>
 #include <stdlib.h>
 
+static inline int
+height(const node_t *n)
+{
+	return n != NULL ? n->height : 0;
+}
+
+static inline void
+fix_height(node_t *n)
+{
+	int hl = height(n->llink), hr = height(n->rlink);
+
+	n->height = (hl > hr ? hl : hr) + 1;
+}
+
+static node_t *
+rotate_right(node_t *n)
+{
+	node_t *l = n->llink;
+
+	n->llink = l->rlink;
+	l->rlink = n;
+	fix_height(n);
+	fix_height(l);
+	return l;
+}
+
+static node_t *
+rotate_left(node_t *n)
+{
+	node_t *r = n->rlink;
+
+	n->rlink = r->llink;
+	r->llink = n;
+	fix_height(n);
+	fix_height(r);
+	return r;
+}
+
+/*
+ * Restore the balance of the subtree at *nodep after an insertion or
+ * deletion below it, rotating it if one side has become two higher
+ * than the other.  Return nonzero if the height of the subtree has
+ * changed, so that the nodes above it need looking at too.
+ */
+int
+__tree_balance(node_t **nodep)
+{
+	node_t *n = *nodep;
+	int old = n->height;
+	int hl = height(n->llink), hr = height(n->rlink);
+
+	if (hl > hr + 1) {
+		if (height(n->llink->llink) < height(n->llink->rlink))
+			n->llink = rotate_left(n->llink);
+		n = rotate_right(n);
+	} else if (hr > hl + 1) {
+		if (height(n->rlink->rlink) < height(n->rlink->llink))
+			n->rlink = rotate_right(n->rlink);
+		n = rotate_left(n);
+	} else
+		fix_height(n);
+	*nodep = n;
+	return n->height != old;
+}
+
 /* find or insert datum into search tree */
 void *
 tsearch (const void *vkey,		/* key to be located */
@@ -31,6 +98,8 @@ tsearch (const void *vkey,		/* key to be located */
 {
 	node_t *q;
 	node_t **rootp = (node_t **)vrootp;
+	node_t **path[TREE_MAX_HEIGHT + 1];	/* links followed from root */
+	int i = 0;
 
 	if (rootp == NULL)
 		return NULL;
@@ -41,6 +110,7 @@ tsearch (const void *vkey,		/* key to be located */
 		if ((r = (*compar)(vkey, (*rootp)->key)) == 0)	/* T2: */
 			return *rootp;		/* we found it! */
 
+		path[i++] = rootp;
 		rootp = (r < 0) ?
 		    &(*rootp)->llink :		/* T3: follow left branch */
 		    &(*rootp)->rlink;		/* T4: follow right branch */
@@ -52,6 +122,10 @@ tsearch (const void *vkey,		/* key to be located */
 		/* LINTED const castaway ok */
 		q->key = (void *)vkey;		/* initialize new node */
 		q->llink = q->rlink = NULL;
+		q->height = 1;
+		/* rebalance the path up to where its height is unchanged */
+		while (--i >= 0 && __tree_balance(path[i]))
+			continue;
 	}
 	return q;
 }
@@ -103,6 +103,7 @@ _fclose_r (struct _reent *rptr,
     FREELB (rptr, fp);
   __sfp_lock_acquire ();
   fp->_flags = 0;		/* release this FILE for reuse */
+  __sfp_release (rptr, fp);
   if (!(fp->_flags2 & __SNLK))
     _funlockfile (fp);
 #ifndef __SINGLE_THREAD__
@@ -122,6 +122,16 @@ struct glue_with_file {
   FILE file;
 };
 
+/*
+ * Released FILEs of the global glue are kept on a free list, linked
+ * through their _cookie field, so that __sfp does not have to search
+ * the glue for a free slot.  New glue blocks are added to the list as
+ * a whole.  Only accessed with the sfp lock held.
+ */
+
+static FILE *__sfp_freelist;
+static struct _glue *__sfp_lastglue;
+
 struct _glue *
 __sfmoreglue (struct _reent *d,
        register int n)
@@ -139,6 +149,43 @@ __sfmoreglue (struct _reent *d,
   return &g->glue;
 }
 
+/*
+ * Release a FILE for reuse by __sfp.  Called with the sfp lock held,
+ * after fp->_flags has been cleared.  Releasing it again does nothing.
+ */
+
+void
+__sfp_release (struct _reent *d,
+       FILE *fp)
+{
+  __slbf_sync_r (d, fp);
+  if ((fp->_flags2 & (__SGLU | __SFRE)) == __SGLU)
+    {
+      fp->_flags2 |= __SFRE;
+      fp->_cookie = __sfp_freelist;
+      __sfp_freelist = fp;
+    }
+}
+
+/*
+ * Take a released FILE that is used again without __sfp, as freopen
+ * does with a closed stream, off the free list.  Called with the sfp
+ * lock held.
+ */
+
+void
+__sfp_reclaim (FILE *fp)
+{
+  FILE **pp;
+
+  if (!(fp->_flags2 & __SFRE))
+    return;
+  for (pp = &__sfp_freelist; *pp != fp; pp = (FILE **) &(*pp)->_cookie)
+    ;
+  *pp = (FILE *) fp->_cookie;
+  fp->_flags2 &= ~__SFRE;
+}
+
 /*
  * Find a free FILE for fopen et al.
  */
@@ -154,23 +201,37 @@ __sfp (struct _reent *d)
 
   if (!_GLOBAL_REENT->__sdidinit)
     __sinit (_GLOBAL_REENT);
-  for (g = &_GLOBAL_REENT->__sglue;; g = g->_next)
+  while ((fp = __sfp_freelist) == NULL)
     {
-      for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
-	if (fp->_flags == 0)
-	  goto found;
-      if (g->_next == NULL &&
-	  (g->_next = __sfmoreglue (d, NDYNAMIC)) == NULL)
-	break;
+      /* Out of free slots; append a block twice the size of the last
+	 one.  Every FILE in it goes onto the free list.  */
+      if (__sfp_lastglue == NULL)
+	__sfp_lastglue = &_GLOBAL_REENT->__sglue;
+      for (g = __sfp_lastglue; g->_next != NULL; g = g->_next)
+	;
+      n = g->_niobs < NDYNAMIC ? NDYNAMIC : 2 * g->_niobs;
+      if (n > NDYNAMIC_MAX)
+	n = NDYNAMIC_MAX;
+      if ((g->_next = __sfmoreglue (d, n)) == NULL)
+	{
+	  _newlib_sfp_lock_exit ();
+	  d->_errno = ENOMEM;
+	  return NULL;
+	}
+      __sfp_lastglue = g = g->_next;
+      while (--n >= 0)
+	{
+	  fp = &g->_iobs[n];
+	  fp->_flags2 = __SGLU | __SFRE;
+	  fp->_cookie = __sfp_freelist;
+	  __sfp_freelist = fp;
+	}
     }
-  _newlib_sfp_lock_exit ();
-  d->_errno = ENOMEM;
-  return NULL;
+  __sfp_freelist = (FILE *) fp->_cookie;
 
-found:
   fp->_file = -1;		/* no file */
   fp->_flags = 1;		/* reserve this slot; caller sets real flags */
-  fp->_flags2 = 0;
+  fp->_flags2 = __SGLU;
 #ifndef __SINGLE_THREAD__
   __lock_init_recursive (fp->_lock);
 #endif
@@ -192,6 +253,94 @@ found:
   return fp;
 }
 
+/*
+ * Registry of line buffered streams.  Before reading from a line
+ * buffered or unbuffered stream, __srefill_r has to flush all line
+ * buffered output streams.  Rather than visiting every FILE in the
+ * glue for that, stdio records the FILEs which have __SLBF set here,
+ * and __srefill_r only walks this list (see _fwalk_lbf).
+ *
+ * Just like the glue, blocks are only ever appended and never freed,
+ * so the list can be walked without locking it.  Removing a stream
+ * merely clears its slot, which is reused by the next registration.
+ * If a new block cannot be allocated, __slbfoverflow is set and
+ * _fwalk_lbf falls back to walking the whole glue.
+ */
+
+static FILE *__slbf_iobs[NLBFGLUE];
+
+struct _lbfglue __slbfglue = { NULL, NLBFGLUE, __slbf_iobs };
+int __slbfoverflow;
+
+static struct _lbfglue *
+__slbfmoreglue (struct _reent *d,
+       int n)
+{
+  struct _lbfglue *g;
+
+  g = (struct _lbfglue *)
+    _malloc_r (d, sizeof (*g) + n * sizeof (FILE *));
+  if (g == NULL)
+    return NULL;
+  g->_next = NULL;
+  g->_niobs = n;
+  g->_iobs = (FILE **) (g + 1);
+  memset (g->_iobs, 0, n * sizeof (FILE *));
+  return g;
+}
+
+/*
+ * Bring the registry in line with the __SLBF flag of fp.  Must be
+ * called whenever __SLBF is set or cleared, or the FILE is released.
+ */
+
+void
+__slbf_sync_r (struct _reent *d,
+       FILE *fp)
+{
+  struct _lbfglue *g;
+  int n;
+
+  if (!(fp->_flags & __SLBF) == !(fp->_flags2 & __SLBR))
+    return;
+
+  __sfp_lock_acquire ();
+  if (fp->_flags & __SLBF)
+    {
+      /* Only streams living in the global glue are visible to a
+	 walk of _GLOBAL_REENT, and per-reent standard streams may go
+	 away with their reent structure, so register just those.  */
+      if (fp->_flags2 & __SGLU)
+	for (g = &__slbfglue; g != NULL; g = g->_next)
+	  {
+	    for (n = 0; n < g->_niobs; n++)
+	      if (g->_iobs[n] == NULL)
+		{
+		  g->_iobs[n] = fp;
+		  fp->_flags2 |= __SLBR;
+		  goto done;
+		}
+	    if (g->_next == NULL
+		&& (g->_next = __slbfmoreglue (d, 2 * g->_niobs)) == NULL)
+	      __slbfoverflow = 1;
+	  }
+    }
+  else
+    {
+      for (g = &__slbfglue; g != NULL; g = g->_next)
+	for (n = 0; n < g->_niobs; n++)
+	  if (g->_iobs[n] == fp)
+	    {
+	      g->_iobs[n] = NULL;
+	      goto cleared;
+	    }
+cleared:
+      fp->_flags2 &= ~__SLBR;
+    }
+done:
+  __sfp_lock_release ();
+}
+
 /*
  * exit() calls _cleanup() through *__cleanup, set whenever we
  * open or buffer a file.  This chicanery is done so that programs
@@ -280,18 +429,26 @@ __sinit (struct _reent *s)
 # endif /* _REENT_GLOBAL_STDIO_STREAMS */
 #endif
 
+  /* The standard streams in the global glue may be reused by __sfp
+     once they are closed.  */
 #ifdef _REENT_GLOBAL_STDIO_STREAMS
-  if (__sf[0]._cookie == NULL) {
+  /* Don't test _cookie here, it links closed FILEs on the free list. */
+  if (__sf[0]._read == NULL) {
     _GLOBAL_REENT->__sglue._niobs = 3;
     _GLOBAL_REENT->__sglue._iobs = &__sf[0];
     stdin_init (&__sf[0]);
     stdout_init (&__sf[1]);
     stderr_init (&__sf[2]);
+    __sf[0]._flags2 = __sf[1]._flags2 = __sf[2]._flags2 = __SGLU;
   }
 #else /* _REENT_GLOBAL_STDIO_STREAMS */
   stdin_init (s->_stdin);
   stdout_init (s->_stdout);
   stderr_init (s->_stderr);
+# ifndef _REENT_SMALL
+  if (s == _GLOBAL_REENT)
+# endif
+    s->_stdin->_flags2 = s->_stdout->_flags2 = s->_stderr->_flags2 = __SGLU;
 #endif /* _REENT_GLOBAL_STDIO_STREAMS */
 
   s->__sdidinit = 1;
@@ -287,6 +287,7 @@ _fmemopen_r (struct _reent *ptr,
     {
       _newlib_sfp_lock_start ();
       fp->_flags = 0;		/* release */
+      __sfp_release (ptr, fp);
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
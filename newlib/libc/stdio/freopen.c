@@ -116,7 +116,12 @@ _freopen_r (struct _reent *ptr,
    */
 
   if (fp->_flags == 0)
-    fp->_flags = __SEOF;	/* hold on to it */
+    {
+      __sfp_lock_acquire ();
+      __sfp_reclaim (fp);
+      fp->_flags = __SEOF;	/* hold on to it */
+      __sfp_lock_release ();
+    }
   else
     {
       if (fp->_flags & __SWR)
@@ -205,6 +210,7 @@ _freopen_r (struct _reent *ptr,
     {				/* did not get it after all */
       __sfp_lock_acquire ();
       fp->_flags = 0;		/* set it free */
+      __sfp_release (ptr, fp);
       ptr->_errno = e;		/* restore in case _close clobbered */
       if (!(oflags2 & __SNLK))
 	_funlockfile (fp);
@@ -219,6 +225,7 @@ _freopen_r (struct _reent *ptr,
     }
 
   fp->_flags = flags;
+  __slbf_sync_r (ptr, fp);
   fp->_file = f;
   fp->_cookie = (void *) fp;
   fp->_read = __sread;
@@ -76,3 +76,25 @@ _fwalk_reent (struct _reent *ptr,
 
   return ret;
 }
+
+/* Walk only the streams on the line buffered stream registry (see
+   findfp.c), unless the registry could not keep track of all of them.  */
+int
+_fwalk_lbf (register int (*function) (FILE *))
+{
+  register FILE *fp;
+  register int n, ret = 0;
+  register struct _lbfglue *g;
+
+  if (__slbfoverflow)
+    return _fwalk (_GLOBAL_REENT, function);
+
+  /* Same as above: blocks are never removed, so don't lock.  */
+  for (g = &__slbfglue; g != NULL; g = g->_next)
+    for (n = 0; n < g->_niobs; n++)
+      if ((fp = g->_iobs[n]) != NULL
+	  && fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+	ret |= (*function) (fp);
+
+  return ret;
+}
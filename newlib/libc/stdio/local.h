@@ -162,6 +162,8 @@ int	      _svfwprintf_r (struct _reent *, FILE *, const wchar_t *,
 int	      _svfiwprintf_r (struct _reent *, FILE *, const wchar_t *, 
 				  va_list);
 extern FILE  *__sfp (struct _reent *);
+extern void   __sfp_release (struct _reent *, FILE *);
+extern void   __sfp_reclaim (FILE *);
 extern int    __sflags (struct _reent *,const char*, int*);
 extern int    __sflush_r (struct _reent *,FILE *);
 #ifdef _STDIO_BSD_SEMANTICS
@@ -185,6 +187,8 @@ extern void   __smakebuf_r (struct _reent *, FILE *);
 extern int    __swhatbuf_r (struct _reent *, FILE *, size_t *, int *);
 extern int    _fwalk (struct _reent *, int (*)(FILE *));
 extern int    _fwalk_reent (struct _reent *, int (*)(struct _reent *, FILE *));
+extern int    _fwalk_lbf (int (*)(FILE *));
+extern void   __slbf_sync_r (struct _reent *, FILE *);
 struct _glue * __sfmoreglue (struct _reent *,int n);
 extern int __submore (struct _reent *, FILE *);
 
@@ -289,7 +293,21 @@ char *_llicvt (char *, long long, char);
 
 #define CVT_BUF_SIZE 128
 
-#define	NDYNAMIC 4	/* add four more whenever necessary */
+#define	NDYNAMIC 4	/* size of the first dynamically added glue block */
+#define	NDYNAMIC_MAX 256 /* later blocks double in size up to this limit */
+
+/* A block of the registry of line buffered streams, see findfp.c.  */
+struct _lbfglue
+{
+  struct _lbfglue *_next;
+  int _niobs;
+  FILE **_iobs;
+};
+
+extern struct _lbfglue __slbfglue;
+extern int __slbfoverflow;
+
+#define	NLBFGLUE 4	/* initial size of the line buffered stream registry */
 
 #ifdef __SINGLE_THREAD__
 #define __sfp_lock_acquire()
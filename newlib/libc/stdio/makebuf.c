@@ -69,6 +69,7 @@ __smakebuf_r (struct _reent *ptr,
 	fp->_flags = (fp->_flags & ~__SNBF) | __SLBF;
       fp->_flags |= flags;
     }
+  __slbf_sync_r (ptr, fp);
 }
 
 /*
@@ -0,0 +1,496 @@
+/* No user fns here.  See pfmt.h and printf_compile.c.  */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include "local.h"
+#include "../stdlib/local.h"
+#include "fvwrite.h"
+#include "pfmt.h"
+
+#ifdef _PFMT_LONGLONG
+typedef long long pf_quad_t;
+typedef unsigned long long pf_uquad_t;
+#else
+typedef long pf_quad_t;
+typedef unsigned long pf_uquad_t;
+#endif
+
+#define	to_digit(c)	((c) - '0')
+#define is_digit(c)	((unsigned)to_digit (c) <= 9)
+#define	to_char(n)	((n) + '0')
+
+/*
+ * Compile the format FMT into at most MAXOPS ops.  Returns the number of
+ * ops used, including the terminating one, or -1 if FMT contains
+ * anything but the simple conversions described in pfmt.h, or needs
+ * more ops.  Literal text is referenced, not copied.
+ */
+int
+__pfmt_compile (const char *fmt,
+       struct __pfmt_op *ops,
+       int maxops)
+{
+  struct __pfmt_op *op;
+  const char *lit;
+  int n, flags;
+
+  for (op = ops; op < ops + maxops; op++)
+    {
+      lit = fmt;
+      while (*fmt != '\0' && *fmt != '%')
+	fmt++;
+      op->lit = lit;
+      op->litlen = fmt - lit;
+      op->width = 0;
+      op->prec = -1;
+      op->flags = 0;
+      if (*fmt == '\0')
+	{
+	  op->conv = '\0';
+	  return op - ops + 1;
+	}
+      if (*++fmt == '%')
+	{
+	  op->conv = *fmt++;
+	  continue;
+	}
+
+      for (flags = 0;; fmt++)
+	{
+	  if (*fmt == '#')
+	    flags |= PF_ALT;
+	  else if (*fmt == '-')
+	    flags |= PF_LADJUST;
+	  else if (*fmt == '0')
+	    flags |= PF_ZEROPAD;
+	  else if (*fmt == '+')
+	    flags |= PF_PLUS;
+	  else if (*fmt == ' ')
+	    flags |= PF_SPACE;
+	  else
+	    break;
+	}
+      for (n = 0; is_digit (*fmt); fmt++)
+	if ((n = 10 * n + to_digit (*fmt)) > PF_MAXWIDTH)
+	  return -1;
+      op->width = n;
+      if (*fmt == '.')
+	{
+	  for (n = 0, fmt++; is_digit (*fmt); fmt++)
+	    if ((n = 10 * n + to_digit (*fmt)) > PF_MAXWIDTH)
+	      return -1;
+	  op->prec = n;
+	}
+      if (*fmt == 'h')
+	{
+	  if (*++fmt == 'h')
+	    return -1;
+	  flags |= PF_SHORT;
+	}
+      else if (*fmt == 'l')
+	{
+	  if (*++fmt == 'l')
+	    {
+#ifdef _PFMT_LONGLONG
+	      fmt++;
+	      flags |= PF_QUAD;
+#else
+	      return -1;
+#endif
+	    }
+	  else
+	    flags |= PF_LONG;
+	}
+
+      switch (*fmt)
+	{
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+	  break;
+	case 'c':
+	case 's':
+	case 'p':
+	  if (flags & (PF_SHORT | PF_LONG | PF_QUAD))
+	    return -1;
+	  break;
+	default:
+	  return -1;
+	}
+      op->conv = *fmt++;
+      op->flags = flags;
+    }
+  return -1;
+}
+
+/* Like the __MBTOWC loop in vfprintf, __pfmt_compile looks for '%' and
+   copies everything else verbatim.  That is only equivalent if '%' can
+   never be part of a multibyte character.  */
+int
+__pfmt_locale_ok (void)
+{
+#ifdef _MB_CAPABLE
+  return MB_CUR_MAX == 1 || __MBTOWC == __utf8_mbtowc;
+#else
+  return 1;
+#endif
+}
+
+#define	PFMT_BUFSIZ	256
+
+struct pfmt_out
+{
+  struct _reent *data;
+  FILE *fp;
+  __pfmt_sprint_f *sprint;
+  char *p;
+  char buf[PFMT_BUFSIZ];
+};
+
+static int
+out_print (struct pfmt_out *o,
+       const char *s,
+       size_t len)
+{
+  struct __siov iov;
+  struct __suio uio;
+
+  iov.iov_base = s;
+  iov.iov_len = len;
+  uio.uio_iov = &iov;
+  uio.uio_iovcnt = 1;
+  uio.uio_resid = len;
+  return o->sprint (o->data, o->fp, &uio);
+}
+
+static int
+out_flush (struct pfmt_out *o)
+{
+  size_t len = o->p - o->buf;
+
+  o->p = o->buf;
+  return len ? out_print (o, o->buf, len) : 0;
+}
+
+static int
+out_write (struct pfmt_out *o,
+       const char *s,
+       int len)
+{
+  if (len > o->buf + PFMT_BUFSIZ - o->p)
+    {
+      if (out_flush (o))
+	return EOF;
+      if (len >= PFMT_BUFSIZ)
+	return out_print (o, s, len);
+    }
+  /* Most pieces are a few bytes long; don't pay for a memcpy call.  */
+  if (len > 16)
+    {
+      memcpy (o->p, s, len);
+      o->p += len;
+    }
+  else
+    while (len-- > 0)
+      *o->p++ = *s++;
+  return 0;
+}
+
+static int
+out_pad (struct pfmt_out *o,
+       int c,
+       int n)
+{
+  int room;
+
+  while (n > 0)
+    {
+      if ((room = o->buf + PFMT_BUFSIZ - o->p) == 0)
+	{
+	  if (out_flush (o))
+	    return EOF;
+	  room = PFMT_BUFSIZ;
+	}
+      if (room > n)
+	room = n;
+      n -= room;
+      if (room > 16)
+	{
+	  memset (o->p, c, room);
+	  o->p += room;
+	}
+      else
+	while (room-- > 0)
+	  *o->p++ = c;
+    }
+  return 0;
+}
+
+static const char pfmt_digits2[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+/* Convert VAL to decimal, ending just before CP, two digits per
+   division and in 32 bits once the value fits.  Returns the start of
+   the digits.  */
+static char *
+pfmt_utoa (pf_uquad_t val,
+       char *cp)
+{
+  unsigned int v, r;
+
+  while (val > 0xffffffffU)
+    {
+      r = val % 100;
+      val /= 100;
+      *--cp = pfmt_digits2[2 * r + 1];
+      *--cp = pfmt_digits2[2 * r];
+    }
+  for (v = val; v >= 100; v /= 100)
+    {
+      r = v % 100;
+      *--cp = pfmt_digits2[2 * r + 1];
+      *--cp = pfmt_digits2[2 * r];
+    }
+  if (v >= 10)
+    {
+      *--cp = pfmt_digits2[2 * v + 1];
+      *--cp = pfmt_digits2[2 * v];
+    }
+  else
+    *--cp = to_char (v);
+  return cp;
+}
+
+/*
+ * Print the arguments in *APP according to OPS, as compiled by
+ * __pfmt_compile, through SPRINT.  Returns the number of bytes printed,
+ * or EOF on an output error.  The caller handles stream locking.
+ *
+ * The output is byte for byte what vfprintf produces for the same
+ * format; keep the two in sync.
+ */
+int
+__pfmt_exec (struct _reent *data,
+       FILE *fp,
+       const struct __pfmt_op *op,
+       va_list *app,
+       __pfmt_sprint_f *sprint)
+{
+  struct pfmt_out o;
+  pf_uquad_t uval;
+  pf_quad_t sval;
+  const char *cp;
+  char *dp;
+  const char *xdigs;
+  char tmp[3 * sizeof (pf_uquad_t)];
+  char ox[2];
+  char sign;
+  int flags, base, size, dprec, realsz, field, width, prec, n;
+  char *p;
+  int ret = 0;
+
+  o.data = data;
+  o.fp = fp;
+  o.sprint = sprint;
+  o.p = o.buf;
+
+  for (;; op++)
+    {
+      if (op->litlen)
+	{
+	  if (out_write (&o, op->lit, op->litlen))
+	    return EOF;
+	  ret += op->litlen;
+	}
+      if (op->conv == '\0')
+	break;
+
+      flags = op->flags;
+      width = op->width;
+      prec = op->prec;
+      sign = (flags & PF_PLUS) ? '+' : (flags & PF_SPACE) ? ' ' : '\0';
+      dprec = 0;
+      ox[1] = '\0';
+      xdigs = "0123456789abcdef";
+
+      switch (op->conv)
+	{
+	case '%':
+	  if (out_write (&o, "%", 1))
+	    return EOF;
+	  ret++;
+	  continue;
+	case 'c':
+	  tmp[0] = va_arg (*app, int);
+	  cp = tmp;
+	  size = 1;
+	  sign = '\0';
+	  goto print;
+	case 's':
+	  cp = va_arg (*app, char *);
+	  sign = '\0';
+	  if (cp == NULL)
+	    {
+	      cp = "(null)";
+	      size = ((unsigned) prec > 6U) ? 6 : prec;
+	    }
+	  else if (prec >= 0)
+	    {
+	      const char *nul = memchr (cp, 0, prec);
+
+	      size = nul != NULL ? nul - cp : prec;
+	    }
+	  else
+	    size = strlen (cp);
+	  goto print;
+	case 'd':
+	case 'i':
+	  sval = (flags & PF_QUAD) ? va_arg (*app, pf_quad_t)
+		 : (flags & PF_LONG) ? va_arg (*app, long)
+		 : (flags & PF_SHORT) ? (long) (short) va_arg (*app, int)
+		 : (long) va_arg (*app, int);
+	  uval = sval;
+	  if (sval < 0)
+	    {
+	      uval = -uval;
+	      sign = '-';
+	    }
+	  base = 10;
+	  goto number;
+	case 'p':
+	  uval = (uintptr_t) va_arg (*app, void *);
+	  base = 16;
+	  ox[0] = '0';
+	  ox[1] = 'x';
+	  sign = '\0';
+	  goto number;
+	case 'X':
+	  xdigs = "0123456789ABCDEF";
+	  /* FALLTHROUGH */
+	default:
+	  uval = (flags & PF_QUAD) ? va_arg (*app, pf_uquad_t)
+		 : (flags & PF_LONG) ? va_arg (*app, unsigned long)
+		 : (flags & PF_SHORT)
+		   ? (unsigned long) (unsigned short) va_arg (*app, int)
+		 : (unsigned long) va_arg (*app, unsigned int);
+	  base = op->conv == 'u' ? 10 : op->conv == 'o' ? 8 : 16;
+	  /* leading 0x/X only if non-zero */
+	  if (base == 16 && (flags & PF_ALT) && uval != 0)
+	    {
+	      ox[0] = '0';
+	      ox[1] = op->conv;
+	    }
+	  sign = '\0';
+	number:
+	  if ((dprec = prec) >= 0)
+	    flags &= ~PF_ZEROPAD;
+	  dp = tmp + sizeof tmp;
+	  if (uval != 0 || prec != 0)
+	    {
+	      if (base == 10)
+		dp = pfmt_utoa (uval, dp);
+	      else if (base == 16)
+		do
+		  {
+		    *--dp = xdigs[uval & 15];
+		    uval >>= 4;
+		  }
+		while (uval != 0);
+	      else
+		{
+		  do
+		    {
+		      *--dp = to_char (uval & 7);
+		      uval >>= 3;
+		    }
+		  while (uval != 0);
+		  /* handle octal leading 0 */
+		  if ((flags & PF_ALT) && *dp != '0')
+		    *--dp = '0';
+		}
+	    }
+	  else if (base == 8 && (flags & PF_ALT))
+	    *--dp = '0';
+	  cp = dp;
+	  size = tmp + sizeof tmp - dp;
+	  break;
+	}
+
+print:
+      /* Same padding rules as vfprintf.  */
+      realsz = dprec > size ? dprec : size;
+      if (sign)
+	realsz++;
+      if (ox[1])
+	realsz += 2;
+      field = width > realsz ? width : realsz;
+
+      if (field > o.buf + PFMT_BUFSIZ - o.p && out_flush (&o))
+	return EOF;
+      if (field <= PFMT_BUFSIZ)
+	{
+	  /* The whole field fits in the buffer, build it in place.  */
+	  p = o.p;
+	  if ((flags & (PF_LADJUST | PF_ZEROPAD)) == 0)
+	    for (n = width - realsz; n > 0; n--)
+	      *p++ = ' ';
+	  if (sign)
+	    *p++ = sign;
+	  if (ox[1])
+	    {
+	      *p++ = ox[0];
+	      *p++ = ox[1];
+	    }
+	  if ((flags & (PF_LADJUST | PF_ZEROPAD)) == PF_ZEROPAD)
+	    for (n = width - realsz; n > 0; n--)
+	      *p++ = '0';
+	  for (n = dprec - size; n > 0; n--)
+	    *p++ = '0';
+	  if (size > 16)
+	    {
+	      memcpy (p, cp, size);
+	      p += size;
+	    }
+	  else
+	    for (n = size; n > 0; n--)
+	      *p++ = *cp++;
+	  if (flags & PF_LADJUST)
+	    for (n = width - realsz; n > 0; n--)
+	      *p++ = ' ';
+	  o.p = p;
+	}
+      else if (((flags & (PF_LADJUST | PF_ZEROPAD)) == 0
+		&& out_pad (&o, ' ', width - realsz))
+	       || (sign && out_write (&o, &sign, 1))
+	       || (ox[1] && out_write (&o, ox, 2))
+	       || ((flags & (PF_LADJUST | PF_ZEROPAD)) == PF_ZEROPAD
+		   && out_pad (&o, '0', width - realsz))
+	       || out_pad (&o, '0', dprec - size)
+	       || out_write (&o, cp, size)
+	       || ((flags & PF_LADJUST) && out_pad (&o, ' ', width - realsz)))
+	return EOF;
+
+      ret += field;
+    }
+
+  if (out_flush (&o))
+    return EOF;
+  return ret;
+}
@@ -0,0 +1,70 @@
+/* Precompiled printf formats.
+
+   A format string is broken down into a list of ops, each holding a run
+   of literal text followed by at most one conversion.  Only the simple
+   conversions which make up the bulk of real world formats are handled
+   (%d %i %u %o %x %X %c %s %p with flags, a literal width and precision
+   and the h, l and ll length modifiers); __pfmt_compile rejects anything
+   else and the caller falls back to the full vfprintf engine.
+
+   __pfmt_exec formats into a local buffer and hands the result to the
+   stream in as few __sprint_r calls as possible, rather than flushing
+   the I/O vectors after every conversion as vfprintf does.  */
+
+#ifndef _PFMT_H_
+#define _PFMT_H_
+
+#include <newlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+/* Needs the uio interface, and is not worth the code in builds
+   optimized for size.  */
+#if defined (_FVWRITE_IN_STREAMIO) && !defined (__OPTIMIZE_SIZE__) \
+    && !defined (PREFER_SIZE_OVER_SPEED)
+# define _PFMT_FAST_PATH
+#endif
+
+/* Same test as in vfprintf.c.  */
+#if defined _WANT_IO_LONG_LONG \
+	&& (defined __GNUC__ || __STDC_VERSION__ >= 199901L)
+# define _PFMT_LONGLONG
+#endif
+
+#define	PF_ALT		0x01		/* '#' */
+#define	PF_LADJUST	0x02		/* '-' */
+#define	PF_ZEROPAD	0x04		/* '0' */
+#define	PF_PLUS		0x08		/* '+' */
+#define	PF_SPACE	0x10		/* ' ' */
+#define	PF_SHORT	0x20		/* 'h' */
+#define	PF_LONG		0x40		/* 'l' */
+#define	PF_QUAD		0x80		/* 'll' */
+
+#define	PF_MAXWIDTH	0x7fff		/* larger widths use vfprintf */
+
+struct __pfmt_op
+{
+  const char *lit;		/* literal text printed before the conversion */
+  int litlen;
+  short width;			/* field width, 0 if none */
+  short prec;			/* precision, -1 if none */
+  unsigned char conv;		/* conversion character, '\0' ends the list */
+  unsigned char flags;		/* PF_xxx */
+};
+
+struct __printf_compiled
+{
+  const char *fmt;		/* private copy of the format string */
+  int nops;			/* 0 if the format needs vfprintf */
+  struct __pfmt_op ops[1];
+};
+
+struct __suio;
+typedef int __pfmt_sprint_f (struct _reent *, FILE *, struct __suio *);
+
+extern int __pfmt_compile (const char *, struct __pfmt_op *, int);
+extern int __pfmt_exec (struct _reent *, FILE *, const struct __pfmt_op *,
+			va_list *, __pfmt_sprint_f *);
+extern int __pfmt_locale_ok (void);
+
+#endif /* _PFMT_H_ */
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+FUNCTION
+<<printf_compile>>, <<fprintf_compiled>>, <<vfprintf_compiled>>---print with a precompiled format
+
+INDEX
+	printf_compile
+INDEX
+	printf_compiled_free
+INDEX
+	fprintf_compiled
+INDEX
+	vfprintf_compiled
+INDEX
+	_printf_compile_r
+INDEX
+	_vfprintf_compiled_r
+
+SYNOPSIS
+	#include <stdio.h>
+	printf_compiled_t *printf_compile(const char *<[format]>);
+	void printf_compiled_free(printf_compiled_t *<[pc]>);
+	int fprintf_compiled(FILE *<[fd]>, const printf_compiled_t *<[pc]>,
+			     ...);
+	int vfprintf_compiled(FILE *<[fd]>, const printf_compiled_t *<[pc]>,
+			      va_list <[list]>);
+
+	printf_compiled_t *_printf_compile_r(struct _reent *<[reent]>,
+					     const char *<[format]>);
+	int _vfprintf_compiled_r(struct _reent *<[reent]>, FILE *<[fd]>,
+				 const printf_compiled_t *<[pc]>,
+				 va_list <[list]>);
+
+DESCRIPTION
+<<printf_compile>> parses <[format]> once, ahead of time, so that it
+can be used for any number of calls to <<fprintf_compiled>> or
+<<vfprintf_compiled>> without being parsed again.  These behave
+exactly like <<fprintf>> and <<vfprintf>> called with the original
+<[format]>.  The format string is copied; the caller need not keep it
+around.
+
+Formats made up of literal text and the conversions <<%d>>, <<%i>>,
+<<%u>>, <<%o>>, <<%x>>, <<%X>>, <<%c>>, <<%s>>, <<%p>> and <<%%>>,
+with flags, a numeric field width and precision, and the <<h>>,
+<<l>> and <<ll>> length modifiers are printed by a fast path which
+does not look at <[format]> at all.  Any other format still works,
+but is handed to <<vfprintf>> on each call.
+
+<<printf_compiled_free>> releases a compiled format.  <[pc]> may be
+<<NULL>>.
+
+The alternate functions <<_printf_compile_r>> and
+<<_vfprintf_compiled_r>> are reentrant versions which take an extra
+argument <[reent]>, a pointer to a reentrancy structure.
+
+RETURNS
+<<printf_compile>> returns the compiled format, or <<NULL>> with
+<<errno>> set to ENOMEM if memory could not be allocated.
+
+<<fprintf_compiled>> and <<vfprintf_compiled>> return the number of
+bytes output, or a negative value on error, like <<fprintf>>.
+
+PORTABILITY
+These functions are newlib extensions.
+
+Supporting OS subroutines required: <<close>>, <<fstat>>, <<isatty>>,
+<<lseek>>, <<read>>, <<sbrk>>, <<write>>.
+*/
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "local.h"
+#include "fvwrite.h"
+#include "pfmt.h"
+
+#ifdef _FVWRITE_IN_STREAMIO
+int __sprint_r (struct _reent *, FILE *, register struct __suio *);
+#endif
+
+printf_compiled_t *
+_printf_compile_r (struct _reent *ptr,
+       const char *fmt)
+{
+  printf_compiled_t *pc;
+  const char *p;
+  size_t len, maxops;
+  char *copy;
+
+  /* Each op ends at a '%', except the terminating one.  */
+  for (p = fmt, maxops = 1; (p = strchr (p, '%')) != NULL; p++)
+    maxops++;
+  len = strlen (fmt) + 1;
+
+  pc = (printf_compiled_t *) _malloc_r (ptr, sizeof (printf_compiled_t)
+					+ (maxops - 1) * sizeof (pc->ops[0])
+					+ len);
+  if (pc == NULL)
+    return NULL;
+  copy = (char *) &pc->ops[maxops];
+  memcpy (copy, fmt, len);
+  pc->fmt = copy;
+  pc->nops = __pfmt_compile (copy, pc->ops, maxops);
+  if (pc->nops < 0)
+    pc->nops = 0;
+  return pc;
+}
+
+void
+_printf_compiled_free_r (struct _reent *ptr,
+       printf_compiled_t *pc)
+{
+  _free_r (ptr, pc);
+}
+
+int
+_vfprintf_compiled_r (struct _reent *ptr,
+       FILE *fp,
+       const printf_compiled_t *pc,
+       va_list ap)
+{
+#ifdef _PFMT_FAST_PATH
+  va_list ap2;
+  int ret;
+
+  if (pc->nops == 0 || !__pfmt_locale_ok ())
+    return _vfprintf_r (ptr, fp, pc->fmt, ap);
+
+  CHECK_INIT (ptr, fp);
+  _newlib_flockfile_start (fp);
+  ORIENT (fp, -1);
+  /* Same as vfprintf: printing to a read-only stream returns EOF.  */
+  if (cantwrite (ptr, fp))
+    {
+      _newlib_flockfile_exit (fp);
+      return EOF;
+    }
+  va_copy (ap2, ap);
+  ret = __pfmt_exec (ptr, fp, pc->ops, &ap2, __sprint_r);
+  va_end (ap2);
+  if (__sferror (fp))
+    ret = EOF;
+  _newlib_flockfile_end (fp);
+  return ret;
+#else
+  return _vfprintf_r (ptr, fp, pc->fmt, ap);
+#endif
+}
+
+#ifndef _REENT_ONLY
+
+printf_compiled_t *
+printf_compile (const char *fmt)
+{
+  return _printf_compile_r (_REENT, fmt);
+}
+
+void
+printf_compiled_free (printf_compiled_t *pc)
+{
+  _printf_compiled_free_r (_REENT, pc);
+}
+
+int
+vfprintf_compiled (FILE *fp,
+       const printf_compiled_t *pc,
+       va_list ap)
+{
+  return _vfprintf_compiled_r (_REENT, fp, pc, ap);
+}
+
+int
+fprintf_compiled (FILE *fp,
+       const printf_compiled_t *pc,
+       ...)
+{
+  int ret;
+  va_list ap;
+
+  va_start (ap, pc);
+  ret = _vfprintf_compiled_r (_REENT, fp, pc, ap);
+  va_end (ap);
+  return ret;
+}
+
+#endif /* ! _REENT_ONLY */
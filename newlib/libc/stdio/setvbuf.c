@@ -164,6 +164,7 @@ nbf:
           fp->_w = 0;
           fp->_bf._base = fp->_p = fp->_nbuf;
           fp->_bf._size = 1;
+          __slbf_sync_r (reent, fp);
           _newlib_flockfile_exit (fp);
           return (ret);
         }
@@ -217,6 +218,7 @@ nbf:
       fp->_w = 0;
     }
 
+  __slbf_sync_r (reent, fp);
   _newlib_flockfile_end (fp);
   return 0;
 }
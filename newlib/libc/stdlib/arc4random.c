@@ -32,6 +32,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#include <reent.h>
 
 #define KEYSTREAM_ONLY
 #include "chacha_private.h"
@@ -52,6 +53,7 @@
 static struct _rs {
 	size_t		rs_have;	/* valid bytes at end of rs_buf */
 	size_t		rs_count;	/* bytes till reseed */
+	int		rs_forkgen;	/* __arc4random_forkgen when stirred */
 } *rs;
 
 /* Maybe be preserved in fork children, if _rs_allocate() decides. */
@@ -60,39 +62,47 @@ static struct _rsx {
 	u_char		rs_buf[RSBUFSZ];	/* keystream blocks */
 } *rsx;
 
+/*
+ * A thread with a struct _reent of its own gets a generator of its own,
+ * used without any lock.  The global one is shared by all other threads.
+ */
+struct __arc4random_state {
+	struct _rs	rs;
+	struct _rsx	rsx;
+};
+
+/* Incremented in fork children; see arc4random.h. */
+int __arc4random_forkgen;
+
 static inline int _rs_allocate(struct _rs **, struct _rsx **);
 static inline void _rs_forkdetect(void);
 #include "arc4random.h"
 
-static inline void _rs_rekey(u_char *dat, size_t datlen);
+static inline void _rs_rekey(struct _rs *, struct _rsx *, u_char *dat,
+    size_t datlen);
 
 static inline void
-_rs_init(u_char *buf, size_t n)
+_rs_init(struct _rsx *rsx, u_char *buf, size_t n)
 {
 	if (n < KEYSZ + IVSZ)
 		return;
 
-	if (rs == NULL) {
-		if (_rs_allocate(&rs, &rsx) == -1)
-			abort();
-	}
-
 	chacha_keysetup(&rsx->rs_chacha, buf, KEYSZ * 8, 0);
 	chacha_ivsetup(&rsx->rs_chacha, buf + KEYSZ);
 }
 
 static void
-_rs_stir(void)
+_rs_stir(struct _rs *rs, struct _rsx *rsx, int init)
 {
 	u_char rnd[KEYSZ + IVSZ];
 
 	if (getentropy(rnd, sizeof rnd) == -1)
 		_getentropy_fail();
 
-	if (!rs)
-		_rs_init(rnd, sizeof(rnd));
+	if (init)
+		_rs_init(rsx, rnd, sizeof(rnd));
 	else
-		_rs_rekey(rnd, sizeof(rnd));
+		_rs_rekey(rs, rsx, rnd, sizeof(rnd));
 	explicit_bzero(rnd, sizeof(rnd));	/* discard source seed */
 
 	/* invalidate rs_buf */
@@ -100,14 +110,16 @@ _rs_stir(void)
 	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
 
 	rs->rs_count = (SIZE_MAX <= 65535) ? 65000 : 1600000;
+	rs->rs_forkgen = __arc4random_forkgen;
 }
 
 static inline void
-_rs_stir_if_needed(size_t len)
+_rs_stir_if_needed(struct _rs *rs, struct _rsx *rsx, size_t len)
 {
-	_rs_forkdetect();
-	if (!rs || rs->rs_count <= len)
-		_rs_stir();
+	if (rs->rs_forkgen != __arc4random_forkgen)
+		rs->rs_count = 0;
+	if (rs->rs_count <= len)
+		_rs_stir(rs, rsx, 0);
 	if (rs->rs_count <= len)
 		rs->rs_count = 0;
 	else
@@ -115,14 +127,14 @@ _rs_stir_if_needed(size_t len)
 }
 
 static inline void
-_rs_rekey(u_char *dat, size_t datlen)
+_rs_rekey(struct _rs *rs, struct _rsx *rsx, u_char *dat, size_t datlen)
 {
 #ifndef KEYSTREAM_ONLY
 	memset(rsx->rs_buf, 0, sizeof(rsx->rs_buf));
 #endif
 	/* fill rs_buf with the keystream */
-	chacha_encrypt_bytes(&rsx->rs_chacha, rsx->rs_buf,
-	    rsx->rs_buf, sizeof(rsx->rs_buf));
+	chacha_keystream_blocks(&rsx->rs_chacha, rsx->rs_buf,
+	    sizeof(rsx->rs_buf) / BLOCKSZ);
 	/* mix in optional user provided data */
 	if (dat) {
 		size_t i, m;
@@ -132,19 +144,19 @@ _rs_rekey(u_char *dat, size_t datlen)
 			rsx->rs_buf[i] ^= dat[i];
 	}
 	/* immediately reinit for backtracking resistance */
-	_rs_init(rsx->rs_buf, KEYSZ + IVSZ);
+	_rs_init(rsx, rsx->rs_buf, KEYSZ + IVSZ);
 	memset(rsx->rs_buf, 0, KEYSZ + IVSZ);
 	rs->rs_have = sizeof(rsx->rs_buf) - KEYSZ - IVSZ;
 }
 
 static inline void
-_rs_random_buf(void *_buf, size_t n)
+_rs_random_buf(struct _rs *rs, struct _rsx *rsx, void *_buf, size_t n)
 {
 	u_char *buf = (u_char *)_buf;
 	u_char *keystream;
 	size_t m;
 
-	_rs_stir_if_needed(n);
+	_rs_stir_if_needed(rs, rsx, n);
 	while (n > 0) {
 		if (rs->rs_have > 0) {
 			m = min(n, rs->rs_have);
@@ -155,35 +167,98 @@ _rs_random_buf(void *_buf, size_t n)
 			buf += m;
 			n -= m;
 			rs->rs_have -= m;
+		} else if (n >= sizeof(rsx->rs_buf)) {
+			/*
+			 * Whole buffers are written straight to the caller.
+			 * The rekey below then replaces the key that made
+			 * them.
+			 */
+			m = n - n % sizeof(rsx->rs_buf);
+			chacha_keystream_blocks(&rsx->rs_chacha, buf,
+			    m / BLOCKSZ);
+			buf += m;
+			n -= m;
 		}
 		if (rs->rs_have == 0)
-			_rs_rekey(NULL, 0);
+			_rs_rekey(rs, rsx, NULL, 0);
 	}
 }
 
 static inline void
-_rs_random_u32(uint32_t *val)
+_rs_random_u32(struct _rs *rs, struct _rsx *rsx, uint32_t *val)
 {
 	u_char *keystream;
 
-	_rs_stir_if_needed(sizeof(*val));
+	_rs_stir_if_needed(rs, rsx, sizeof(*val));
 	if (rs->rs_have < sizeof(*val))
-		_rs_rekey(NULL, 0);
+		_rs_rekey(rs, rsx, NULL, 0);
 	keystream = rsx->rs_buf + sizeof(rsx->rs_buf) - rs->rs_have;
 	memcpy(val, keystream, sizeof(*val));
 	memset(keystream, 0, sizeof(*val));
 	rs->rs_have -= sizeof(*val);
 }
 
+/* Set up the global generator, used with _ARC4_LOCK held. */
+static inline void
+_rs_global(void)
+{
+	_rs_forkdetect();
+	if (rs == NULL) {
+		if (_rs_allocate(&rs, &rsx) == -1)
+			abort();
+		_rs_stir(rs, rsx, 1);
+	}
+}
+
+#ifndef __SINGLE_THREAD__
+/* The calling thread's generator, or NULL to use the global one. */
+static inline struct __arc4random_state *
+_rs_thread(void)
+{
+	struct _reent *ptr = _REENT;
+	struct __arc4random_state *st;
+
+	if (ptr == _GLOBAL_REENT)
+		return (NULL);
+	st = _REENT_ARC4RANDOM(ptr);
+	if (st == NULL) {
+		st = _malloc_r(ptr, sizeof(*st));
+		if (st == NULL)
+			return (NULL);
+		_rs_stir(&st->rs, &st->rsx, 1);
+		_REENT_ARC4RANDOM(ptr) = st;
+	}
+	return (st);
+}
+
+/* Called by _reclaim_reent when a thread's struct _reent goes away. */
+void
+__arc4random_reclaim(struct _reent *ptr)
+{
+	struct __arc4random_state *st = _REENT_ARC4RANDOM(ptr);
+
+	explicit_bzero(st, sizeof(*st));
+	_free_r(ptr, st);
+	_REENT_ARC4RANDOM(ptr) = NULL;
+}
+#endif
+
 uint32_t
 arc4random(void)
 {
 	uint32_t val;
 
 #ifndef __SINGLE_THREAD__
+	struct __arc4random_state *st = _rs_thread();
+
+	if (st != NULL) {
+		_rs_random_u32(&st->rs, &st->rsx, &val);
+		return val;
+	}
 	_ARC4_LOCK();
 #endif
-	_rs_random_u32(&val);
+	_rs_global();
+	_rs_random_u32(rs, rsx, &val);
 #ifndef __SINGLE_THREAD__
 	_ARC4_UNLOCK();
 #endif
@@ -194,9 +269,16 @@ void
 arc4random_buf(void *buf, size_t n)
 {
 #ifndef __SINGLE_THREAD__
+	struct __arc4random_state *st = _rs_thread();
+
+	if (st != NULL) {
+		_rs_random_buf(&st->rs, &st->rsx, buf, n);
+		return;
+	}
 	_ARC4_LOCK();
 #endif
-	_rs_random_buf(buf, n);
+	_rs_global();
+	_rs_random_buf(rs, rsx, buf, n);
 #ifndef __SINGLE_THREAD__
 	_ARC4_UNLOCK();
 #endif
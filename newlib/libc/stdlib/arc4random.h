@@ -31,6 +31,10 @@
  *  o _ARC4RANDOM_GETENTROPY_FAIL(),
  *  o _ARC4RANDOM_ALLOCATE(rsp, rspx), and
  *  o _ARC4RANDOM_FORKDETECT().
+ *
+ * A port whose fork does not go through _fork_r must increment
+ * __arc4random_forkgen in the child, or threads' generators will give
+ * the child what they give the parent.
  */
 #include <machine/_arc4random.h>
 
@@ -219,3 +219,74 @@ chacha_encrypt_bytes(chacha_ctx *x,const u8 *m,u8 *c,u32 bytes)
 #endif
   }
 }
+
+#ifdef KEYSTREAM_ONLY
+/* Four blocks are computed side by side in the lanes of 128-bit vectors
+   where GCC can map its vector extensions onto such registers.  */
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON) || \
+    defined(__ALTIVEC__))
+#define CHACHA_LANES 4
+
+typedef u32 chacha_vec __attribute__((vector_size(16)));
+
+#define VROTATE(v,c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define VQUARTERROUND(a,b,c,d) \
+  a += b; d = VROTATE(d ^ a,16); \
+  c += d; b = VROTATE(b ^ c,12); \
+  a += b; d = VROTATE(d ^ a, 8); \
+  c += d; b = VROTATE(b ^ c, 7);
+#endif
+
+/* Write the keystream of the next nblocks blocks to c.  */
+static void
+chacha_keystream_blocks(chacha_ctx *x,u8 *c,size_t nblocks)
+{
+  size_t n;
+#ifdef CHACHA_LANES
+  chacha_vec v[16], j[16];
+  u32 w[16][CHACHA_LANES];
+  u32 lo, hi;
+  int i, k;
+
+  for (;nblocks >= CHACHA_LANES;nblocks -= CHACHA_LANES) {
+    lo = x->input[12];
+    hi = x->input[13];
+    for (i = 0;i < 16;++i)
+      j[i] = (chacha_vec) { x->input[i], x->input[i], x->input[i], x->input[i] };
+    j[12] = (chacha_vec) { lo, lo + 1, lo + 2, lo + 3 };
+    j[13] = (chacha_vec) { hi, hi + (lo + 1 < lo), hi + (lo + 2 < lo),
+                           hi + (lo + 3 < lo) };
+    for (i = 0;i < 16;++i)
+      v[i] = j[i];
+    for (i = 20;i > 0;i -= 2) {
+      VQUARTERROUND( v[0], v[4], v[8],v[12])
+      VQUARTERROUND( v[1], v[5], v[9],v[13])
+      VQUARTERROUND( v[2], v[6],v[10],v[14])
+      VQUARTERROUND( v[3], v[7],v[11],v[15])
+      VQUARTERROUND( v[0], v[5],v[10],v[15])
+      VQUARTERROUND( v[1], v[6],v[11],v[12])
+      VQUARTERROUND( v[2], v[7], v[8],v[13])
+      VQUARTERROUND( v[3], v[4], v[9],v[14])
+    }
+    for (i = 0;i < 16;++i) {
+      v[i] += j[i];
+      memcpy(w[i], &v[i], sizeof(w[i]));
+    }
+    for (k = 0;k < CHACHA_LANES;++k, c += 64)
+      for (i = 0;i < 16;++i)
+        U32TO8_LITTLE(c + 4 * i, w[i][k]);
+
+    x->input[12] = PLUS(lo, CHACHA_LANES);
+    if (x->input[12] < lo)
+      x->input[13] = PLUSONE(hi);
+  }
+#endif
+  /* chacha_encrypt_bytes takes a 32-bit count of bytes.  */
+  for (;nblocks > 0;nblocks -= n) {
+    n = nblocks < 65536 ? nblocks : 65536;
+    chacha_encrypt_bytes(x, c, c, n * 64);
+    c += n * 64;
+  }
+}
+#endif /* KEYSTREAM_ONLY */
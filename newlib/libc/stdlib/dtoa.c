@@ -284,6 +284,38 @@ _dtoa_r (struct _reent *ptr,
       return s;
     }
 
+#ifdef _DTOA_FAST
+  {
+    char buf[DTOA_FAST_NDIG];
+
+    /* Modes 4-9 give the same results as 2 and 3.  */
+    j = mode < 0 || mode > 9 ? 0 : mode > 5 ? mode - 4 : mode;
+    if (j > 3)
+      j -= 2;
+    if ((j1 = dtoa_fast (d.d, j, ndigits, buf, &k)) >= 0)
+      {
+	/* Size the result the way the code below does, callers may pad
+	   it with the suppressed trailing zeros.  */
+	i = j == 0 ? 18 : j == 2 ? ndigits : ndigits + k;
+	if (i < j1)
+	  i = j1;
+	j = sizeof (__ULong);
+	for (_REENT_MP_RESULT_K(ptr) = 0;
+	     sizeof (_Bigint) - sizeof (__ULong) + j <= i; j <<= 1)
+	  _REENT_MP_RESULT_K(ptr)++;
+	_REENT_MP_RESULT(ptr) = eBalloc (ptr, _REENT_MP_RESULT_K(ptr));
+	s0 = (char *) _REENT_MP_RESULT(ptr);
+	memcpy (s0, buf, j1);
+	s = s0 + j1;
+	*s = 0;
+	*decpt = k;
+	if (rve)
+	  *rve = s;
+	return s0;
+      }
+  }
+#endif
+
   b = d2b (ptr, d.d, &be, &bbits);
 #ifdef Sudden_Underflow
   i = (int) (word0 (d) >> Exp_shift1 & (Exp_mask >> Exp_shift1));
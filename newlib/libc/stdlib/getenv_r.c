@@ -64,6 +64,158 @@ extern char **environ;
    'environ'.  */
 static char ***p_environ = &environ;
 
+/*
+ * Index of the names in environ, so that lookups do not have to scan
+ * it.  It is built on the first lookup and again whenever environ has
+ * been assigned a different array or the application has changed its
+ * entries in place, which a copy of them shows; _setenv_r tells it of
+ * the variables it sets and _unsetenv_r throws it away.
+ */
+static struct
+{
+  char **env;			/* environ the index is for */
+  char **entries;		/* copy of env[0..count), room for slots/2 */
+  int count;			/* entries in env */
+  int mask;			/* number of slots - 1 */
+  int *slots;			/* offsets into env, -1 if free */
+} env_index;
+
+#define ENV_INDEX_MIN	16
+
+unsigned int __env_generation;
+
+static unsigned int
+env_hash (const char *name,
+	int len)
+{
+  unsigned int h = 2166136261u;
+
+  while (len-- > 0)
+    h = (h ^ (unsigned char) *name++) * 16777619u;
+  return h;
+}
+
+/* Return the slot of name in the index, or the free slot where it goes.  */
+static int *
+env_slot (const char *name,
+	int len)
+{
+  int i = env_hash (name, len) & env_index.mask;
+  int *slot;
+  char *e;
+
+  for (;; i = (i + 1) & env_index.mask)
+    {
+      slot = &env_index.slots[i];
+      if (*slot < 0)
+	return slot;
+      e = env_index.env[*slot];
+      if (!strncmp (e, name, len) && e[len] == '=')
+	return slot;
+    }
+}
+
+/* Whether the index is for environ as it is now.  */
+static int
+env_index_current (void)
+{
+  char **env = *p_environ;
+
+  return env_index.env == env && env[env_index.count] == NULL
+	 && !memcmp (env_index.entries, env,
+		     env_index.count * sizeof (char *));
+}
+
+static void
+env_index_insert (int offset)
+{
+  char *e = env_index.env[offset];
+  char *c = strchr (e, '=');
+  int *slot;
+
+  if (c)
+    {
+      slot = env_slot (e, c - e);
+      if (*slot < 0)		/* the first of several wins */
+	*slot = offset;
+    }
+}
+
+/* Build the index for the current environ.  Returns 0 if out of memory.  */
+static int
+env_index_build (struct _reent *reent_ptr)
+{
+  char **env = *p_environ;
+  char **entries;
+  int count, size, i;
+
+  for (count = 0; env[count]; count++)
+    ;
+  for (size = ENV_INDEX_MIN; size < 2 * count; size *= 2)
+    ;
+  if (size != env_index.mask + 1)
+    {
+      /* the copy of the entries first, then the slots */
+      entries = (char **) _realloc_r (reent_ptr, env_index.entries,
+				      size / 2 * sizeof (char *)
+				      + size * sizeof (int));
+      if (!entries)
+	{
+	  env_index.env = NULL;
+	  return 0;
+	}
+      env_index.entries = entries;
+      env_index.slots = (int *) (entries + size / 2);
+      env_index.mask = size - 1;
+    }
+  memset (env_index.slots, -1, size * sizeof (int));
+  memcpy (env_index.entries, env, count * sizeof (char *));
+  env_index.env = env;
+  env_index.count = count;
+  for (i = 0; i < count; i++)
+    env_index_insert (i);
+  return 1;
+}
+
+/*
+ * __env_index_add --
+ *	Called by _setenv_r with the environment locked after it has put
+ *	a variable at offset, either in place of the one it found there or
+ *	new, at the end of a possibly reallocated environ.
+ */
+void
+__env_index_add (struct _reent *reent_ptr,
+	int offset)
+{
+  if (!env_index.env)
+    return;
+  if (offset < env_index.count)
+    {
+      env_index.entries[offset] = (*p_environ)[offset];
+      return;
+    }
+  if (offset != env_index.count || 2 * (offset + 1) > env_index.mask + 1)
+    {
+      env_index.env = NULL;	/* rebuild it at the next lookup */
+      return;
+    }
+  env_index.env = *p_environ;
+  env_index.entries[offset] = (*p_environ)[offset];
+  env_index.count++;
+  env_index_insert (offset);
+}
+
+/*
+ * __env_index_reset --
+ *	Called by _unsetenv_r with the environment locked after it has
+ *	removed variables from environ.
+ */
+void
+__env_index_reset (struct _reent *reent_ptr)
+{
+  env_index.env = NULL;
+}
+
 /*
  * _findenv --
  *	Returns pointer to value associated with name, if any, else NULL.
@@ -81,6 +233,7 @@ _findenv_r (struct _reent *reent_ptr,
   register int len;
   register char **p;
   const char *c;
+  int *slot;
 
   ENV_LOCK;
 
@@ -99,6 +252,18 @@ _findenv_r (struct _reent *reent_ptr,
   if(*c != '=')
     {
     len = c - name;
+    if (env_index_current () || env_index_build (reent_ptr))
+      {
+	slot = env_slot (name, len);
+	if (*slot >= 0)
+	  {
+	    *offset = *slot;
+	    ENV_UNLOCK;
+	    return (*p_environ)[*slot] + len + 1;
+	  }
+	ENV_UNLOCK;
+	return NULL;
+      }
     for (p = *p_environ; *p; ++p)
       if (!strncmp (*p, name, len))
         if (*(c = *p + len) == '=')
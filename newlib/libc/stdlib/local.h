@@ -52,6 +52,13 @@ mbtowc_f __big5_mbtowc;
 
 #define __MBTOWC (__get_current_locale ()->mbtowc)
 
+#ifdef _MB_CAPABLE
+/* Bulk conversions for the UTF-8 charset, used by the string conversion
+   functions when __MBTOWC or __WCTOMB is the UTF-8 one.  */
+size_t __utf8_mbsntowcs (wchar_t *, const char **, size_t, size_t);
+size_t __utf8_wcsntombs (char *, const wchar_t **, size_t, size_t);
+#endif
+
 extern wchar_t __iso_8859_conv[14][0x60];
 int __iso_8859_val_index (int);
 int __iso_8859_index (const char *);
@@ -170,6 +170,13 @@ int _dummy_mallocr = 1;
      MALLOC_LOCK may be called more than once before the corresponding
      MALLOC_UNLOCK calls.  MALLOC_LOCK must avoid waiting for a lock
      that it already holds.
+  MALLOC_TCACHE		   (default: NOT defined)
+     Define this to keep a small cache of recently freed chunks for
+     each struct _reent.  malloc and free are served from the cache of
+     the reentrancy pointer they are passed, without MALLOC_LOCK.  This
+     relies on each struct _reent other than _GLOBAL_REENT being used
+     by only one thread at a time; the global one is never cached.
+     Requires INTERNAL_NEWLIB.
   MALLOC_ALIGNMENT          (default: NOT defined)
      Define this to 16 if you need 16 byte alignment instead of 8 byte alignment
      which is the normal default.
@@ -311,6 +318,12 @@ extern "C" {
 #define MALLOC_LOCK __malloc_lock(reent_ptr)
 #define MALLOC_UNLOCK __malloc_unlock(reent_ptr)
 
+/* Only if the port gives each thread its own struct _reent */
+#if defined (_MALLOC_TCACHE) && !defined (__SINGLE_THREAD__) \
+    && !defined (SMALL_MEMORY)
+#define MALLOC_TCACHE
+#endif
+
 #ifdef __CYGWIN__
 # undef _WIN32
 # undef WIN32
@@ -723,19 +736,19 @@ do {                                                                          \
 #include "/usr/include/malloc.h"
 #else
 
-/* SVID2/XPG mallinfo structure */
+/* SVID2/XPG mallinfo structure, as declared in newlib's <malloc.h> */
 
 struct mallinfo {
-  int arena;    /* total space allocated from system */
-  int ordblks;  /* number of non-inuse chunks */
-  int smblks;   /* unused -- always zero */
-  int hblks;    /* number of mmapped regions */
-  int hblkhd;   /* total space in mmapped regions */
-  int usmblks;  /* unused -- always zero */
-  int fsmblks;  /* unused -- always zero */
-  int uordblks; /* total allocated space */
-  int fordblks; /* total non-inuse space */
-  int keepcost; /* top-most, releasable (via malloc_trim) space */
+  size_t arena;    /* total space allocated from system */
+  size_t ordblks;  /* number of non-inuse chunks */
+  size_t smblks;   /* unused -- always zero */
+  size_t hblks;    /* number of mmapped regions */
+  size_t hblkhd;   /* total space in mmapped regions */
+  size_t usmblks;  /* unused -- always zero */
+  size_t fsmblks;  /* unused -- always zero */
+  size_t uordblks; /* total allocated space */
+  size_t fordblks; /* total non-inuse space */
+  size_t keepcost; /* top-most, releasable (via malloc_trim) space */
 };	
 
 /* SVID2/XPG mallopt options */
@@ -1017,6 +1030,7 @@ extern Void_t*     sbrk();
 #define malloc_usable_size		_malloc_usable_size_r
 
 #define malloc_update_mallinfo		__malloc_update_mallinfo
+#define malloc_tcache_reclaim		__malloc_tcache_reclaim
 
 #define malloc_av_			__malloc_av_
 #define malloc_current_mallinfo		__malloc_current_mallinfo
@@ -1025,6 +1039,7 @@ extern Void_t*     sbrk();
 #define malloc_sbrk_base		__malloc_sbrk_base
 #define malloc_top_pad			__malloc_top_pad
 #define malloc_trim_threshold		__malloc_trim_threshold
+#define malloc_tcache_list		__malloc_tcache_list
 
 #else /* ! INTERNAL_NEWLIB */
 
@@ -1755,6 +1770,51 @@ extern unsigned long max_mmapped_mem;
 /* The total memory obtained from system via sbrk */
 #define sbrked_mem  (current_mallinfo.arena)
 
+
+
+/*
+  Per-thread caches
+
+    With MALLOC_TCACHE, each struct _reent other than _GLOBAL_REENT
+    gets a cache of recently freed small chunks: one LIFO list for each
+    chunk size up to TCACHE_MAX_SIZE, linked through the fd fields and
+    holding at most TCACHE_COUNT chunks.  As far as the bins are
+    concerned, cached chunks are still in use.  Only the thread owning
+    the struct _reent pushes and pops them, so no lock is needed for
+    that.  The caches themselves are chained on tcache_list under
+    MALLOC_LOCK, so that mallinfo can count their chunks as free.
+*/
+
+#ifdef MALLOC_TCACHE
+
+#define TCACHE_MAX_SIZE   512
+#define TCACHE_COUNT        8
+#define TCACHE_BINS       ((TCACHE_MAX_SIZE - MINSIZE) / MALLOC_ALIGNMENT + 1)
+
+#define tcache_index(sz)  ((((unsigned long)(sz)) - MINSIZE) / MALLOC_ALIGNMENT)
+#define tcache_size(i)    (MINSIZE + (i) * MALLOC_ALIGNMENT)
+
+struct _malloc_tcache
+{
+  struct _malloc_tcache *next;        /* next cache on tcache_list */
+  mchunkptr chunks[TCACHE_BINS];      /* cached chunks of each size */
+  unsigned char counts[TCACHE_BINS];  /* length of each list */
+};
+
+#ifdef SEPARATE_OBJECTS
+#define tcache_list		malloc_tcache_list
+#endif
+
+#ifdef DEFINE_MALLOC
+STATIC struct _malloc_tcache *tcache_list = 0;
+#else
+extern struct _malloc_tcache *tcache_list;
+#endif
+
+void malloc_tcache_reclaim(RONEARG);
+
+#endif /* MALLOC_TCACHE */
+
 
 
 /* 
@@ -2349,6 +2409,9 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
   mchunkptr fwd;                     /* misc temp for linking */
   mchunkptr bck;                     /* misc temp for linking */
   mbinptr q;                         /* misc temp */
+#ifdef MALLOC_TCACHE
+  struct _malloc_tcache *tc;         /* this thread's cache */
+#endif
 
   INTERNAL_SIZE_T nb  = request2size(bytes);  /* padded request size; */
 
@@ -2359,6 +2422,23 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
     return 0;
   }
 
+#ifdef MALLOC_TCACHE
+  /* Reuse a chunk this thread freed, without locking */
+
+  tc = _REENT_MALLOC_TCACHE(reent_ptr);
+  if (tc != 0 && nb <= TCACHE_MAX_SIZE)
+  {
+    idx = tcache_index(nb);
+    victim = tc->chunks[idx];
+    if (victim != 0)
+    {
+      tc->chunks[idx] = victim->fd;
+      tc->counts[idx]--;
+      return chunk2mem(victim);
+    }
+  }
+#endif
+
   MALLOC_LOCK;
 
   /* Check for exact match in a bin */
@@ -2624,18 +2704,11 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
 
 
 #if __STD_C
-void fREe(RARG Void_t* mem)
+static void free_chunk(RARG mchunkptr p)
 #else
-void fREe(RARG mem) RDECL Void_t* mem;
+static void free_chunk(RARG p) RDECL mchunkptr p;
 #endif
 {
-#ifdef MALLOC_PROVIDED
-
-  free (mem);
-
-#else
-
-  mchunkptr p;         /* chunk corresponding to mem */
   INTERNAL_SIZE_T hd;  /* its head field */
   INTERNAL_SIZE_T sz;  /* its size */
   int       idx;       /* its bin index */
@@ -2646,12 +2719,8 @@ void fREe(RARG mem) RDECL Void_t* mem;
   mchunkptr fwd;       /* misc temp for linking */
   int       islr;      /* track whether merging with last_remainder */
 
-  if (mem == 0)                              /* free(0) has no effect */
-    return;
-
   MALLOC_LOCK;
 
-  p = mem2chunk(mem);
   hd = p->size;
 
 #if HAVE_MMAP
@@ -2725,6 +2794,131 @@ void fREe(RARG mem) RDECL Void_t* mem;
     frontlink(p, sz, idx, bck, fwd);  
 
   MALLOC_UNLOCK;
+}
+
+#ifdef MALLOC_TCACHE
+
+/*
+  Create the cache of the calling thread, on its first free of a small
+  chunk.  mALLOc never creates one, so allocating it cannot recurse.
+*/
+
+#if __STD_C
+static struct _malloc_tcache* tcache_create(RONEARG)
+#else
+static struct _malloc_tcache* tcache_create(RONEARG) RDECL
+#endif
+{
+  struct _malloc_tcache* tc;
+  int err = RERRNO;
+
+  MALLOC_LOCK;
+  tc = (struct _malloc_tcache*)(mALLOc(RCALL sizeof(struct _malloc_tcache)));
+  if (tc != 0)
+  {
+    MALLOC_ZERO(tc, sizeof(struct _malloc_tcache));
+    tc->next = tcache_list;
+    tcache_list = tc;
+    _REENT_MALLOC_TCACHE(reent_ptr) = tc;
+  }
+  else
+    RERRNO = err;
+  MALLOC_UNLOCK;
+  return tc;
+}
+
+/*
+  Keep chunk p in the cache of the calling thread if it is small
+  enough and there is room.  Returns nonzero if it was kept.
+*/
+
+#if __STD_C
+static int tcache_put(RARG mchunkptr p)
+#else
+static int tcache_put(RARG p) RDECL mchunkptr p;
+#endif
+{
+  struct _malloc_tcache* tc;
+  INTERNAL_SIZE_T sz = p->size & ~PREV_INUSE;  /* misaligned if mmapped */
+  int idx;
+
+  if (sz > TCACHE_MAX_SIZE || (sz & MALLOC_ALIGN_MASK) != 0
+      || reent_ptr == _GLOBAL_REENT)
+    return 0;
+
+  tc = _REENT_MALLOC_TCACHE(reent_ptr);
+  if (tc == 0 && (tc = tcache_create(RONECALL)) == 0)
+    return 0;
+
+  idx = tcache_index(sz);
+  if (tc->counts[idx] >= TCACHE_COUNT)
+    return 0;
+  p->fd = tc->chunks[idx];
+  tc->chunks[idx] = p;
+  tc->counts[idx]++;
+  return 1;
+}
+
+/*
+  malloc_tcache_reclaim returns the chunks cached for reent_ptr to the
+  bins and releases the cache.  _reclaim_reent calls it when the
+  thread owning reent_ptr is gone.
+*/
+
+#if __STD_C
+void malloc_tcache_reclaim(RONEARG)
+#else
+void malloc_tcache_reclaim(RONEARG) RDECL
+#endif
+{
+  struct _malloc_tcache* tc = _REENT_MALLOC_TCACHE(reent_ptr);
+  struct _malloc_tcache** tp;
+  mchunkptr p;
+  int i;
+
+  if (tc == 0)
+    return;
+
+  MALLOC_LOCK;
+  _REENT_MALLOC_TCACHE(reent_ptr) = 0;
+  for (tp = &tcache_list; *tp != tc; tp = &(*tp)->next)
+    ;
+  *tp = tc->next;
+  for (i = 0; i < TCACHE_BINS; i++)
+  {
+    while ((p = tc->chunks[i]) != 0)
+    {
+      tc->chunks[i] = p->fd;
+      free_chunk(RCALL p);
+    }
+  }
+  free_chunk(RCALL mem2chunk(tc));
+  MALLOC_UNLOCK;
+}
+
+#endif /* MALLOC_TCACHE */
+
+#if __STD_C
+void fREe(RARG Void_t* mem)
+#else
+void fREe(RARG mem) RDECL Void_t* mem;
+#endif
+{
+#ifdef MALLOC_PROVIDED
+
+  free (mem);
+
+#else
+
+  if (mem == 0)                              /* free(0) has no effect */
+    return;
+
+#ifdef MALLOC_TCACHE
+  if (tcache_put(RCALL mem2chunk(mem)))
+    return;
+#endif
+
+  free_chunk(RCALL mem2chunk(mem));
 
 #endif /* MALLOC_PROVIDED */
 }
@@ -3427,6 +3621,9 @@ STATIC void malloc_update_mallinfo()
 #if DEBUG
   mchunkptr q;
 #endif
+#ifdef MALLOC_TCACHE
+  struct _malloc_tcache *tc;
+#endif
 
   INTERNAL_SIZE_T avail = chunksize(top);
   int   navail = ((long)(avail) >= (long)MINSIZE)? 1 : 0;
@@ -3448,6 +3645,18 @@ STATIC void malloc_update_mallinfo()
     }
   }
 
+#ifdef MALLOC_TCACHE
+  /* Chunks in the per-thread caches are free too */
+  for (tc = tcache_list; tc != 0; tc = tc->next)
+  {
+    for (i = 0; i < TCACHE_BINS; ++i)
+    {
+      avail += tc->counts[i] * tcache_size(i);
+      navail += tc->counts[i];
+    }
+  }
+#endif
+
   current_mallinfo.ordblks = navail;
   current_mallinfo.uordblks = sbrked_mem - avail;
   current_mallinfo.fordblks = avail;
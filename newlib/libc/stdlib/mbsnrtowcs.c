@@ -69,6 +69,7 @@ PORTABILITY
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include "local.h"
 
 size_t
 _mbsnrtowcs_r (struct _reent *r,
@@ -104,6 +105,23 @@ _mbsnrtowcs_r (struct _reent *r,
   max = len;
   while (len > 0)
     {
+#ifdef _MB_CAPABLE
+      if (__MBTOWC == __utf8_mbtowc && ps->__count == 0)
+	{
+	  /* Convert what can be converted in one go, the loop below only
+	     deals with what stops it.  */
+	  const char *start = *src;
+	  size_t n = __utf8_mbsntowcs (ptr, src, nms, len);
+
+	  nms -= *src - start;
+	  count += n;
+	  len -= n;
+	  if (ptr != NULL)
+	    ptr += n;
+	  if (len == 0)
+	    break;
+	}
+#endif
       bytes = _mbrtowc_r (r, ptr, *src, nms, ps);
       if (bytes > 0)
 	{
@@ -17,6 +17,22 @@ _mbstowcs_r (struct _reent *r,
     n = (size_t) 1; /* Value doesn't matter as long as it's not 0. */
   while (n > 0)
     {
+#ifdef _MB_CAPABLE
+      if (__MBTOWC == __utf8_mbtowc && state->__count == 0)
+	{
+	  size_t count = __utf8_mbsntowcs (pwcs, (const char **) &t,
+					   (size_t) -1,
+					   pwcs ? n : (size_t) -1);
+
+	  ret += count;
+	  if (pwcs)
+	    {
+	      pwcs += count;
+	      if ((n -= count) == 0)
+		break;
+	    }
+	}
+#endif
       bytes = __MBTOWC (r, pwcs, t, MB_CUR_MAX, state);
       if (bytes < 0)
 	{
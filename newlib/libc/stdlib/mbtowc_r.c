@@ -723,6 +723,115 @@ __utf8_mbtowc (struct _reent *r,
   return -1;
 }
 
+/* Convert the complete, valid UTF-8 characters at *SRC, at most NMS
+   bytes, to at most LEN wide characters at DST, or just count them if
+   DST is NULL.  Advances *SRC past the converted bytes and returns the
+   number of wide characters produced.  Stops before a NUL byte, an
+   invalid or truncated sequence, or a character which does not fit in
+   LEN; those are left to __utf8_mbtowc.  The conversion itself is
+   the same as __utf8_mbtowc's, including surrogate pairs for 16-bit
+   wchar_t.  */
+size_t
+__utf8_mbsntowcs (wchar_t *dst,
+        const char     **src,
+        size_t         nms,
+        size_t         len)
+{
+  /* A word with all bytes 0x01, and one with all bytes 0x80.  */
+  const unsigned long ones = (unsigned long) -1 / 0xff;
+  const unsigned long highs = ones << 7;
+  const unsigned char *t = (const unsigned char *) *src;
+  size_t count = 0;
+  wint_t ch, c1, c2, c3;
+  unsigned long w;
+  int i;
+
+  while (count < len && nms > 0)
+    {
+      ch = *t;
+      if (ch < 0x80)
+	{
+	  if (ch == 0)
+	    break;
+	  /* Runs of ASCII are checked and copied a word at a time.  A
+	     word holds no NUL and no byte above 0x7f iff no byte has its
+	     top bit set either in it or after subtracting 1.  */
+	  if (((unsigned long) t & (sizeof w - 1)) == 0)
+	    while (nms >= sizeof w && len - count >= sizeof w)
+	      {
+		w = *(const unsigned long *) t;
+		if ((w | (w - ones)) & highs)
+		  break;
+		if (dst)
+		  for (i = 0; i < (int) sizeof w; i++)
+		    *dst++ = t[i];
+		t += sizeof w;
+		nms -= sizeof w;
+		count += sizeof w;
+	      }
+	  if (count == len || nms == 0 || (ch = *t) >= 0x80 || ch == 0)
+	    continue;
+	  if (dst)
+	    *dst++ = ch;
+	  t++;
+	  nms--;
+	  count++;
+	}
+      else if (ch >= 0xc2 && ch <= 0xdf)
+	{
+	  if (nms < 2 || (c1 = t[1]) < 0x80 || c1 > 0xbf)
+	    break;
+	  if (dst)
+	    *dst++ = ((ch & 0x1f) << 6) | (c1 & 0x3f);
+	  t += 2;
+	  nms -= 2;
+	  count++;
+	}
+      else if (ch >= 0xe0 && ch <= 0xef)
+	{
+	  if (nms < 3 || (c1 = t[1]) < (ch == 0xe0 ? 0xa0 : 0x80)
+	      || c1 > 0xbf || (c2 = t[2]) < 0x80 || c2 > 0xbf)
+	    break;
+	  if (dst)
+	    *dst++ = ((ch & 0x0f) << 12) | ((c1 & 0x3f) << 6) | (c2 & 0x3f);
+	  t += 3;
+	  nms -= 3;
+	  count++;
+	}
+      else if (ch >= 0xf0 && ch <= 0xf4)
+	{
+	  if (nms < 4 || (c1 = t[1]) < (ch == 0xf0 ? 0x90 : 0x80)
+	      || c1 > (ch == 0xf4 ? 0x8f : 0xbf)
+	      || (c2 = t[2]) < 0x80 || c2 > 0xbf
+	      || (c3 = t[3]) < 0x80 || c3 > 0xbf)
+	    break;
+	  ch = ((ch & 0x07) << 18) | ((c1 & 0x3f) << 12) | ((c2 & 0x3f) << 6)
+	       | (c3 & 0x3f);
+	  if (sizeof (wchar_t) == 2)
+	    {
+	      /* A surrogate pair; both halves must fit.  */
+	      if (len - count < 2)
+		break;
+	      if (dst)
+		{
+		  *dst++ = 0xd800 | ((ch - 0x10000) >> 10);
+		  *dst++ = 0xdc00 | (ch & 0x3ff);
+		}
+	      count++;
+	    }
+	  else if (dst)
+	    *dst++ = ch;
+	  t += 4;
+	  nms -= 4;
+	  count++;
+	}
+      else
+	break;
+    }
+  *src = (const char *) t;
+  return count;
+}
+
 /* Cygwin defines its own doublebyte charset conversion functions 
    because the underlying OS requires wchar_t == UTF-16. */
 #ifndef  __CYGWIN__
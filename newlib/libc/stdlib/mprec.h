@@ -340,6 +340,8 @@ typedef struct _Bigint _Bigint;
 #define gethex  __gethex
 #define copybits 	__copybits
 #define hexnan	__hexnan
+#define dtoa_fast	__dtoa_fast
+#define strtod_fast	__strtod_fast
 
 #define eBalloc(__reent_ptr, __len) ({ \
    void *__ptr = Balloc(__reent_ptr, __len); \
@@ -354,6 +356,17 @@ typedef struct _Bigint _Bigint;
 #define __get_hexdig(x) __hexdig_fun(x)
 #endif /* !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) && !defined(_SMALL_HEXDIG) */
 
+/* Table driven conversions for the common _dtoa_r modes and for
+   _strtod_l, see dtoa_fast.c.  Needs 64-bit arithmetic and the IEEE
+   double format.  */
+#if !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && defined(IEEE_Arith) && !defined(_DOUBLE_IS_32BITS) \
+    && (defined __GNUC__ || __STDC_VERSION__ >= 199901L)
+#define _DTOA_FAST
+/* Most digits dtoa_fast produces, plus one.  */
+#define DTOA_FAST_NDIG 18
+#endif
+
 #define tens __mprec_tens
 #define bigtens __mprec_bigtens
 #define tinytens __mprec_tinytens
@@ -378,6 +391,11 @@ _Bigint *	diff (struct _reent *p, _Bigint *a, _Bigint *b);
 int		cmp (_Bigint *a, _Bigint *b);
 int		gethex (struct _reent *p, const char **sp, const struct FPI *fpi, Long *exp, _Bigint **bp, int sign, locale_t loc);
 double		ratio (_Bigint *a, _Bigint *b);
+#ifdef _DTOA_FAST
+int		dtoa_fast (double d, int mode, int ndigits, char *buf, int *decpt);
+int		strtod_fast (const char *s, int nd0, int nd, int dec_len, int e,
+			     double *rv);
+#endif
 __ULong		any_on (_Bigint *b, int k);
 void		copybits (__ULong *c, int n, _Bigint *b);
 double		_strtod_l (struct _reent *ptr, const char *__restrict s00,
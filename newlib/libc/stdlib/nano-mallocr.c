@@ -105,6 +105,9 @@
 #define free_list __malloc_free_list
 #define sbrk_start __malloc_sbrk_start
 #define current_mallinfo __malloc_current_mallinfo
+#define free_bins __malloc_free_bins
+#define free_bin_map __malloc_free_bin_map
+#define heap_end __malloc_heap_end
 
 #define ALIGN_TO(size, align) \
     (((size) + (align) -1L) & ~((align) -1L))
@@ -116,7 +119,12 @@
 
 /* as well as the minimal allocation size
  * to hold a free pointer */
+#ifdef _NANO_MALLOC_BINS
+/* or, with bins, two pointers and the size at the end of a free chunk */
+#define MALLOC_MINSIZE (2 * sizeof(void *) + sizeof(long))
+#else
 #define MALLOC_MINSIZE (sizeof(void *))
+#endif
 #define MALLOC_PAGE_ALIGN (0x1000)
 #define MAX_ALLOC_SIZE (0x80000000U)
 
@@ -149,6 +157,10 @@ typedef struct malloc_chunk
 
     /* since here, the memory is either the next free block, or data load */
     struct malloc_chunk * next;
+#ifdef _NANO_MALLOC_BINS
+    /* and the previous free block in the same bin */
+    struct malloc_chunk * prev;
+#endif
 }chunk;
 
 
@@ -158,10 +170,36 @@ typedef struct malloc_chunk
  * won't be able to create a chunk */
 #define MALLOC_MINCHUNK (CHUNK_OFFSET + MALLOC_PADDING + MALLOC_MINSIZE)
 
+#ifdef _NANO_MALLOC_BINS
+/* Free chunks are kept in NBINS lists by size rather than in one
+ * list by address: two bins for each power of two from 16 bytes, the
+ * last bin taking all larger chunks.  Bit i of free_bin_map is set
+ * while free_bins[i] is not empty, so malloc finds a large enough chunk
+ * without looking at smaller ones.  To merge neighbours without a
+ * search, the low bits of size tell whether the chunk and the one
+ * before it are free, and a free chunk ends with a copy of its size.
+ * heap_end is a chunk of size 0 that is never free, after the last
+ * chunk of the heap. */
+#define NBINS 32
+#define BIN_SHIFT 4
+#define CHUNK_FREE 1L
+#define PREV_FREE 2L
+#define CHUNK_SIZE(c) ((malloc_size_t)((c)->size & ~(CHUNK_FREE | PREV_FREE)))
+#define NEXT_CHUNK(c) ((chunk *)((char *)(c) + CHUNK_SIZE(c)))
+#define PREV_CHUNK(c) ((chunk *)((char *)(c) - ((long *)(c))[-1]))
+#else
+#define CHUNK_SIZE(c) ((c)->size)
+#endif
+
 /* Forward data declarations */
 extern chunk * free_list;
 extern char * sbrk_start;
 extern struct mallinfo current_mallinfo;
+#ifdef _NANO_MALLOC_BINS
+extern chunk * free_bins[NBINS];
+extern unsigned long free_bin_map;
+extern chunk * heap_end;
+#endif
 
 /* Forward function declarations */
 extern void * nano_malloc(RARG malloc_size_t);
@@ -189,13 +227,65 @@ static inline chunk * get_chunk_from_ptr(void * ptr)
     return c;
 }
 
+#ifdef _NANO_MALLOC_BINS
+static inline int bin_index(malloc_size_t size)
+{
+    int log = sizeof(long) * 8 - 1 - __builtin_clzl(size);
+    int i = (log - BIN_SHIFT) * 2 + ((size >> (log - 1)) & 1);
+
+    return i < NBINS ? i : NBINS - 1;
+}
+
+/* Make the size bytes at c a free chunk and put it in its bin */
+static inline void bin_chunk(chunk * c, malloc_size_t size)
+{
+    int i = bin_index(size);
+
+    c->size = size | CHUNK_FREE;
+    ((long *)((char *)c + size))[-1] = size;
+    NEXT_CHUNK(c)->size |= PREV_FREE;
+    c->prev = NULL;
+    c->next = free_bins[i];
+    if (c->next != NULL)
+        c->next->prev = c;
+    free_bins[i] = c;
+    free_bin_map |= 1UL << i;
+}
+
+/* Take free chunk c out of its bin */
+static inline void unbin_chunk(chunk * c)
+{
+    int i;
+
+    if (c->next != NULL)
+        c->next->prev = c->prev;
+    if (c->prev != NULL)
+        c->prev->next = c->next;
+    else
+    {
+        i = bin_index(CHUNK_SIZE(c));
+        if ((free_bins[i] = c->next) == NULL)
+            free_bin_map &= ~(1UL << i);
+    }
+}
+#endif
+
 #ifdef DEFINE_MALLOC
 /* List list header of free blocks */
 chunk * free_list = NULL;
 
+#ifdef _NANO_MALLOC_BINS
+/* Free blocks by size, which of those lists are not empty, and the
+ * end of the heap */
+chunk * free_bins[NBINS];
+unsigned long free_bin_map = 0;
+chunk * heap_end = NULL;
+#endif
+
 /* Starting point of memory allocated from system */
 char * sbrk_start = NULL;
 
+#ifndef _NANO_MALLOC_BINS
 /** Function sbrk_aligned
   * Algorithm:
   *   Use sbrk() to obtain more memory and ensure it is CHUNK_ALIGN aligned
@@ -226,14 +316,104 @@ static void* sbrk_aligned(RARG malloc_size_t s)
     return align_p;
 }
 
+#else /* _NANO_MALLOC_BINS */
+/** Function bin_fit
+  * Algorithm:
+  *   Take the first large enough chunk in the bin of alloc_size, or
+  *   else the first chunk of the next non-empty bin, which is large
+  *   enough whatever its size.  Return the part beyond alloc_size to
+  *   its bin.  Return NULL if there is no large enough chunk.
+  */
+static chunk * bin_fit(malloc_size_t alloc_size)
+{
+    int i = bin_index(alloc_size);
+    unsigned long map = free_bin_map & (~1UL << i);
+    malloc_size_t size;
+    chunk * r;
+
+    for (r = free_bins[i]; r != NULL; r = r->next)
+        if (CHUNK_SIZE(r) >= alloc_size)
+            break;
+    if (r == NULL)
+    {
+        if (map == 0)
+            return NULL;
+        r = free_bins[__builtin_ctzl(map)];
+    }
+
+    unbin_chunk(r);
+    size = CHUNK_SIZE(r);
+    if (size - alloc_size >= MALLOC_MINCHUNK)
+    {
+        bin_chunk((chunk *)((char *)r + alloc_size), size - alloc_size);
+        size = alloc_size;
+    }
+    else
+        NEXT_CHUNK(r)->size &= ~PREV_FREE;
+    r->size = size;
+    return r;
+}
+
+/** Function heap_grow
+  * Algorithm:
+  *   Use sbrk() to get a chunk of alloc_size bytes at the end of the
+  *   heap, reusing the free chunk there if there is one.  If the break
+  *   has moved since the heap last grew, start a new CHUNK_ALIGN aligned
+  *   piece of heap instead.  Return NULL if sbrk fails.
+  */
+static chunk * heap_grow(RARG malloc_size_t alloc_size)
+{
+    malloc_size_t incr = alloc_size;
+    chunk * r = heap_end;
+    char * p, * align_p;
+
+    if (sbrk_start == NULL) sbrk_start = _SBRK_R(RCALL 0);
+
+    /* bin_fit has failed, so a free chunk there is too small */
+    if (r != NULL && (r->size & PREV_FREE))
+    {
+        r = PREV_CHUNK(r);
+        incr -= CHUNK_SIZE(r);
+    }
+
+    p = _SBRK_R(RCALL incr);
+
+    /* sbrk returns -1 if fail to allocate */
+    if (p == (void *)-1)
+        return NULL;
+
+    if (heap_end == NULL || p != (char *)heap_end + CHUNK_OFFSET)
+    {
+        /* Ask for the rest of alloc_size bytes and an end marker from
+         * align_p */
+        align_p = (char*)ALIGN_TO((unsigned long)p, CHUNK_ALIGN);
+        if (_SBRK_R(RCALL align_p + alloc_size + CHUNK_OFFSET - (p + incr))
+            != p + incr)
+            return NULL;
+        r = (chunk *)align_p;
+    }
+    else if (r != heap_end)
+        unbin_chunk(r);
+
+    r->size = alloc_size;
+    heap_end = NEXT_CHUNK(r);
+    heap_end->size = 0;
+    return r;
+}
+#endif /* _NANO_MALLOC_BINS */
+
 /** Function nano_malloc
   * Algorithm:
   *   Walk through the free list to find the first match. If fails to find
   *   one, call sbrk to allocate a new chunk.
+  *   With _NANO_MALLOC_BINS, look in the bins instead of walking a list.
   */
 void * nano_malloc(RARG malloc_size_t s)
 {
-    chunk *p, *r;
+    chunk *r;
+#ifndef _NANO_MALLOC_BINS
+    chunk *p;
+#endif
     char * ptr, * align_ptr;
     int offset;
 
@@ -252,6 +432,17 @@ void * nano_malloc(RARG malloc_size_t s)
 
     MALLOC_LOCK;
 
+#ifdef _NANO_MALLOC_BINS
+    r = bin_fit(alloc_size);
+    if (r == NULL)
+        r = heap_grow(RCALL alloc_size);
+    if (r == NULL)
+    {
+        RERRNO = ENOMEM;
+        MALLOC_UNLOCK;
+        return NULL;
+    }
+#else
     p = free_list;
     r = p;
 
@@ -301,6 +492,7 @@ void * nano_malloc(RARG malloc_size_t s)
         }
         r->size = alloc_size;
     }
+#endif
     MALLOC_UNLOCK;
 
     ptr = (char *)r + CHUNK_OFFSET;
@@ -334,6 +526,49 @@ void * nano_malloc(RARG malloc_size_t s)
 #ifdef DEFINE_FREE
 #define MALLOC_CHECK_DOUBLE_FREE
 
+#ifdef _NANO_MALLOC_BINS
+/** Function nano_free
+  * Implementation of libc free.
+  * Algorithm:
+  *  Merge the to-be-freed chunk with its neighbours if they are free,
+  *  taking them out of their bins, and put the result in its bin.
+  */
+void nano_free (RARG void * free_p)
+{
+    chunk * p_to_free, * next;
+    malloc_size_t size;
+
+    if (free_p == NULL) return;
+
+    p_to_free = get_chunk_from_ptr(free_p);
+
+    MALLOC_LOCK;
+#ifdef MALLOC_CHECK_DOUBLE_FREE
+    if (p_to_free->size & CHUNK_FREE)
+    {
+        /* Report double free fault */
+        RERRNO = ENOMEM;
+        MALLOC_UNLOCK;
+        return;
+    }
+#endif
+    size = CHUNK_SIZE(p_to_free);
+    next = NEXT_CHUNK(p_to_free);
+    if (next->size & CHUNK_FREE)
+    {
+        unbin_chunk(next);
+        size += CHUNK_SIZE(next);
+    }
+    if (p_to_free->size & PREV_FREE)
+    {
+        p_to_free = PREV_CHUNK(p_to_free);
+        unbin_chunk(p_to_free);
+        size += CHUNK_SIZE(p_to_free);
+    }
+    bin_chunk(p_to_free, size);
+    MALLOC_UNLOCK;
+}
+#else /* _NANO_MALLOC_BINS */
 /** Function nano_free
   * Implementation of libc free.
   * Algorithm:
@@ -431,6 +666,7 @@ void nano_free (RARG void * free_p)
     }
     MALLOC_UNLOCK;
 }
+#endif /* _NANO_MALLOC_BINS */
 #endif /* DEFINE_FREE */
 
 #ifdef DEFINE_CFREE
@@ -491,6 +727,9 @@ struct mallinfo nano_mallinfo(RONEARG)
     chunk * pf;
     size_t free_size = 0;
     size_t total_size;
+#ifdef _NANO_MALLOC_BINS
+    int i;
+#endif
 
     MALLOC_LOCK;
 
@@ -504,8 +743,19 @@ struct mallinfo nano_mallinfo(RONEARG)
             total_size = (size_t) (sbrk_now - sbrk_start);
     }
 
+#ifdef _NANO_MALLOC_BINS
+    for (i = 0; i < NBINS; i++)
+        for (pf = free_bins[i]; pf; pf = pf->next)
+            free_size += CHUNK_SIZE(pf);
+
+    /* The end marker is part of no block, so count it in neither, as the
+     * heap without bins has none */
+    if (heap_end != NULL && total_size != (size_t)-1)
+        total_size -= CHUNK_OFFSET;
+#else
     for (pf = free_list; pf; pf = pf->next)
         free_size += pf->size;
+#endif
 
     current_mallinfo.arena = total_size;
     current_mallinfo.fordblks = free_size;
@@ -539,9 +789,9 @@ malloc_size_t nano_malloc_usable_size(RARG void * ptr)
     {
         /* Padding is used. Excluding the padding size */
         c = (chunk *)((char *)c + c->size);
-        return c->size - CHUNK_OFFSET + size_or_offset;
+        return CHUNK_SIZE(c) - CHUNK_OFFSET + size_or_offset;
     }
-    return c->size - CHUNK_OFFSET;
+    return CHUNK_SIZE(c) - CHUNK_OFFSET;
 }
 #endif /* DEFINE_MALLOC_USABLE_SIZE */
 
@@ -587,8 +837,8 @@ void * nano_memalign(RARG size_t align, size_t s)
             /* Padding is too large, free it */
             chunk * front_chunk = chunk_p;
             chunk_p = (chunk *)((char *)chunk_p + offset);
-            chunk_p->size = front_chunk->size - offset;
-            front_chunk->size = offset;
+            chunk_p->size = CHUNK_SIZE(front_chunk) - offset;
+            front_chunk->size -= chunk_p->size;
             nano_free(RCALL (char *)front_chunk + CHUNK_OFFSET);
         }
         else
@@ -600,15 +850,16 @@ void * nano_memalign(RARG size_t align, size_t s)
         }
     }
 
-    size_allocated = chunk_p->size;
+    size_allocated = CHUNK_SIZE(chunk_p);
     if ((char *)chunk_p + size_allocated >
          (aligned_p + ma_size + MALLOC_MINCHUNK))
     {
         /* allocated much more than what's required for padding, free
          * tail part */
         chunk * tail_chunk = (chunk *)(aligned_p + ma_size);
-        chunk_p->size = aligned_p + ma_size - (char *)chunk_p;
-        tail_chunk->size = size_allocated - chunk_p->size;
+        tail_chunk->size = (char *)chunk_p + size_allocated
+                           - (char *)tail_chunk;
+        chunk_p->size -= tail_chunk->size;
         nano_free(RCALL (char *)tail_chunk + CHUNK_OFFSET);
     }
     return aligned_p;
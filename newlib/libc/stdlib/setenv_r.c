@@ -37,8 +37,10 @@ extern char **environ;
    'environ'.  */
 static char ***p_environ = &environ;
 
-/* _findenv_r is defined in getenv_r.c.  */
+/* _findenv_r and the index it uses are defined in getenv_r.c.  */
 extern char *_findenv_r (struct _reent *, const char *, int *);
+extern void __env_index_add (struct _reent *, int);
+extern void __env_index_reset (struct _reent *);
 
 /*
  * _setenv_r --
@@ -77,6 +79,7 @@ _setenv_r (struct _reent *reent_ptr,
       if (strlen (C) >= l_value)
 	{			/* old larger; copy over */
 	  while ((*C++ = *value++) != 0);
+	  ENV_CHANGED;
           ENV_UNLOCK;
 	  return 0;
 	}
@@ -121,6 +124,8 @@ _setenv_r (struct _reent *reent_ptr,
     }
   for (C = (*p_environ)[offset]; (*C = *name++) && *C != '='; ++C);
   for (*C++ = '='; (*C++ = *value++) != 0;);
+  __env_index_add (reent_ptr, offset);
+  ENV_CHANGED;
 
   ENV_UNLOCK;
 
@@ -152,6 +157,8 @@ _unsetenv_r (struct _reent *reent_ptr,
       for (P = &(*p_environ)[offset];; ++P)
         if (!(*P = *(P + 1)))
 	  break;
+      __env_index_reset (reent_ptr);
+      ENV_CHANGED;
     }
 
   ENV_UNLOCK;
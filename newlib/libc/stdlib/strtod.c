@@ -554,6 +554,14 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 			}
 #endif
 		}
+#if defined (_DTOA_FAST) && !defined (Honor_FLT_ROUNDS) && !defined (SET_INEXACT)
+	/* Most other inputs are decided by one multiplication with a
+	 * power of ten from a table.
+	 */
+	if (Flt_Rounds == 1
+	 && strtod_fast(s0, nd0, nd, dec_len, e, &dval(rv)))
+		goto ret;
+#endif
 	e1 += nd - k;
 
 #ifdef IEEE_Arith
@@ -97,11 +97,32 @@ _wcsnrtombs_l (struct _reent *r, char *dst, const wchar_t **src, size_t nwc,
   n = 0;
   pwcs = (wchar_t *)(*src);
 
-  while (n < len && nwc-- > 0)
+  while (n < len && nwc > 0)
     {
+#ifdef _MB_CAPABLE
+      if (loc->wctomb == __utf8_wctomb && ps->__count == 0)
+	{
+	  /* Convert what can be converted in one go, the rest of the
+	     loop only deals with what stops it.  */
+	  const wchar_t *start = pwcs;
+	  size_t m = __utf8_wcsntombs (ptr, (const wchar_t **) &pwcs,
+				       nwc, len - n);
+
+	  n += m;
+	  nwc -= pwcs - start;
+	  if (dst)
+	    {
+	      ptr += m;
+	      *src = pwcs;
+	    }
+	  if (n == len || nwc == 0)
+	    break;
+	}
+#endif
       int count = ps->__count;
       wint_t wch = ps->__value.__wch;
       int bytes = loc->wctomb (r, buff, *pwcs, ps);
+      nwc--;
       if (bytes == -1)
 	{
 	  r->_errno = EILSEQ;
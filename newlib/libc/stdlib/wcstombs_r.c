@@ -19,6 +19,15 @@ _wcstombs_r (struct _reent *r,
       size_t num_bytes = 0;
       while (*pwcs != 0)
 	{
+#ifdef _MB_CAPABLE
+	  if (__WCTOMB == __utf8_wctomb && state->__count == 0)
+	    {
+	      num_bytes += __utf8_wcsntombs (NULL, (const wchar_t **) &pwcs,
+					     (size_t) -1, (size_t) -1);
+	      if (*pwcs == 0)
+		break;
+	    }
+#endif
 	  bytes = __WCTOMB (r, buff, *pwcs++, state);
 	  if (bytes == -1)
 	    return -1;
@@ -30,6 +39,17 @@ _wcstombs_r (struct _reent *r,
     {
       while (n > 0)
         {
+#ifdef _MB_CAPABLE
+	  if (__WCTOMB == __utf8_wctomb && state->__count == 0)
+	    {
+	      size_t count = __utf8_wcsntombs (ptr, (const wchar_t **) &pwcs,
+					       (size_t) -1, n);
+
+	      ptr += count;
+	      if ((n -= count) == 0)
+		break;
+	    }
+#endif
           bytes = __WCTOMB (r, buff, *pwcs, state);
           if (bytes == -1)
             return -1;
@@ -137,6 +137,112 @@ __utf8_wctomb (struct _reent *r,
   return -1;
 }
 
+/* Convert the wide characters at *SRC, at most NWC of them, to at most
+   LEN bytes of UTF-8 at DST, or just count the bytes if DST is NULL.
+   Advances *SRC past the converted characters and returns the number
+   of bytes produced.  Stops before a NUL, a character which does not
+   fit in LEN, and anything __utf8_wctomb does not simply encode: lone
+   surrogates and values beyond 0x10ffff.  Only to be called in the
+   initial shift state.  */
+size_t
+__utf8_wcsntombs (char *dst,
+        const wchar_t  **src,
+        size_t         nwc,
+        size_t         len)
+{
+  const wchar_t *pwcs = *src;
+  size_t n = 0;
+  wint_t wc, lo;
+
+  while (nwc > 0)
+    {
+      /* ASCII, four characters at a time.  */
+      while (nwc >= 4 && len - n >= 4
+	     && (((wint_t) pwcs[0] - 1) | ((wint_t) pwcs[1] - 1)
+		 | ((wint_t) pwcs[2] - 1) | ((wint_t) pwcs[3] - 1)) < 0x7f)
+	{
+	  if (dst)
+	    {
+	      dst[n] = pwcs[0];
+	      dst[n + 1] = pwcs[1];
+	      dst[n + 2] = pwcs[2];
+	      dst[n + 3] = pwcs[3];
+	    }
+	  pwcs += 4;
+	  nwc -= 4;
+	  n += 4;
+	}
+      if (nwc == 0)
+	break;
+      wc = *pwcs;
+      if (wc == 0)
+	break;
+      if (wc <= 0x7f)
+	{
+	  if (n >= len)
+	    break;
+	  if (dst)
+	    dst[n] = wc;
+	  n++;
+	}
+      else if (wc <= 0x7ff)
+	{
+	  if (len - n < 2)
+	    break;
+	  if (dst)
+	    {
+	      dst[n] = 0xc0 | (wc >> 6);
+	      dst[n + 1] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 2;
+	}
+      else if (wc <= 0xffff && (wc < 0xd800 || wc > 0xdfff))
+	{
+	  if (len - n < 3)
+	    break;
+	  if (dst)
+	    {
+	      dst[n] = 0xe0 | (wc >> 12);
+	      dst[n + 1] = 0x80 | ((wc >> 6) & 0x3f);
+	      dst[n + 2] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 3;
+	}
+      else
+	{
+	  if (sizeof (wchar_t) == 2)
+	    {
+	      /* Only a complete surrogate pair.  */
+	      if (wc > 0xdbff || nwc < 2
+		  || (lo = pwcs[1]) < 0xdc00 || lo > 0xdfff)
+		break;
+	      wc = (((wc & 0x3ff) << 10) | (lo & 0x3ff)) + 0x10000;
+	    }
+	  else if (wc < 0x10000 || wc > 0x10ffff)
+	    break;
+	  if (len - n < 4)
+	    break;
+	  if (dst)
+	    {
+	      dst[n] = 0xf0 | (wc >> 18);
+	      dst[n + 1] = 0x80 | ((wc >> 12) & 0x3f);
+	      dst[n + 2] = 0x80 | ((wc >> 6) & 0x3f);
+	      dst[n + 3] = 0x80 | (wc & 0x3f);
+	    }
+	  n += 4;
+	  if (sizeof (wchar_t) == 2)
+	    {
+	      pwcs++;
+	      nwc--;
+	    }
+	}
+      pwcs++;
+      nwc--;
+    }
+  *src = pwcs;
+  return n;
+}
+
 /* Cygwin defines its own doublebyte charset conversion functions 
    because the underlying OS requires wchar_t == UTF-16. */
 #ifndef __CYGWIN__
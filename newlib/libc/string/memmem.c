@@ -96,11 +96,13 @@ memmem (const void *haystack, size_t hs_len, const void *needle, size_t ne_len)
 # define RETURN_TYPE void *
 # define AVAILABLE(h, h_l, j, n_l) ((j) <= (h_l) - (n_l))
 # include "str-two-way.h"
+# include "str-prefilter.h"
 
 #define hash2(p) (((size_t)(p)[0] - ((size_t)(p)[-1] << 3)) % sizeof (shift))
 
 /* Fast memmem algorithm with guaranteed linear-time performance.
-   Small needles up to size 2 use a dedicated linear search.  Longer needles
+   Small needles up to size PREFILTER_MAX are searched for where the haystack
+   has their first and last bytes, see str-prefilter.h.  Longer needles
    up to size 256 use a novel modified Horspool algorithm.  It hashes pairs
    of characters to quickly skip past mismatches.  The main search loop only
    exits if the last 2 characters match, avoiding unnecessary calls to memcmp
@@ -127,12 +129,18 @@ memmem (const void *haystack, size_t hs_len, const void *needle, size_t ne_len)
 
   const unsigned char *end = hs + hs_len - ne_len;
 
-  if (ne_len == 2)
+  /* Filter candidate positions for short needles.  */
+  if (ne_len <= PREFILTER_MAX)
     {
-      uint32_t nw = ne[0] << 16 | ne[1], hw = hs[0] << 16 | hs[1];
-      for (hs++; hs <= end && hw != nw; )
-	hw = hw << 16 | *++hs;
-      return hw == nw ? (void *)(hs - 1) : NULL;
+      struct prefilter pf;
+      const unsigned char *p;
+
+      prefilter_init (&pf, hs, hs_len, ne, ne_len);
+      p = prefilter_search (&pf, hs, end);
+      if (p != NULL || pf.resume == NULL)
+	return (void *) p;
+      return two_way_short_needle (pf.resume, pf.known - pf.resume,
+				   ne, ne_len);
     }
 
   /* Use Two-Way algorithm for very long needles.  */
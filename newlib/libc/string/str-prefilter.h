@@ -0,0 +1,182 @@
+/* Candidate filter for short needle substring searches.
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Before including this file, you need to include <string.h>, and may
+   define:
+     PREFILTER_CMP(p1, p2, l)	A macro that returns 0 iff the first L
+				bytes of P1 and P2 match.  The default
+				is memcmp.
+
+  This file undefines PREFILTER_CMP, and defines PREFILTER_MAX, the
+  longest needle worth filtering.
+
+  A short needle seldom starts at a place where the haystack has both
+  its first byte and, needle length - 1 bytes on, its last byte.  The
+  search finds such places a vector of 16 bytes at a time with SSE2,
+  or a word at a time elsewhere, and only there compares the whole
+  needle.  Each end accepts either of two bytes, so that strcasestr
+  can accept both cases of a letter.
+
+  A needle such as "ab...a" in a haystack such as "aaa..." matches at
+  both ends almost everywhere, which would make the search quadratic.
+  So once the comparisons have cost more than a few times the bytes
+  passed, the search stops and leaves the caller to continue with the
+  linear Two-Way algorithm from str-two-way.h.  */
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+#define PREFILTER_MAX 32
+
+#ifndef PREFILTER_CMP
+# define PREFILTER_CMP memcmp
+#endif
+
+struct prefilter
+{
+  const unsigned char *needle;
+  size_t last;			/* Needle length - 1 */
+  unsigned char first[2];	/* Bytes accepted at the start of a match */
+  unsigned char end[2];		/* and at its end */
+  const unsigned char *origin;	/* Start of the haystack */
+  const unsigned char *known;	/* End of the bytes known to be haystack */
+  const unsigned char *resume;	/* Where Two-Way should take over, if set */
+  size_t work;			/* Bytes compared with the needle so far */
+};
+
+/* Prepare to search the HS_LEN bytes at HS for the NE_LEN >= 1 bytes at
+   NE.  The caller may add other bytes to accept to PF->first and
+   PF->end.  */
+static inline void
+prefilter_init (struct prefilter *pf, const unsigned char *hs, size_t hs_len,
+		const unsigned char *ne, size_t ne_len)
+{
+  pf->needle = ne;
+  pf->last = ne_len - 1;
+  pf->first[0] = pf->first[1] = ne[0];
+  pf->end[0] = pf->end[1] = ne[ne_len - 1];
+  pf->origin = hs;
+  pf->known = hs + hs_len;
+  pf->resume = NULL;
+  pf->work = 0;
+}
+
+#if !defined (__SSE2__) && CHAR_BIT == 8
+# define ONES ((unsigned long) -1 / 0xff)
+# define HIGHS (ONES << 7)
+
+/* The high bit of each byte of X that is zero, and no other bits.  */
+static inline unsigned long
+zero_bytes (unsigned long x)
+{
+  return ~(((x & ~HIGHS) + ~HIGHS) | x) & HIGHS;
+}
+#endif
+
+/* Return the first P in [HS, END] where the haystack has the bytes the
+   needle starts and ends with, or END + 1 if there is none.  */
+static inline const unsigned char *
+prefilter_scan (const struct prefilter *pf, const unsigned char *hs,
+		const unsigned char *end)
+{
+  size_t last = pf->last;
+
+#ifdef __SSE2__
+  const __m128i f0 = _mm_set1_epi8 (pf->first[0]);
+  const __m128i f1 = _mm_set1_epi8 (pf->first[1]);
+  const __m128i e0 = _mm_set1_epi8 (pf->end[0]);
+  const __m128i e1 = _mm_set1_epi8 (pf->end[1]);
+  __m128i a, b;
+  unsigned int mask;
+
+  for (; end - hs >= 15; hs += 16)
+    {
+      a = _mm_loadu_si128 ((const __m128i *) hs);
+      b = _mm_loadu_si128 ((const __m128i *) (hs + last));
+      a = _mm_or_si128 (_mm_cmpeq_epi8 (a, f0), _mm_cmpeq_epi8 (a, f1));
+      b = _mm_or_si128 (_mm_cmpeq_epi8 (b, e0), _mm_cmpeq_epi8 (b, e1));
+      mask = _mm_movemask_epi8 (_mm_and_si128 (a, b));
+      if (mask != 0)
+	return hs + __builtin_ctz (mask);
+    }
+#elif CHAR_BIT == 8
+  const unsigned long f0 = ONES * pf->first[0];
+  const unsigned long f1 = ONES * pf->first[1];
+  const unsigned long e0 = ONES * pf->end[0];
+  const unsigned long e1 = ONES * pf->end[1];
+  unsigned long a, b, mask;
+
+  for (; end - hs >= (ptrdiff_t) sizeof (long) - 1; hs += sizeof (long))
+    {
+      memcpy (&a, hs, sizeof (long));
+      memcpy (&b, hs + last, sizeof (long));
+      mask = ((zero_bytes (a ^ f0) | zero_bytes (a ^ f1))
+	      & (zero_bytes (b ^ e0) | zero_bytes (b ^ e1)));
+      if (mask != 0)
+# if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return hs + __builtin_clzl (mask) / CHAR_BIT;
+# else
+	return hs + __builtin_ctzl (mask) / CHAR_BIT;
+# endif
+    }
+#endif
+
+  for (; hs <= end; hs++)
+    if ((hs[0] == pf->first[0] || hs[0] == pf->first[1])
+	&& (hs[last] == pf->end[0] || hs[last] == pf->end[1]))
+      break;
+  return hs;
+}
+
+/* Return the first match of the needle in [HS, END], or NULL if there
+   is none or if PF->resume was set because the search gave up.  */
+static inline const unsigned char *
+prefilter_search (struct prefilter *pf, const unsigned char *hs,
+		  const unsigned char *end)
+{
+  for (;; hs++)
+    {
+      hs = prefilter_scan (pf, hs, end);
+      if (hs > end)
+	return NULL;
+      if (PREFILTER_CMP (hs, pf->needle, pf->last + 1) == 0)
+	return hs;
+      pf->work += pf->last + 1;
+      if (pf->work > 4 * (size_t) (hs - pf->origin) + 256)
+	{
+	  pf->resume = hs;
+	  return NULL;
+	}
+    }
+}
+
+/* Like prefilter_search for the NUL-terminated haystack at HS, of which
+   prefilter_init was told at least the needle length.  PF->known grows
+   as more of the haystack is found to precede its NUL.  */
+static inline const unsigned char *
+prefilter_strsearch (struct prefilter *pf, const unsigned char *hs)
+{
+  const unsigned char *end, *p;
+
+  for (;;)
+    {
+      end = pf->known - pf->last - 1;
+      p = prefilter_search (pf, hs, end);
+      if (p != NULL || pf->resume != NULL || *pf->known == '\0')
+	return p;
+      hs = end + 1;
+      pf->known += strnlen ((const char *) pf->known,
+			    (pf->known - pf->origin) | 2048);
+    }
+}
+
+#undef ONES
+#undef HIGHS
+#undef PREFILTER_CMP
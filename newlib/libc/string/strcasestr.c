@@ -84,6 +84,22 @@ QUICKREF
 #endif
 # define CMP_FUNC strncasecmp
 # include "str-two-way.h"
+# define PREFILTER_CMP strncasecmp
+# include "str-prefilter.h"
+# include "local.h"
+
+/* Whether tolower leaves bytes above 0x7f alone, so that the only bytes
+   matching an ASCII letter are its two cases and any other byte only
+   matches itself.  This is not so in single byte charsets other than
+   ASCII, where an upper case letter above 0x7f may have an ASCII lower
+   case, as LATIN CAPITAL LETTER I WITH DOT ABOVE has in ISO-8859-9.  */
+# if defined (_MB_EXTENDED_CHARSETS_ISO) \
+     || defined (_MB_EXTENDED_CHARSETS_WINDOWS)
+#  define FOLDS_ASCII_ONLY() \
+  (MB_CUR_MAX > 1 || strcmp (__current_locale_charset (), "ASCII") == 0)
+# else
+#  define FOLDS_ASCII_ONLY() 1
+# endif
 #endif
 
 /*
@@ -135,6 +151,38 @@ strcasestr (const char *s,
   haystack = s + 1;
   haystack_len = needle_len - 1;
 
+  /* Filter candidate positions for short needles.  */
+  if (needle_len <= PREFILTER_MAX && FOLDS_ASCII_ONLY ())
+    {
+      struct prefilter pf;
+      const unsigned char *p;
+      int c;
+
+      haystack_len = strnlen (haystack, needle_len | 512);
+      if (haystack_len < needle_len)
+	return NULL;
+      prefilter_init (&pf, (const unsigned char *) haystack, haystack_len,
+		      (const unsigned char *) find, needle_len);
+      c = pf.first[0];
+      if (c <= 0x7f && isalpha (c))
+	{
+	  pf.first[0] = tolower (c);
+	  pf.first[1] = toupper (c);
+	}
+      c = pf.end[0];
+      if (c <= 0x7f && isalpha (c))
+	{
+	  pf.end[0] = tolower (c);
+	  pf.end[1] = toupper (c);
+	}
+      p = prefilter_strsearch (&pf, (const unsigned char *) haystack);
+      if (p != NULL || pf.resume == NULL)
+	return (char *) p;
+      /* AVAILABLE expects no more length than the search has used.  */
+      haystack = (const char *) pf.resume;
+      haystack_len = needle_len - 1;
+    }
+
   /* Perform the search.  */
   if (needle_len < LONG_NEEDLE_THRESHOLD)
     return two_way_short_needle ((const unsigned char *) haystack,
@@ -93,45 +93,14 @@ strstr (const char *hs, const char *ne)
    || ((h_l) += strnlen ((h) + (h_l), (n_l) | 2048), ((j) <= (h_l) - (n_l))))
 
 # include "str-two-way.h"
+# include "str-prefilter.h"
 
 /* Number of bits used to index shift table.  */
 #define SHIFT_TABLE_BITS 6
 
-static inline char *
-strstr2 (const unsigned char *hs, const unsigned char *ne)
-{
-  uint32_t h1 = (ne[0] << 16) | ne[1];
-  uint32_t h2 = 0;
-  int c;
-  for (c = hs[0]; h1 != h2 && c != 0; c = *++hs)
-      h2 = (h2 << 16) | c;
-  return h1 == h2 ? (char *)hs - 2 : NULL;
-}
-
-static inline char *
-strstr3 (const unsigned char *hs, const unsigned char *ne)
-{
-  uint32_t h1 = (ne[0] << 24) | (ne[1] << 16) | (ne[2] << 8);
-  uint32_t h2 = 0;
-  int c;
-  for (c = hs[0]; h1 != h2 && c != 0; c = *++hs)
-      h2 = (h2 | c) << 8;
-  return h1 == h2 ? (char *)hs - 3 : NULL;
-}
-
-static inline char *
-strstr4 (const unsigned char *hs, const unsigned char *ne)
-{
-  uint32_t h1 = (ne[0] << 24) | (ne[1] << 16) | (ne[2] << 8) | ne[3];
-  uint32_t h2 = 0;
-  int c;
-  for (c = hs[0]; c != 0 && h1 != h2; c = *++hs)
-    h2 = (h2 << 8) | c;
-  return h1 == h2 ? (char *)hs - 4 : NULL;
-}
-
 /* Extremely fast strstr algorithm with guaranteed linear-time performance.
-   Small needles up to size 4 use a dedicated linear search.  Longer needles
+   Small needles up to size PREFILTER_MAX are searched for where the haystack
+   has their first and last characters, see str-prefilter.h.  Longer needles
    up to size 254 use Sunday's Quick-Search algorithm.  Due to its simplicity
    it has the best average performance of string matching algorithms on almost
    all inputs.  It uses a bad-character shift table to skip past mismatches.
@@ -152,12 +121,6 @@ strstr (const char *haystack, const char *needle)
     return (char *) hs;
   if (ne[1] == '\0')
     return (char*)strchr (hs, ne[0]);
-  if (ne[2] == '\0')
-    return strstr2 (hs, ne);
-  if (ne[3] == '\0')
-    return strstr3 (hs, ne);
-  if (ne[4] == '\0')
-    return strstr4 (hs, ne);
 
   size_t ne_len = strlen (ne);
   size_t hs_len = strnlen (hs, ne_len | 512);
@@ -166,6 +129,20 @@ strstr (const char *haystack, const char *needle)
   if (hs_len < ne_len)
     return NULL;
 
+  /* Filter candidate positions for short needles.  */
+  if (ne_len <= PREFILTER_MAX)
+    {
+      struct prefilter pf;
+      const unsigned char *p;
+
+      prefilter_init (&pf, hs, hs_len, ne, ne_len);
+      p = prefilter_strsearch (&pf, hs);
+      if (p != NULL || pf.resume == NULL)
+	return (char *) p;
+      return two_way_short_needle (pf.resume, pf.known - pf.resume,
+				   ne, ne_len);
+    }
+
   /* Use the Quick-Search algorithm for needle lengths less than 255.  */
   if (__builtin_expect (ne_len < 255, 1))
     {
@@ -33,34 +33,53 @@ PORTABILITY
 #include <wchar.h>
 #include "local.h"
 
+/* Whether the wide character C is printable ASCII, one column wide */
+#define PRINTABLE_ASCII(c) ((wint_t) (c) - 0x20 < 0x5f)
+
 int
 wcswidth (const wchar_t *pwcs,
 	size_t n)
 
 {
   int w, len = 0;
-  if (!pwcs || n == 0)
+  if (!pwcs)
     return 0;
-  do {
-    wint_t wi = *pwcs;
+  while (n > 0)
+    {
+      wint_t wi;
+
+      /* Runs of printable ASCII, four characters at a time */
+      if (n >= 4 && (PRINTABLE_ASCII (pwcs[0]) & PRINTABLE_ASCII (pwcs[1])
+		     & PRINTABLE_ASCII (pwcs[2]) & PRINTABLE_ASCII (pwcs[3])))
+	{
+	  len += 4;
+	  pwcs += 4;
+	  n -= 4;
+	  continue;
+	}
+      wi = *pwcs;
+      if (wi == 0)
+	break;
 
 #ifdef _MB_CAPABLE
-  wi = _jp2uc (wi);
-  /* First half of a surrogate pair? */
-  if (sizeof (wchar_t) == 2 && wi >= 0xd800 && wi <= 0xdbff)
-    {
-      wint_t wi2;
+      wi = _jp2uc (wi);
+      /* First half of a surrogate pair? */
+      if (sizeof (wchar_t) == 2 && wi >= 0xd800 && wi <= 0xdbff)
+	{
+	  wint_t wi2;
 
-      /* Extract second half and check for validity. */
-      if (--n == 0 || (wi2 = _jp2uc (*++pwcs)) < 0xdc00 || wi2 > 0xdfff)
+	  /* Extract second half and check for validity. */
+	  if (--n == 0 || (wi2 = _jp2uc (*++pwcs)) < 0xdc00 || wi2 > 0xdfff)
+	    return -1;
+	  /* Compute actual unicode value to use in call to __wcwidth. */
+	  wi = (((wi & 0x3ff) << 10) | (wi2 & 0x3ff)) + 0x10000;
+	}
+#endif /* _MB_CAPABLE */
+      if ((w = __wcwidth (wi)) < 0)
 	return -1;
-      /* Compute actual unicode value to use in call to __wcwidth. */
-      wi = (((wi & 0x3ff) << 10) | (wi2 & 0x3ff)) + 0x10000;
+      len += w;
+      pwcs++;
+      n--;
     }
-#endif /* _MB_CAPABLE */
-    if ((w = __wcwidth (wi)) < 0)
-      return -1;
-    len += w;
-  } while (*pwcs++ && --n > 0);
   return len;
 }
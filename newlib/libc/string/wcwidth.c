@@ -95,7 +95,12 @@ PORTABILITY
 #endif
 #include "local.h"
 
-#ifdef _MB_CAPABLE
+#if defined (_MB_CAPABLE) \
+    && (defined (PREFER_SIZE_OVER_SPEED) || defined (__OPTIMIZE_SIZE__))
+#define WIDTH_BISEARCH
+#endif
+
+#ifdef WIDTH_BISEARCH
 struct interval
 {
   int first;
@@ -124,6 +129,24 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 
   return 0;
 }
+#elif defined (_MB_CAPABLE)
+/* ambiguous.t, combining.t and wide.t as a width for each character,
+   two bits per character in two stages; see mkwidthstages.  */
+#include "widthstages.t"
+
+#define WIDTH_AMBIGUOUS	3
+
+static int
+width_class (wint_t ucs)
+{
+  wint_t g = ucs >> 2;
+
+  if (g >= WIDTH_LIMIT)
+    return 1;
+  return (width_blocks[(width_index[g >> WIDTH_SHIFT] << WIDTH_SHIFT)
+		       + (g & ((1 << WIDTH_SHIFT) - 1))]
+	  >> ((ucs & 3) * 2)) & 3;
+}
 #endif /* _MB_CAPABLE */
 
 /* The following function defines the column width of an ISO 10646
@@ -166,7 +189,7 @@ bisearch(wint_t ucs, const struct interval *table, int max)
 int
 __wcwidth (const wint_t ucs)
 {
-#ifdef _MB_CAPABLE
+#ifdef WIDTH_BISEARCH
   /* sorted list of non-overlapping intervals of East Asian Ambiguous chars */
   static const struct interval ambiguous[] =
 #include "ambiguous.t"
@@ -216,6 +239,29 @@ __wcwidth (const wint_t ucs)
     return 2;
   else
     return 1;
+#elif defined (_MB_CAPABLE)
+  int width;
+
+  /* Test for NUL character */
+  if (ucs == 0)
+    return 0;
+
+  /* Test for printable ASCII characters */
+  if (ucs >= 0x20 && ucs < 0x7f)
+    return 1;
+
+  /* Test for control characters */
+  if (ucs < 0xa0)
+    return -1;
+
+  /* Test for surrogate pair values. */
+  if (ucs >= 0xd800 && ucs <= 0xdfff)
+    return -1;
+
+  width = width_class (ucs);
+  if (width == WIDTH_AMBIGUOUS)
+    return __locale_cjk_lang () ? 2 : 1;
+  return width;
 #else /* !_MB_CAPABLE */
   if (iswprint (ucs))
     return 1;
@@ -0,0 +1,1138 @@
+/* generated by mkstages: 4352 pages of 64, 95 blocks,
+   10432 bytes */
+
+#define WIDTH_SHIFT 6
+#define WIDTH_LIMIT 0x44000
+
+static const unsigned char width_index[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 18, 18, 18, 20, 21, 22, 23, 24, 25, 26, 18, 18,
+  27, 28, 29, 30, 31, 32, 33, 34, 18, 18, 18, 35, 36, 37, 38, 39,
+  40, 39, 41, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 42, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 43, 18, 44, 18, 45, 46, 47, 48, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 49, 18, 18, 18, 18, 18, 18, 18, 18,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 39, 39, 51, 18, 18, 52, 53,
+  18, 54, 55, 56, 18, 18, 18, 18, 18, 18, 57, 18, 18, 58, 18, 59,
+  60, 61, 62, 63, 64, 65, 66, 67, 68, 18, 69, 18, 70, 71, 72, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 73, 74, 18, 18, 18, 75,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  39, 76, 39, 18, 18, 18, 18, 18, 18, 18, 18, 18, 77, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 78, 79, 18, 18, 18, 18, 18, 18, 18, 80, 18, 18, 18, 18, 18,
+  81, 18, 18, 18, 18, 18, 18, 18, 82, 83, 18, 18, 18, 18, 18, 18,
+  84, 85, 39, 86, 87, 88, 89, 18, 18, 90, 18, 18, 18, 18, 18, 18,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 91,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 91,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  92, 93, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 94,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 94,
+};
+
+static const unsigned char width_blocks[] = {
+  /* U+0000 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  93, 215, 119, 117, 255, 247, 127, 255,
+  85, 117, 85, 85, 87, 213, 87, 245,
+  95, 117, 127, 95, 247, 213, 127, 119,
+  /* U+0040 */
+  93, 85, 85, 85, 221, 85, 213, 85,
+  85, 245, 213, 85, 253, 85, 87, 213,
+  127, 87, 255, 93, 245, 85, 85, 85,
+  85, 245, 213, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 117, 119, 119, 119, 87,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0080 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 93, 85, 85, 85,
+  93, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 215, 253, 93, 87, 85, 255, 221,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+00C0 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 85, 85, 85, 85,
+  85, 85, 85, 85, 253, 255, 255, 255,
+  223, 255, 95, 85, 253, 255, 255, 255,
+  223, 255, 95, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0100 */
+  93, 85, 85, 85, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 93, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  21, 0, 80, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0140 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 16,
+  65, 16, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0180 */
+  0, 80, 85, 85, 0, 0, 64, 84,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 21, 0, 0, 0, 0, 0,
+  85, 85, 85, 85, 84, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 5, 0, 16,
+  0, 20, 4, 80, 85, 85, 85, 85,
+  /* U+01C0 */
+  85, 85, 85, 21, 81, 85, 85, 85,
+  85, 85, 85, 85, 0, 0, 0, 0,
+  0, 0, 64, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 5, 0, 0, 84, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 21, 0, 0, 85, 85, 81,
+  /* U+0200 */
+  85, 85, 85, 85, 85, 5, 16, 0,
+  0, 1, 1, 80, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 1, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+0240 */
+  64, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 69, 84,
+  1, 0, 84, 81, 1, 0, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 85,
+  81, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 84,
+  1, 84, 85, 81, 85, 85, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 69,
+  /* U+0280 */
+  65, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 84,
+  65, 21, 20, 80, 81, 85, 85, 85,
+  85, 85, 85, 85, 80, 81, 85, 85,
+  65, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 84,
+  1, 16, 84, 81, 85, 85, 85, 85,
+  5, 85, 85, 85, 85, 85, 5, 0,
+  /* U+02C0 */
+  81, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 20,
+  1, 84, 85, 81, 85, 69, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 85,
+  69, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  84, 85, 85, 81, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0300 */
+  84, 84, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 5,
+  84, 5, 4, 80, 85, 65, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 85,
+  81, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 20,
+  85, 69, 85, 80, 85, 85, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0340 */
+  80, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 21, 84,
+  1, 84, 85, 81, 85, 85, 85, 85,
+  5, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 69, 85, 5, 68, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0380 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 81, 0, 64, 85,
+  85, 21, 0, 64, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 81, 0, 16, 84,
+  85, 85, 0, 80, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+03C0 */
+  85, 85, 85, 85, 85, 85, 80, 85,
+  85, 85, 85, 85, 85, 17, 81, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 1, 0, 0, 64,
+  0, 4, 85, 1, 0, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 84,
+  85, 69, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0400 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 1, 4, 0, 65, 65,
+  85, 85, 85, 85, 85, 85, 80, 5,
+  84, 85, 85, 85, 1, 84, 85, 85,
+  69, 65, 85, 81, 85, 85, 85, 81,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0440 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+0480 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+04C0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 1,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+05C0 */
+  85, 85, 85, 85, 5, 84, 85, 85,
+  85, 85, 85, 85, 5, 84, 85, 85,
+  85, 85, 85, 85, 5, 85, 85, 85,
+  85, 85, 85, 85, 5, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 16, 0, 80,
+  85, 69, 1, 0, 0, 85, 85, 81,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0600 */
+  85, 85, 21, 64, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 65, 85, 85, 85, 85, 85, 85,
+  85, 85, 81, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0640 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  64, 21, 84, 85, 69, 85, 1, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0680 */
+  85, 85, 85, 85, 85, 21, 20, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 69, 0, 64,
+  68, 1, 0, 84, 21, 0, 0, 20,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 0, 0, 64,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+06C0 */
+  0, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 4, 64, 84,
+  69, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 21, 0, 0, 85, 85, 85,
+  80, 85, 85, 85, 85, 85, 85, 85,
+  5, 80, 16, 80, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 69, 80, 17, 80, 85, 85, 85,
+  /* U+0700 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 0, 0, 5, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 64, 0, 0, 0,
+  4, 0, 84, 81, 85, 84, 80, 85,
+  /* U+0740 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 16, 0,
+  /* U+0800 */
+  85, 85, 21, 0, 215, 127, 95, 95,
+  127, 255, 5, 64, 247, 93, 213, 117,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  0, 4, 0, 0, 85, 87, 85, 213,
+  253, 87, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 87, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 84, 85, 85, 85,
+  /* U+0840 */
+  213, 93, 93, 85, 213, 117, 85, 85,
+  125, 117, 213, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 213, 87, 213, 127,
+  255, 255, 255, 85, 255, 255, 95, 85,
+  85, 85, 93, 85, 255, 255, 95, 85,
+  85, 85, 85, 85, 85, 85, 95, 85,
+  85, 85, 85, 85, 117, 87, 85, 85,
+  85, 213, 85, 85, 85, 85, 85, 85,
+  /* U+0880 */
+  247, 213, 215, 213, 93, 93, 117, 253,
+  215, 221, 255, 119, 85, 255, 85, 95,
+  85, 85, 87, 87, 117, 85, 85, 85,
+  95, 255, 245, 245, 85, 85, 85, 85,
+  245, 245, 85, 85, 85, 93, 93, 85,
+  85, 93, 85, 85, 85, 85, 85, 213,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+08C0 */
+  85, 85, 85, 85, 117, 85, 165, 85,
+  85, 85, 105, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 169, 86, 150, 85, 85, 85,
+  /* U+0900 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 223, 255, 255, 255, 255, 255,
+  /* U+0940 */
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 85, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 85, 85, 85,
+  255, 255, 255, 255, 245, 95, 85, 85,
+  223, 255, 95, 85, 245, 245, 85, 95,
+  95, 245, 215, 245, 95, 85, 85, 85,
+  245, 95, 85, 213, 85, 85, 85, 105,
+  /* U+0980 */
+  85, 125, 93, 245, 85, 90, 85, 119,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  119, 85, 170, 170, 170, 85, 85, 85,
+  223, 223, 127, 223, 85, 85, 85, 149,
+  85, 85, 85, 85, 149, 85, 85, 245,
+  89, 85, 165, 85, 85, 85, 85, 233,
+  85, 250, 255, 239, 255, 254, 255, 255,
+  223, 85, 239, 255, 175, 251, 239, 251,
+  /* U+09C0 */
+  85, 89, 165, 85, 85, 85, 85, 85,
+  85, 85, 86, 85, 85, 85, 85, 93,
+  85, 85, 85, 102, 149, 154, 85, 85,
+  85, 85, 85, 85, 85, 245, 255, 255,
+  85, 85, 85, 85, 85, 169, 85, 85,
+  85, 85, 85, 85, 86, 85, 85, 149,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0AC0 */
+  85, 85, 85, 85, 85, 85, 149, 86,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 86, 249, 95, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+0B00 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 21, 80, 85, 85, 85,
+  /* U+0B40 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 21,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  /* U+0B80 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+0BC0 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+0C00 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 10, 160, 170, 170, 170, 106,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 130, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+0C80 */
+  170, 170, 170, 170, 170, 170, 170, 106,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 255, 255, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 106,
+  /* U+1340 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+2900 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+2980 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 21, 64, 0, 0, 80,
+  85, 85, 85, 85, 85, 85, 85, 5,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 80, 85, 85, 85,
+  /* U+2A00 */
+  69, 69, 21, 85, 85, 85, 85, 85,
+  85, 65, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 80, 85, 85, 85, 85, 85, 85,
+  0, 0, 0, 0, 80, 85, 85, 21,
+  /* U+2A40 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 5, 0, 80, 85, 85, 85, 85,
+  85, 21, 0, 0, 80, 85, 85, 85,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  64, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 5, 80, 84,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 81, 85, 85, 85, 85, 85, 85,
+  /* U+2A80 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 1, 64, 65, 65, 85, 85,
+  21, 85, 85, 84, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 84,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 4, 20, 84, 5,
+  81, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 80, 85, 69, 85, 85,
+  /* U+2AC0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 81, 84, 81, 85, 85, 85, 85,
+  /* U+35C0 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 0, 0, 0, 0,
+  0, 64, 21, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 85,
+  /* U+3800 */
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  /* U+3EC0 */
+  85, 85, 85, 85, 85, 85, 85, 69,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+3F80 */
+  0, 0, 0, 0, 170, 170, 170, 170,
+  0, 0, 0, 0, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 21,
+  /* U+3FC0 */
+  169, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  86, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  170, 106, 85, 85, 85, 85, 1, 93,
+  /* U+4040 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 81,
+  /* U+4080 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  84, 85, 85, 85, 85, 85, 85, 85,
+  /* U+40C0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 5, 64, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4280 */
+  1, 65, 85, 0, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 64, 21,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 65, 85, 85, 85, 85, 85, 85,
+  /* U+4340 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 0, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+43C0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 5, 0, 0, 84, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4400 */
+  81, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 0, 0,
+  0, 64, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 21,
+  80, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 64, 65, 81,
+  85, 85, 85, 81, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4440 */
+  64, 85, 85, 85, 85, 85, 85, 85,
+  85, 21, 0, 1, 0, 84, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 85, 85, 85,
+  80, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 5, 0, 64,
+  85, 85, 1, 84, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4480 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 21, 80, 4, 85, 69,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 21,
+  21, 0, 64, 85, 85, 85, 85, 85,
+  /* U+44C0 */
+  80, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 21, 84,
+  84, 85, 85, 85, 85, 85, 85, 85,
+  85, 5, 0, 84, 0, 84, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4500 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 0, 0,
+  5, 68, 85, 85, 85, 85, 85, 69,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 0, 68, 21,
+  4, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4540 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 5, 80, 85, 16,
+  84, 85, 85, 85, 85, 85, 85, 80,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4580 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 0, 64, 17,
+  84, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 21, 81, 0, 16, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+45C0 */
+  85, 85, 85, 85, 85, 85, 85, 1,
+  5, 16, 0, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4600 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 21, 0, 0, 65, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4680 */
+  1, 0, 64, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 0, 20, 64,
+  85, 21, 85, 85, 1, 64, 1, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 5, 0, 0, 64, 80, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4700 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 64, 0, 16,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 5, 0, 0, 0,
+  0, 0, 5, 0, 4, 65, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4740 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 1, 64, 69, 16,
+  0, 16, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 80, 17, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+4780 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 21, 84, 85, 85,
+  /* U+5A80 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 84, 85, 85,
+  /* U+5AC0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 64, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+5BC0 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 21, 64, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+6C40 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+6F00 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 65,
+  0, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7440 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 21, 80, 85, 21, 0, 0, 0,
+  64, 1, 0, 85, 85, 85, 85, 85,
+  85, 85, 5, 80, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7480 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  5, 84, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7680 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 64, 21, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 84, 85, 81, 85, 85,
+  85, 84, 85, 85, 85, 85, 21, 0,
+  1, 0, 0, 0, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7800 */
+  0, 64, 0, 0, 0, 0, 20, 0,
+  16, 4, 64, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7A00 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 0, 64, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7A40 */
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 0, 64, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7C00 */
+  85, 86, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 149, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7C40 */
+  255, 255, 127, 85, 255, 255, 255, 255,
+  255, 255, 255, 95, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 95, 85, 255, 255, 255, 255,
+  255, 255, 255, 239, 171, 170, 234, 255,
+  255, 255, 255, 87, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+7CC0 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  86, 85, 85, 169, 170, 154, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 166,
+  170, 170, 170, 170, 170, 85, 85, 85,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 106, 149, 170, 85, 85, 85,
+  170, 170, 170, 170, 86, 86, 170, 170,
+  /* U+7D00 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 106,
+  166, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 150,
+  /* U+7D40 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 90,
+  85, 85, 149, 106, 170, 170, 170, 170,
+  170, 170, 85, 85, 85, 85, 101, 85,
+  85, 85, 85, 85, 85, 105, 85, 85,
+  85, 86, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 149, 170,
+  /* U+7D80 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 90, 85, 86, 106, 85, 85, 85,
+  85, 85, 149, 86, 85, 170, 90, 85,
+  /* U+7E40 */
+  85, 85, 85, 85, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 106,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 150, 106, 101, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  106, 85, 85, 85, 170, 170, 90, 85,
+  106, 85, 85, 85, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  /* U+BFC0 */
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 90,
+  /* U+38000 */
+  81, 85, 85, 85, 85, 85, 85, 85,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85,
+  /* U+38040 */
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 85, 85, 85, 85,
+  /* U+3FFC0 */
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 95,
+};
@@ -0,0 +1,98 @@
+/*
+ * civil_days.c
+ *
+ * Conversion between days since the epoch and dates of the proleptic
+ * Gregorian calendar, in constant time, for gmtime(), mktime() and
+ * tzset().  For a description of the algorithms see
+ * http://howardhinnant.github.io/date_algorithms.html
+ *
+ * The days are counted in a time_t, so that every date of a struct tm
+ * can be converted even where long has 32 bits.
+ */
+
+#include <limits.h>
+#include "local.h"
+
+/* Move epoch from 01.01.1970 to 01.03.0000 (yes, Year 0) - this is the first
+ * day of a 400-year long "era", right after additional day of leap year.
+ * This adjustment is required only for date calculation, so it is made to
+ * the number of days since epoch.
+ */
+#define EPOCH_ADJUSTMENT_DAYS	719468L
+/* year to which the adjustment was made */
+#define ADJUSTED_EPOCH_YEAR	0
+/* 1st March of year 0 is Wednesday */
+#define ADJUSTED_EPOCH_WDAY	3
+/* there are 97 leap years in 400-year periods. ((400 - 97) * 365 + 97 * 366) */
+#define DAYS_PER_ERA		146097L
+/* there are 24 leap years in 100-year periods. ((100 - 24) * 365 + 24 * 366) */
+#define DAYS_PER_CENTURY	36524L
+/* there is one leap year every 4 years */
+#define DAYS_PER_4_YEARS	(3 * 365 + 366)
+/* number of days in a non-leap year */
+#define DAYS_PER_YEAR		365
+/* number of days in January */
+#define DAYS_IN_JANUARY		31
+/* number of days in non-leap February */
+#define DAYS_IN_FEBRUARY	28
+/* number of years per era */
+#define YEARS_PER_ERA		400
+
+/* The number of days from 1970-01-01 to day MDAY of month MON (0 to 11)
+   of YEAR.  MDAY may be out of the range of the month.  */
+time_t
+__days_from_civil (time_t year, int mon, time_t mday)
+{
+  time_t era;
+  unsigned erayear, yearday;
+
+  /* count years from March, so that a leap day ends them */
+  if (mon < 2)
+    --year;
+  era = (year >= 0 ? year : year - (YEARS_PER_ERA - 1)) / YEARS_PER_ERA;
+  erayear = (unsigned) (year - era * YEARS_PER_ERA);	/* [0, 399] */
+  yearday = (153 * (mon < 2 ? mon + 10 : mon - 2) + 2) / 5;	/* [0, 337] */
+  return era * DAYS_PER_ERA + DAYS_PER_YEAR * erayear + erayear / 4
+	 - erayear / 100 + yearday + (mday - 1) - EPOCH_ADJUSTMENT_DAYS;
+}
+
+/* Set tm_year, tm_mon, tm_mday, tm_yday and tm_wday of RES to the date
+   DAYS days from 1970-01-01.  Returns 0, setting none of them, if its
+   year is out of the range of tm_year.  */
+int
+__civil_from_days (time_t days, struct tm *res)
+{
+  time_t era, year;
+  int weekday;
+  unsigned erayear, yearday, month, day;
+  unsigned long eraday;
+
+  days += EPOCH_ADJUSTMENT_DAYS;
+
+  /* compute day of week */
+  if ((weekday = ((ADJUSTED_EPOCH_WDAY + days) % DAYSPERWEEK)) < 0)
+    weekday += DAYSPERWEEK;
+
+  /* compute year, month, day & day of year */
+  era = (days >= 0 ? days : days - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
+  eraday = days - era * DAYS_PER_ERA;	/* [0, 146096] */
+  erayear = (eraday - eraday / (DAYS_PER_4_YEARS - 1) + eraday / DAYS_PER_CENTURY -
+      eraday / (DAYS_PER_ERA - 1)) / 365;	/* [0, 399] */
+  yearday = eraday - (DAYS_PER_YEAR * erayear + erayear / 4 - erayear / 100);	/* [0, 365] */
+  month = (5 * yearday + 2) / 153;	/* [0, 11] */
+  day = yearday - (153 * month + 2) / 5 + 1;	/* [1, 31] */
+  month += month < 10 ? 2 : -10;
+  year = era * YEARS_PER_ERA + (time_t) erayear + (month <= 1)
+	 + (ADJUSTED_EPOCH_YEAR - YEAR_BASE);
+  if (year > INT_MAX || year < INT_MIN)
+    return 0;
+
+  res->tm_wday = weekday;
+  res->tm_yday = yearday >= DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY ?
+      yearday - (DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY) :
+      yearday + DAYS_IN_JANUARY + DAYS_IN_FEBRUARY + isleap(erayear);
+  res->tm_year = (int) year;
+  res->tm_mon = month;
+  res->tm_mday = day;
+  return 1;
+}
@@ -11,51 +11,26 @@
  *   <freddie_chopin@op.pl>
  * - Use faster algorithm from civil_from_days() by Howard Hinnant - 12/06/2014,
  * Freddie Chopin <freddie_chopin@op.pl>
+ * - Moved the date computation to __civil_from_days() in civil_days.c
  *
  * Converts the calendar time pointed to by tim_p into a broken-down time
  * expressed as local time. Returns a pointer to a structure containing the
- * broken-down time.
+ * broken-down time, or NULL, setting errno to EOVERFLOW, if its year does
+ * not fit in tm_year.
  */
 
+#include <errno.h>
 #include "local.h"
 
-/* Move epoch from 01.01.1970 to 01.03.0000 (yes, Year 0) - this is the first
- * day of a 400-year long "era", right after additional day of leap year.
- * This adjustment is required only for date calculation, so instead of
- * modifying time_t value (which would require 64-bit operations to work
- * correctly) it's enough to adjust the calculated number of days since epoch.
- */
-#define EPOCH_ADJUSTMENT_DAYS	719468L
-/* year to which the adjustment was made */
-#define ADJUSTED_EPOCH_YEAR	0
-/* 1st March of year 0 is Wednesday */
-#define ADJUSTED_EPOCH_WDAY	3
-/* there are 97 leap years in 400-year periods. ((400 - 97) * 365 + 97 * 366) */
-#define DAYS_PER_ERA		146097L
-/* there are 24 leap years in 100-year periods. ((100 - 24) * 365 + 24 * 366) */
-#define DAYS_PER_CENTURY	36524L
-/* there is one leap year every 4 years */
-#define DAYS_PER_4_YEARS	(3 * 365 + 366)
-/* number of days in a non-leap year */
-#define DAYS_PER_YEAR		365
-/* number of days in January */
-#define DAYS_IN_JANUARY		31
-/* number of days in non-leap February */
-#define DAYS_IN_FEBRUARY	28
-/* number of years per era */
-#define YEARS_PER_ERA		400
-
 struct tm *
 gmtime_r (const time_t *__restrict tim_p,
 	struct tm *__restrict res)
 {
-  long days, rem;
+  time_t days;
+  long rem;
   const time_t lcltime = *tim_p;
-  int era, weekday, year;
-  unsigned erayear, yearday, month, day;
-  unsigned long eraday;
 
-  days = lcltime / SECSPERDAY + EPOCH_ADJUSTMENT_DAYS;
+  days = lcltime / SECSPERDAY;
   rem = lcltime % SECSPERDAY;
   if (rem < 0)
     {
@@ -63,37 +38,19 @@ gmtime_r (const time_t *__restrict tim_p,
       --days;
     }
 
+  /* compute year, month, day, day of year & day of week */
+  if (!__civil_from_days (days, res))
+    {
+      errno = EOVERFLOW;
+      return NULL;
+    }
+
   /* compute hour, min, and sec */
   res->tm_hour = (int) (rem / SECSPERHOUR);
   rem %= SECSPERHOUR;
   res->tm_min = (int) (rem / SECSPERMIN);
   res->tm_sec = (int) (rem % SECSPERMIN);
 
-  /* compute day of week */
-  if ((weekday = ((ADJUSTED_EPOCH_WDAY + days) % DAYSPERWEEK)) < 0)
-    weekday += DAYSPERWEEK;
-  res->tm_wday = weekday;
-
-  /* compute year, month, day & day of year */
-  /* for description of this algorithm see
-   * http://howardhinnant.github.io/date_algorithms.html#civil_from_days */
-  era = (days >= 0 ? days : days - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
-  eraday = days - era * DAYS_PER_ERA;	/* [0, 146096] */
-  erayear = (eraday - eraday / (DAYS_PER_4_YEARS - 1) + eraday / DAYS_PER_CENTURY -
-      eraday / (DAYS_PER_ERA - 1)) / 365;	/* [0, 399] */
-  yearday = eraday - (DAYS_PER_YEAR * erayear + erayear / 4 - erayear / 100);	/* [0, 365] */
-  month = (5 * yearday + 2) / 153;	/* [0, 11] */
-  day = yearday - (153 * month + 2) / 5 + 1;	/* [1, 31] */
-  month += month < 10 ? 2 : -10;
-  year = ADJUSTED_EPOCH_YEAR + erayear + era * YEARS_PER_ERA + (month <= 1);
-
-  res->tm_yday = yearday >= DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY ?
-      yearday - (DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY) :
-      yearday + DAYS_IN_JANUARY + DAYS_IN_FEBRUARY + isleap(erayear);
-  res->tm_year = year - YEAR_BASE;
-  res->tm_mon = month;
-  res->tm_mday = day;
-
   res->tm_isdst = 0;
 
   return (res);
@@ -7,6 +7,7 @@
  * - Fixed bug in __tzcalc_limits - 08/12/04, Alex Mogilnikov <alx@intellectronika.ru>
  * - Implement localtime_r() with gmtime_r() and the conditional code moved
  *   from _mktm_r() - 05/09/14, Freddie Chopin <freddie_chopin@op.pl>
+ * - Read a copy of the zone published by tzset instead of taking the lock
  *
  * Converts the calendar time pointed to by tim_p into a broken-down time
  * expressed as local time. Returns a pointer to a structure containing the
@@ -22,33 +23,44 @@ localtime_r (const time_t *__restrict tim_p,
   long offset;
   int hours, mins, secs;
   int year;
-  __tzinfo_type *const tz = __gettzinfo ();
+  __tzsnap_type snap;
+  __tzinfo_type *const tz = &snap.tz;
+  const __ttinfo_type *tt;
   const int *ip;
 
-  res = gmtime_r (tim_p, res);
+  if ((res = gmtime_r (tim_p, res)) == NULL)
+    return NULL;
 
   year = res->tm_year + YEAR_BASE;
   ip = __month_lengths[isleap(year)];
 
-  TZ_LOCK;
-  _tzset_unlocked ();
-  if (_daylight)
+  /* a copy of the zone, taken without the lock unless TZ has changed */
+  __tzsnap_get (&snap);
+  if (snap.file != NULL && (tt = __tzfile_find (snap.file, *tim_p)) != NULL)
     {
-      if (year == tz->__tzyear || __tzcalc_limits (year))
-	res->tm_isdst = (tz->__tznorth
-	  ? (*tim_p >= tz->__tzrule[0].change
-	  && *tim_p < tz->__tzrule[1].change)
-	  : (*tim_p >= tz->__tzrule[0].change
-	  || *tim_p < tz->__tzrule[1].change));
-      else
-	res->tm_isdst = -1;
+      res->tm_isdst = tt->isdst;
+      offset = tt->offset;
     }
   else
-    res->tm_isdst = 0;
+    {
+      if (snap.daylight)
+	{
+	  if (year == tz->__tzyear || __tzcalc_limits_of (tz, year))
+	    res->tm_isdst = (tz->__tznorth
+	      ? (*tim_p >= tz->__tzrule[0].change
+	      && *tim_p < tz->__tzrule[1].change)
+	      : (*tim_p >= tz->__tzrule[0].change
+	      || *tim_p < tz->__tzrule[1].change));
+	  else
+	    res->tm_isdst = -1;
+	}
+      else
+	res->tm_isdst = 0;
 
-  offset = (res->tm_isdst == 1
-    ? tz->__tzrule[1].offset
-    : tz->__tzrule[0].offset);
+      offset = (res->tm_isdst == 1
+	? tz->__tzrule[1].offset
+	: tz->__tzrule[0].offset);
+    }
 
   hours = (int) (offset / SECSPERHOUR);
   offset = offset % SECSPERHOUR;
@@ -120,7 +132,6 @@ localtime_r (const time_t *__restrict tim_p,
 	  res->tm_mday = ip[res->tm_mon];
 	}
     }
-  TZ_UNLOCK;
 
   return (res);
 }
@@ -20,12 +20,61 @@
 #define isleap(y) ((((y) % 4) == 0 && ((y) % 100) != 0) || ((y) % 400) == 0)
 
 int         __tzcalc_limits (int __year);
+int         __tzcalc_limits_of (__tzinfo_type *, int __year);
+
+time_t __days_from_civil (time_t, int, time_t);
+int __civil_from_days (time_t, struct tm *);
 
 extern const int __month_lengths[2][MONSPERYEAR];
 
 void _tzset_unlocked_r (struct _reent *);
 void _tzset_unlocked (void);
 
+/* A local time type of a TZif file.  */
+typedef struct __ttinfo_struct
+{
+  long offset;		/* seconds west of UTC, like __tzrule_type.offset */
+  int isdst;
+  int abbr;		/* index of its name in names */
+} __ttinfo_type;
+
+/* A zone loaded from a TZif file by __tzload_r; one block of memory.  */
+typedef struct __tzfile_struct
+{
+  int count;		/* number of transitions */
+  int ntypes;
+  time_t *at;		/* times of the transitions, ascending */
+  unsigned char *type;	/* index in types of the type from each one on */
+  __ttinfo_type *types;	/* types[0] applies before the first one */
+  char *names;
+  char *rule;		/* POSIX TZ string for times from the last one on */
+  int has_rule;		/* whether rule was parsed into __gettzinfo () */
+  char *tzenv;		/* the value of TZ it was loaded for */
+  struct __tzfile_struct *next;	/* the zone loaded before it */
+} __tzfile_type;
+
+/* The zone TZ names, or NULL if it is a POSIX TZ string.  */
+extern __tzfile_type *__tzfile;
+
+__tzfile_type *__tzload_r (struct _reent *, const char *);
+const __ttinfo_type *__tzfile_find (const __tzfile_type *, time_t);
+const __ttinfo_type *__tzfile_local (const __tzfile_type *, time_t, int,
+				     long *);
+
+/* What localtime_r needs to know of the zone, published by
+   _tzset_unlocked_r for readers that take no lock.  */
+typedef struct __tzsnap_struct
+{
+  __tzinfo_type tz;		/* rules, with the limits of tz.__tzyear */
+  int daylight;
+  const __tzfile_type *file;
+  char **environ;		/* environ and __env_generation when TZ */
+  unsigned int env_generation;	/* was read */
+} __tzsnap_type;
+
+void __tzsnap_get (__tzsnap_type *);
+int __tzsnap_stale (void);
+
 /* locks for multi-threading */
 #ifdef __SINGLE_THREAD__
 #define TZ_LOCK
@@ -11,6 +11,8 @@
  * represented, returns the value (time_t) -1.
  *
  * Modifications:	Fixed tm_isdst usage - 27 August 2008 Craig Howland.
+ *			Count days with __days_from_civil() and normalize the
+ *			date with __civil_from_days(), in constant time.
  */
 
 /*
@@ -33,8 +35,9 @@ its representation from the traditional representation defined by
 
 RETURNS
 If the contents of the structure at <[timp]> do not form a valid
-calendar time representation, the result is <<-1>>.  Otherwise, the
-result is the time, converted to a <<time_t>> value.
+calendar time representation, or the time is out of the range of
+<<time_t>>, the result is <<-1>>.  Otherwise, the result is the time,
+converted to a <<time_t>> value.
 
 PORTABILITY
 ANSI C requires <<mktime>>.
@@ -43,6 +46,7 @@ ANSI C requires <<mktime>>.
 */
 
 #include <stdlib.h>
+#include <limits.h>
 #include <time.h>
 #include "local.h"
 
@@ -50,151 +54,105 @@ ANSI C requires <<mktime>>.
 #define _SEC_IN_HOUR 3600L
 #define _SEC_IN_DAY 86400L
 
-static const int DAYS_IN_MONTH[12] =
-{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-#define _DAYS_IN_MONTH(x) ((x == 1) ? days_in_feb : DAYS_IN_MONTH[x])
-
-static const int _DAYS_BEFORE_MONTH[12] =
-{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
-
-#define _ISLEAP(y) (((y) % 4) == 0 && (((y) % 100) != 0 || (((y)+1900) % 400) == 0))
-#define _DAYS_IN_YEAR(year) (_ISLEAP(year) ? 366 : 365)
-
-static void 
-validate_structure (struct tm *tim_p)
+/* the range of time_t, which is signed */
+#define _TIME_T_MAX ((time_t) ((((time_t) 1 << (sizeof (time_t) * 8 - 2)) - 1) * 2 + 1))
+#define _TIME_T_MIN (-_TIME_T_MAX - 1)
+
+/* Bring the fields of TIM_P into their ranges, set tm_yday and tm_wday,
+   and set *DAYS to the number of days from 1970-01-01 to the date.  The
+   carries are counted in a time_t, so that none of them overflows.
+   Returns 0, changing nothing, if the year is out of the range of
+   tm_year.  */
+static int
+validate_structure (struct tm *tim_p, time_t *days)
 {
-  div_t res;
-  int days_in_feb = 28;
+  time_t min, hour, mday, year;
+  int sec, mon;
 
   /* calculate time & date to account for out of range values */
-  if (tim_p->tm_sec < 0 || tim_p->tm_sec > 59)
+  min = tim_p->tm_min + (time_t) (tim_p->tm_sec / 60);
+  if ((sec = tim_p->tm_sec % 60) < 0)
     {
-      res = div (tim_p->tm_sec, 60);
-      tim_p->tm_min += res.quot;
-      if ((tim_p->tm_sec = res.rem) < 0)
-	{
-	  tim_p->tm_sec += 60;
-	  --tim_p->tm_min;
-	}
+      sec += 60;
+      --min;
     }
 
-  if (tim_p->tm_min < 0 || tim_p->tm_min > 59)
+  hour = tim_p->tm_hour + min / 60;
+  if ((min %= 60) < 0)
     {
-      res = div (tim_p->tm_min, 60);
-      tim_p->tm_hour += res.quot;
-      if ((tim_p->tm_min = res.rem) < 0)
-	{
-	  tim_p->tm_min += 60;
-	  --tim_p->tm_hour;
-        }
+      min += 60;
+      --hour;
     }
 
-  if (tim_p->tm_hour < 0 || tim_p->tm_hour > 23)
+  mday = tim_p->tm_mday + hour / 24;
+  if ((hour %= 24) < 0)
     {
-      res = div (tim_p->tm_hour, 24);
-      tim_p->tm_mday += res.quot;
-      if ((tim_p->tm_hour = res.rem) < 0)
-	{
-	  tim_p->tm_hour += 24;
-	  --tim_p->tm_mday;
-        }
+      hour += 24;
+      --mday;
     }
 
-  if (tim_p->tm_mon < 0 || tim_p->tm_mon > 11)
+  year = (time_t) tim_p->tm_year + YEAR_BASE + tim_p->tm_mon / 12;
+  if ((mon = tim_p->tm_mon % 12) < 0)
     {
-      res = div (tim_p->tm_mon, 12);
-      tim_p->tm_year += res.quot;
-      if ((tim_p->tm_mon = res.rem) < 0)
-        {
-	  tim_p->tm_mon += 12;
-	  --tim_p->tm_year;
-        }
+      mon += 12;
+      --year;
     }
 
-  if (_DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days_in_feb = 29;
-
-  if (tim_p->tm_mday <= 0)
-    {
-      while (tim_p->tm_mday <= 0)
-	{
-	  if (--tim_p->tm_mon == -1)
-	    {
-	      tim_p->tm_year--;
-	      tim_p->tm_mon = 11;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	  tim_p->tm_mday += _DAYS_IN_MONTH (tim_p->tm_mon);
-	}
-    }
-  else
-    {
-      while (tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
-	{
-	  tim_p->tm_mday -= _DAYS_IN_MONTH (tim_p->tm_mon);
-	  if (++tim_p->tm_mon == 12)
-	    {
-	      tim_p->tm_year++;
-	      tim_p->tm_mon = 0;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	}
-    }
+  *days = __days_from_civil (year, mon, mday);
+  if (!__civil_from_days (*days, tim_p))
+    return 0;
+  tim_p->tm_hour = (int) hour;
+  tim_p->tm_min = (int) min;
+  tim_p->tm_sec = sec;
+  return 1;
 }
 
 time_t 
 mktime (struct tm *tim_p)
 {
-  time_t tim = 0;
-  long days = 0;
-  int year, isdst=0;
+  time_t tim, days;
+  long secs, offset;
+  int isdst=0;
+  int diff = 0;
+  const __ttinfo_type *tt = NULL;
   __tzinfo_type *tz = __gettzinfo ();
 
-  /* validate structure */
-  validate_structure (tim_p);
+  /* validate structure, and compute the days since the epoch */
+  if (!validate_structure (tim_p, &days))
+    return (time_t) -1;
 
   /* compute hours, minutes, seconds */
-  tim += tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
+  secs = tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
     (tim_p->tm_hour * _SEC_IN_HOUR);
 
-  /* compute days in year */
-  days += tim_p->tm_mday - 1;
-  days += _DAYS_BEFORE_MONTH[tim_p->tm_mon];
-  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days++;
-
-  /* compute day of the year */
-  tim_p->tm_yday = days;
-
-  if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
-      return (time_t) -1;
-
-  /* compute days in other years */
-  if ((year = tim_p->tm_year) > 70)
-    {
-      for (year = 70; year < tim_p->tm_year; year++)
-	days += _DAYS_IN_YEAR (year);
-    }
-  else if (year < 70)
+  /* compute total seconds, if they fit in a time_t; a day before the
+     epoch is counted back from its end, so that the first seconds of the
+     range of time_t fit */
+  if (days < 0)
     {
-      for (year = 69; year > tim_p->tm_year; year--)
-	days -= _DAYS_IN_YEAR (year);
-      days -= _DAYS_IN_YEAR (year);
+      ++days;
+      secs -= _SEC_IN_DAY;
     }
-
-  /* compute total seconds */
-  tim += (time_t)days * _SEC_IN_DAY;
+  if (days > _TIME_T_MAX / _SEC_IN_DAY || days < _TIME_T_MIN / _SEC_IN_DAY)
+    return (time_t) -1;
+  tim = days * _SEC_IN_DAY;
+  if (secs > 0 ? tim > _TIME_T_MAX - secs : tim < _TIME_T_MIN - secs)
+    return (time_t) -1;
+  tim += secs;
 
   TZ_LOCK;
 
   _tzset_unlocked ();
 
-  if (_daylight)
+  if (__tzfile != NULL
+      && (tt = __tzfile_local (__tzfile, tim, tim_p->tm_isdst,
+			       &offset)) != NULL)
+    {
+      /* a time skipped by a transition comes out moved past it */
+      diff = (int) (offset - tt->offset);
+      isdst = tt->isdst;
+    }
+  else if (_daylight && tim_p->tm_year <= INT_MAX - YEAR_BASE)
     {
       int tm_isdst;
       int y = tim_p->tm_year + YEAR_BASE;
@@ -230,53 +188,44 @@ mktime (struct tm *tim_p)
 		     wrong. The diff is typically one hour, or 3600 seconds,
 		     and should fit in a 16-bit int, even though offset
 		     is a long to accomodate 12 hours. */
-		  int diff = (int) (tz->__tzrule[0].offset
-				    - tz->__tzrule[1].offset);
+		  diff = (int) (tz->__tzrule[0].offset
+				- tz->__tzrule[1].offset);
 		  if (!isdst)
 		    diff = -diff;
-		  tim_p->tm_sec += diff;
-		  tim += diff;  /* we also need to correct our current time calculation */
-		  int mday = tim_p->tm_mday;
-		  validate_structure (tim_p);
-		  mday = tim_p->tm_mday - mday;
-		  /* roll over occurred */
-		  if (mday) {
-		    /* compensate for month roll overs */
-		    if (mday > 1)
-			  mday = -1;
-		    else if (mday < -1)
-			  mday = 1;
-		    /* update days for wday calculation */
-		    days += mday;
-		    /* handle yday */
-		    if ((tim_p->tm_yday += mday) < 0) {
-			  --year;
-			  tim_p->tm_yday = _DAYS_IN_YEAR(year) - 1;
-		    } else {
-			  mday = _DAYS_IN_YEAR(year);
-			  if (tim_p->tm_yday > (mday - 1))
-				tim_p->tm_yday -= mday;
-		    }
-		  }
 		}
 	    }
 	}
     }
 
+  if (diff != 0)
+    {
+      tim_p->tm_sec += diff;
+      if (!validate_structure (tim_p, &days))
+	{
+	  tim_p->tm_sec -= diff;
+	  TZ_UNLOCK;
+	  return (time_t) -1;
+	}
+    }
+
   /* add appropriate offset to put time in gmt format */
-  if (isdst == 1)
-    tim += (time_t) tz->__tzrule[1].offset;
+  if (tt != NULL)
+    offset = tt->offset;
+  else if (isdst == 1)
+    offset = tz->__tzrule[1].offset;
   else /* otherwise assume std time */
-    tim += (time_t) tz->__tzrule[0].offset;
+    offset = tz->__tzrule[0].offset;
 
   TZ_UNLOCK;
 
   /* reset isdst flag to what we have calculated */
   tim_p->tm_isdst = isdst;
 
-  /* compute day of the week */
-  if ((tim_p->tm_wday = (days + 4) % 7) < 0)
-    tim_p->tm_wday += 7;
-	
+  /* the local time moves by diff, as tim_p did */
+  offset += diff;
+  if (offset > 0 ? tim > _TIME_T_MAX - offset : tim < _TIME_T_MIN - offset)
+    return (time_t) -1;
+  tim += offset;
+
   return tim;
 }
@@ -386,6 +386,26 @@ iso_year_adjust (const struct tm *tim_p)
 #undef PACK
 }
 
+#if !defined (__CYGWIN__) && (!defined (__TM_GMTOFF) || !defined (__TM_ZONE))
+/* The type of the zone file that TZ names for the local time at TIM_P,
+   found as mktime finds it, or NULL if TZ names none or its rule applies
+   to the time.  Called with the TZ lock held, which mktime takes.  */
+static const __ttinfo_type *
+tzfile_type (const struct tm *tim_p)
+{
+  time_t local;
+  long offset;
+
+  if (__tzfile == NULL || tim_p->tm_mon < 0 || tim_p->tm_mon > 11)
+    return NULL;
+  local = __days_from_civil ((time_t) tim_p->tm_year + YEAR_BASE,
+			     tim_p->tm_mon, tim_p->tm_mday) * SECSPERDAY
+	  + tim_p->tm_hour * (time_t) SECSPERHOUR
+	  + tim_p->tm_min * (time_t) SECSPERMIN + tim_p->tm_sec;
+  return __tzfile_local (__tzfile, local, tim_p->tm_isdst, &offset);
+}
+#endif
+
 #ifdef _WANT_C99_TIME_FORMATS
 typedef struct {
   int   year;
@@ -1142,10 +1162,12 @@ recurse:
 		offset = tim_p->__TM_GMTOFF;
 #else
 		__tzinfo_type *tz = __gettzinfo ();
+		const __ttinfo_type *tt = tzfile_type (tim_p);
 		/* The sign of this is exactly opposite the envvar TZ.  We
 		   could directly use the global _timezone for tm_isdst==0,
 		   but have to use __tzrule for daylight savings.  */
-		offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
+		offset = tt != NULL ? -tt->offset
+			 : -tz->__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
 		TZ_UNLOCK;
 	      }
@@ -1354,10 +1376,13 @@ recurse:
 	      offset = tim_p->__TM_GMTOFF;
 #else
 	      __tzinfo_type *tz = __gettzinfo ();
+	      const __ttinfo_type *tt = tzfile_type (tim_p);
 	      /* The sign of this is exactly opposite the envvar TZ.  We
 		 could directly use the global _timezone for tm_isdst==0,
-		 but have to use __tzrule for daylight savings.  */
-	      offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
+		 but have to use __tzrule for daylight savings, and the type
+		 of a zone file for the times before its rule.  */
+	      offset = tt != NULL ? -tt->offset
+		       : -tz->__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
 	      TZ_UNLOCK;
 	      len = snprintf (&s[count], maxsize - count, CQ("%+03ld%.2ld"),
@@ -1384,6 +1409,10 @@ recurse:
 	      tznam = __cygwin_gettzname (tim_p);
 #elif defined (__TM_ZONE)
 	      tznam = tim_p->__TM_ZONE;
+#else
+	      const __ttinfo_type *tt = tzfile_type (tim_p);
+	      if (tt != NULL)
+		tznam = __tzfile->names + tt->abbr;
 #endif
 	      if (!tznam)
 		tznam = _tzname[tim_p->tm_isdst > 0];
@@ -88,15 +88,16 @@ match_string (const char *__restrict *buf, const char * const*strs,
     return -1;
 }
 
-/* Needed for strptime. */
+/*
+ * Day of the week of January 1 of `year', which repeats every 400 years.
+ * Needed for strptime.
+ */
 static int
 first_day (int year)
 {
-    int ret = 4;
+    int y = ((year - 1) % 400 + 400) % 400;
 
-    while (--year >= 1970)
-	ret = (ret + 365 + is_leap_year (year)) % 7;
-    return ret;
+    return (1 + 5 * (y % 4) + 4 * (y % 100) + 6 * y) % 7;
 }
 
 /*
@@ -6,6 +6,7 @@
  * - Fixed bug in mday computations - 08/12/04, Alex Mogilnikov <alx@intellectronika.ru>
  * - Fixed bug in __tzcalc_limits - 08/12/04, Alex Mogilnikov <alx@intellectronika.ru>
  * - Moved __tzcalc_limits() to separate file - 05/09/14, Freddie Chopin <freddie_chopin@op.pl>
+ * - Count days with __days_from_civil() instead of a loop over the months
  */
 
 #include "local.h"
@@ -13,21 +14,22 @@
 int
 __tzcalc_limits (int year)
 {
-  int days, year_days, years;
-  int i, j;
-  __tzinfo_type *const tz = __gettzinfo ();
+  return __tzcalc_limits_of (__gettzinfo (), year);
+}
+
+/* Compute the times of the changes of the rules of TZ in YEAR.  */
+int
+__tzcalc_limits_of (__tzinfo_type *tz, int year)
+{
+  time_t days, year_days;
+  int i;
 
   if (year < EPOCH_YEAR)
     return 0;
 
   tz->__tzyear = year;
 
-  years = (year - EPOCH_YEAR);
-
-  year_days = years * 365 +
-    (years - 1 + EPOCH_YEARS_SINCE_LEAP) / 4 -
-    (years - 1 + EPOCH_YEARS_SINCE_CENTURY) / 100 +
-    (years - 1 + EPOCH_YEARS_SINCE_LEAP_CENTURY) / 400;
+  year_days = __days_from_civil (year, 0, 1);
 
   for (i = 0; i < 2; ++i)
     {
@@ -46,20 +48,18 @@ __tzcalc_limits (int year)
 	  const int yleap = isleap(year);
 	  int m_day, m_wday, wday_diff;
 	  const int *const ip = __month_lengths[yleap];
+	  const int m = tz->__tzrule[i].m;
 
-	  days = year_days;
-
-	  for (j = 1; j < tz->__tzrule[i].m; ++j)
-	    days += ip[j-1];
+	  days = __days_from_civil (year, m - 1, 1);
 
-	  m_wday = (EPOCH_WDAY + days) % DAYSPERWEEK;
+	  m_wday = (int) ((EPOCH_WDAY + days) % DAYSPERWEEK);
 
 	  wday_diff = tz->__tzrule[i].d - m_wday;
 	  if (wday_diff < 0)
 	    wday_diff += DAYSPERWEEK;
 	  m_day = (tz->__tzrule[i].n - 1) * DAYSPERWEEK + wday_diff;
 
-	  while (m_day >= ip[j-1])
+	  while (m_day >= ip[m-1])
 	    m_day -= DAYSPERWEEK;
 
 	  days += m_day;
@@ -0,0 +1,313 @@
+/*
+ * tzfile.c
+ * Loads compiled zone files in the TZif format of RFC 8536, as written
+ * by zic, for TZ values such as ":Europe/Berlin", and looks up the local
+ * time type for a time in their table of transitions.
+ *
+ * A relative name is looked up in the directory TZDIR from the
+ * environment, else in TZDEFAULTDIR.  Leap second records are ignored,
+ * since time_t does not count leap seconds.
+ */
+
+#include <_ansi.h>
+#include <reent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include "local.h"
+
+#ifndef TZDEFAULTDIR
+#define TZDEFAULTDIR	"/usr/share/zoneinfo"
+#endif
+
+/* Limits on what a zone file may hold, much as in tzcode's tzfile.h.  */
+#define TZ_MAX_TIMES	2000
+#define TZ_MAX_TYPES	256
+#define TZ_MAX_CHARS	256
+#define TZ_MAX_FILE	65536
+
+#define TZIF_HEADER	44
+
+__tzfile_type *__tzfile;
+
+static __uint32_t
+get32 (const unsigned char *p)
+{
+  return (__uint32_t) p[0] << 24 | (__uint32_t) p[1] << 16
+	 | (__uint32_t) p[2] << 8 | p[3];
+}
+
+/* Read the whole of file NAME into memory.  */
+static unsigned char *
+read_file (struct _reent *reent_ptr, const char *name, size_t *len)
+{
+  unsigned char *buf = NULL, *nbuf;
+  size_t size = 0;
+  _ssize_t n;
+  int fd;
+
+  if ((fd = _open_r (reent_ptr, name, O_RDONLY, 0)) < 0)
+    return NULL;
+
+  *len = 0;
+  do
+    {
+      if (*len == size)
+	{
+	  size = size ? size * 2 : 4096;
+	  if (size > TZ_MAX_FILE
+	      || (nbuf = _realloc_r (reent_ptr, buf, size)) == NULL)
+	    {
+	      _free_r (reent_ptr, buf);
+	      _close_r (reent_ptr, fd);
+	      return NULL;
+	    }
+	  buf = nbuf;
+	}
+      n = _read_r (reent_ptr, fd, buf + *len, size - *len);
+      if (n > 0)
+	*len += n;
+    }
+  while (n > 0);
+
+  _close_r (reent_ptr, fd);
+  if (n < 0)
+    {
+      _free_r (reent_ptr, buf);
+      return NULL;
+    }
+  return buf;
+}
+
+/* Parse the header at P of a data block, of which there are LEN bytes
+   from P on, with times of SIZE bytes.  Stores the six counts and returns
+   the size of the block, or 0 if it is no TZif data.  */
+static size_t
+block_size (const unsigned char *p, size_t len, int size, __uint32_t *cnt)
+{
+  int i;
+
+  if (len < TZIF_HEADER || memcmp (p, "TZif", 4) != 0)
+    return 0;
+
+  /* isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt */
+  for (i = 0; i < 6; i++)
+    cnt[i] = get32 (p + 20 + 4 * i);
+  if (cnt[3] > TZ_MAX_TIMES || cnt[4] == 0 || cnt[4] > TZ_MAX_TYPES
+      || cnt[5] == 0 || cnt[5] > TZ_MAX_CHARS || cnt[2] > TZ_MAX_TIMES
+      || cnt[1] > cnt[4] || cnt[0] > cnt[4])
+    return 0;
+
+  return TZIF_HEADER + cnt[3] * (size + 1) + cnt[4] * 6 + cnt[5]
+	 + cnt[2] * (size + 4) + cnt[1] + cnt[0];
+}
+
+static __tzfile_type *
+parse (struct _reent *reent_ptr, const unsigned char *buf, size_t len)
+{
+  __tzfile_type *f;
+  const unsigned char *p, *rule = NULL;
+  __uint32_t cnt[6];
+  size_t n, rulelen = 0;
+  int size = 4;
+  __uint32_t i, k;
+  __int64_t t, prev = 0;
+
+  if ((n = block_size (buf, len, 4, cnt)) == 0 || n > len)
+    return NULL;
+
+  /* Version 2 and later repeat the data with 64-bit times, followed by
+     the TZ string for later times between newlines.  */
+  if (buf[4] >= '2')
+    {
+      p = buf + n;
+      len -= n;
+      size = 8;
+      if ((n = block_size (p, len, 8, cnt)) == 0 || n > len)
+	return NULL;
+      buf = p;
+      if (n < len && buf[n] == '\n')
+	{
+	  rule = buf + n + 1;
+	  p = memchr (rule, '\n', len - n - 1);
+	  if (p == NULL)
+	    return NULL;
+	  rulelen = p - rule;
+	}
+    }
+
+  f = _malloc_r (reent_ptr, sizeof (__tzfile_type)
+			    + cnt[3] * sizeof (time_t)
+			    + cnt[4] * sizeof (__ttinfo_type)
+			    + cnt[3] + cnt[5] + 1 + rulelen + 1);
+  if (f == NULL)
+    return NULL;
+
+  f->count = cnt[3];
+  f->ntypes = cnt[4];
+  f->at = (time_t *) (f + 1);
+  f->types = (__ttinfo_type *) (f->at + f->count);
+  f->type = (unsigned char *) (f->types + f->ntypes);
+  f->names = (char *) f->type + f->count;
+  f->rule = f->names + cnt[5] + 1;
+  f->has_rule = 0;
+
+  /* A 32-bit time_t keeps the last transition before its range, at its
+     least value, and none after it.  */
+  p = buf + TZIF_HEADER;
+  for (i = 0, k = 0; i < cnt[3]; i++)
+    {
+      if (size == 8)
+	t = (__int64_t) ((__uint64_t) get32 (p + 8 * i) << 32
+			 | get32 (p + 8 * i + 4));
+      else
+	t = (__int32_t) get32 (p + 4 * i);
+      if ((i > 0 && t <= prev) || p[cnt[3] * size + i] >= cnt[4])
+	goto bad;
+      prev = t;
+      if (sizeof (time_t) < 8)
+	{
+	  if (t > 0x7fffffffL)
+	    break;
+	  if (t < -0x7fffffffL - 1)
+	    t = -0x7fffffffL - 1;
+	  if (k > 0 && f->at[k - 1] == (time_t) t)
+	    k--;
+	}
+      f->at[k] = (time_t) t;
+      f->type[k++] = p[cnt[3] * size + i];
+    }
+  f->count = k;
+
+  p += cnt[3] * (size + 1);
+  for (i = 0; i < cnt[4]; i++, p += 6)
+    {
+      f->types[i].offset = -(long) (__int32_t) get32 (p);
+      f->types[i].isdst = p[4] != 0;
+      f->types[i].abbr = p[5];
+      if (p[5] >= cnt[5])
+	goto bad;
+    }
+  memcpy (f->names, p, cnt[5]);
+  f->names[cnt[5]] = '\0';
+  if (rulelen > 0)
+    memcpy (f->rule, rule, rulelen);
+  f->rule[rulelen] = '\0';
+  return f;
+
+bad:
+  _free_r (reent_ptr, f);
+  return NULL;
+}
+
+/* Load the zone file for the TZ value NAME, without its leading ':'.
+   Returns NULL if there is no such file or it is not in TZif format.  */
+__tzfile_type *
+__tzload_r (struct _reent *reent_ptr, const char *name)
+{
+  __tzfile_type *f;
+  unsigned char *buf;
+  char *path = NULL;
+  const char *dir;
+  size_t len;
+
+  if (*name == '\0')
+    return NULL;
+
+  if (*name != '/')
+    {
+      if (strstr (name, "..") != NULL)
+	return NULL;
+      if ((dir = _getenv_r (reent_ptr, "TZDIR")) == NULL || *dir == '\0')
+	dir = TZDEFAULTDIR;
+      path = _malloc_r (reent_ptr, strlen (dir) + strlen (name) + 2);
+      if (path == NULL)
+	return NULL;
+      strcpy (path, dir);
+      strcat (path, "/");
+      strcat (path, name);
+      name = path;
+    }
+
+  buf = read_file (reent_ptr, name, &len);
+  _free_r (reent_ptr, path);
+  if (buf == NULL)
+    return NULL;
+
+  f = parse (reent_ptr, buf, len);
+  _free_r (reent_ptr, buf);
+  return f;
+}
+
+/* Number of the last transition at or before T, -1 if none.  */
+static int
+find (const __tzfile_type *f, time_t t)
+{
+  int lo = 0, hi = f->count, mid;
+
+  while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (f->at[mid] <= t)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo - 1;
+}
+
+static const __ttinfo_type *
+type_after (const __tzfile_type *f, int i)
+{
+  return &f->types[i < 0 ? 0 : f->type[i]];
+}
+
+/* The local time type for T in zone F, or NULL if its rule applies to
+   T.  */
+const __ttinfo_type *
+__tzfile_find (const __tzfile_type *f, time_t t)
+{
+  if (f->has_rule && (f->count == 0 || t >= f->at[f->count - 1]))
+    return NULL;
+  return type_after (f, find (f, t));
+}
+
+/* The local time type for the local time LOCAL, in seconds since the
+   epoch as if it were UTC.  LOCAL plus *OFFSET is the UTC time, and the
+   type returned is the one in effect then.  Of the types around LOCAL,
+   prefers one whose isdst is ISDST, if that is not negative, then one in
+   which LOCAL occurs, then the earliest.  So a time that occurs twice
+   gets the earlier type unless ISDST asks for the other, and a time that
+   is skipped, or given with the wrong ISDST, comes out moved by the
+   difference of the offsets, as for a POSIX TZ string.  Returns NULL if
+   the rule applies to LOCAL.  */
+const __ttinfo_type *
+__tzfile_local (const __tzfile_type *f, time_t local, int isdst, long *offset)
+{
+  const __ttinfo_type *tt, *best = NULL;
+  int i, j, rank, best_rank = 0;
+
+  if (f->has_rule
+      && (f->count == 0 || local - SECSPERDAY >= f->at[f->count - 1]))
+    return NULL;
+
+  /* Offsets are less than a day, so the transition in effect at the UTC
+     time is at most one away from the one at LOCAL.  */
+  i = find (f, local);
+  for (j = i - 1; j <= i + 1 && j < f->count; j++)
+    {
+      tt = type_after (f, j);
+      rank = (isdst >= 0 && tt->isdst == (isdst > 0)) * 2
+	     + (type_after (f, find (f, local + tt->offset))->offset
+		== tt->offset);
+      if (best == NULL || rank > best_rank)
+	{
+	  best = tt;
+	  best_rank = rank;
+	}
+    }
+
+  *offset = best->offset;
+  return type_after (f, find (f, local + best->offset));
+}
@@ -42,7 +42,24 @@ where: std is the name of the standard time-zone (minimum 3 chars)
 
 Note that there is no white-space padding between fields.  Also note that
 if TZ is null, the default is Universal GMT which has no daylight-savings
-time.  If TZ is empty, the default EST5EDT is used.
+time.  If TZ is empty, the default EST5EDT is used.  A zone name may also
+be given between < and >, in which case it may contain digits and signs,
+as in +0330 in the TZ value <+0330>-3:30.
+
+A TZ value that starts with a colon, or that contains no digits, may
+instead name a zone file in the TZif format written by zic, such as
+<<:Europe/Berlin>>.  A name that is not an absolute path is looked up in
+the directory named by the TZDIR environment variable, else in
+/usr/share/zoneinfo.  The file gives the past transitions of the zone,
+and, from version 2 on, a POSIX TZ string for later times.  <<_timezone>>
+and <<tzname>> are then those of that string, or of the last transitions
+if there is none.  If there is no such file, TZ is read as above.  A
+zone file is read only the first time TZ names it.
+
+<<localtime>> and <<mktime>> see a new TZ set with <<setenv>>,
+<<putenv>> or <<unsetenv>>, or in a new <<environ>>, without a call of
+<<tzset>>, and <<localtime>> then takes no lock.  A TZ changed in place
+in the strings of <<environ>> is seen only after <<tzset>>.
 
 The function <<_tzset_r>> is identical to <<tzset>> only it is reentrant
 and is used for applications that use multiple threads.
@@ -53,7 +70,8 @@ There is no return value.
 PORTABILITY
 <<tzset>> is part of the POSIX standard.
 
-Supporting OS subroutine required: None
+Supporting OS subroutines required: <<open>>, <<read>>, <<close>>, for
+zone files.
 */
 
 #include <_ansi.h>
@@ -61,10 +79,13 @@ Supporting OS subroutine required: None
 #include <time.h>
 #include "local.h"
 
+/* Set the zone from TZ if it may have changed, without reading the
+   environment if it has not.  */
 void
 _tzset_unlocked (void)
 {
-  _tzset_unlocked_r (_REENT);
+  if (__tzsnap_stale ())
+    _tzset_unlocked_r (_REENT);
 }
 
 void
@@ -5,48 +5,67 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#include <envlock.h>
 #include "local.h"
 
 #define sscanf siscanf	/* avoid to pull in FP functions. */
 
+#ifdef __SINGLE_THREAD__
+#define LOAD(p, order)		(*(p))
+#define STORE(p, v, order)	(*(p) = (v))
+#define FENCE(order)
+#else
+#define LOAD(p, order)		__atomic_load_n (p, __ATOMIC_##order)
+#define STORE(p, v, order)	__atomic_store_n (p, v, __ATOMIC_##order)
+#define FENCE(order)		__atomic_thread_fence (__ATOMIC_##order)
+#endif
+
+extern char **environ;
+
+/* Only deal with a pointer to environ, as getenv_r.c does.  */
+static char ***p_environ = &environ;
+
 static char __tzname_std[11];
 static char __tzname_dst[11];
 static char *prev_tzenv = NULL;
 
-void
-_tzset_unlocked_r (struct _reent *reent_ptr)
-{
-  char *tzenv;
-  unsigned short hh, mm, ss, m, w, d;
-  int sign, n;
-  int i, ch;
-  __tzinfo_type *tz = __gettzinfo ();
+/* The zone files loaded so far, latest first.  None is ever freed, as
+   localtime_r may still be reading one that TZ no longer names, and a
+   file is read only the first time TZ names it.  */
+static __tzfile_type *tzfiles = NULL;
 
-  if ((tzenv = _getenv_r (reent_ptr, "TZ")) == NULL)
-      {
-	_timezone = 0;
-	_daylight = 0;
-	_tzname[0] = "GMT";
-	_tzname[1] = "GMT";
-	free(prev_tzenv);
-	prev_tzenv = NULL;
-	return;
-      }
+/* The zone as localtime_r sees it, which it reads without the lock.
+   tzsnap_seq is odd while tzsnap is being written, and 0 until it first
+   is, so that a reader that finds it unchanged across its copy of tzsnap
+   knows the copy is whole.  */
+static __tzsnap_type tzsnap;
+static unsigned int tzsnap_seq = 0;
 
-  if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
-    return;
+/* Scan a zone name into NAME, either letters or, between < and >, also
+   digits and signs.  Returns its length in TZENV, or 0 if there is none.  */
+static int
+scan_name (const char *tzenv, char *name)
+{
+  int n = 0;
 
-  free(prev_tzenv);
-  prev_tzenv = _malloc_r (reent_ptr, strlen(tzenv) + 1);
-  if (prev_tzenv != NULL)
-    strcpy (prev_tzenv, tzenv);
+  if (*tzenv == '<')
+    sscanf (tzenv, "<%10[-+0-9A-Za-z]>%n", name, &n);
+  else
+    sscanf (tzenv, "%10[^0-9,+-]%n", name, &n);
+  return n;
+}
 
-  /* ignore implementation-specific format specifier */
-  if (*tzenv == ':')
-    ++tzenv;  
+/* Parse the POSIX TZ string TZENV into TZ, _tzname, _timezone and
+   _daylight.  Returns 0 if it is not valid.  */
+static int
+tzparse (__tzinfo_type *tz, const char *tzenv)
+{
+  unsigned short hh, mm, ss, m, w, d;
+  int sign, n;
+  int i, ch;
 
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_std, &n) <= 0)
-    return;
+  if ((n = scan_name (tzenv, __tzname_std)) == 0)
+    return 0;
  
   tzenv += n;
 
@@ -63,18 +82,18 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   ss = 0;
  
   if (sscanf (tzenv, "%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n) < 1)
-    return;
+    return 0;
   
   tz->__tzrule[0].offset = sign * (ss + SECSPERMIN * mm + SECSPERHOUR * hh);
   _tzname[0] = __tzname_std;
   tzenv += n;
   
-  if (sscanf (tzenv, "%10[^0-9,+-]%n", __tzname_dst, &n) <= 0)
+  if ((n = scan_name (tzenv, __tzname_dst)) == 0)
     { /* No dst */
       _tzname[1] = _tzname[0];
       _timezone = tz->__tzrule[0].offset;
       _daylight = 0;
-      return;
+      return 1;
     }
   else
     _tzname[1] = __tzname_dst;
@@ -112,7 +131,7 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
 	{
 	  if (sscanf (tzenv, "M%hu%n.%hu%n.%hu%n", &m, &n, &w, &n, &d, &n) != 3 ||
 	      m < 1 || m > 12 || w < 1 || w > 5 || d > 6)
-	    return;
+	    return 0;
 	  
 	  tz->__tzrule[i].ch = 'M';
 	  tz->__tzrule[i].m = m;
@@ -163,16 +182,28 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
 	  tzenv = end;
 	}
       
-      /* default time is 02:00:00 am */
+      /* default time is 02:00:00 am; zone files also use times before
+	 midnight and past the next one, such as -1 and 25 */
       hh = 2;
       mm = 0;
       ss = 0;
       n = 0;
+      sign = 1;
       
       if (*tzenv == '/')
-	sscanf (tzenv, "/%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n);
+	{
+	  ++tzenv;
+	  if (*tzenv == '-')
+	    {
+	      sign = -1;
+	      ++tzenv;
+	    }
+	  else if (*tzenv == '+')
+	    ++tzenv;
+	  sscanf (tzenv, "%hu%n:%hu%n:%hu%n", &hh, &n, &mm, &n, &ss, &n);
+	}
 
-      tz->__tzrule[i].s = ss + SECSPERMIN * mm + SECSPERHOUR  * hh;
+      tz->__tzrule[i].s = sign * (ss + SECSPERMIN * mm + SECSPERHOUR  * hh);
       
       tzenv += n;
     }
@@ -180,6 +211,168 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   __tzcalc_limits (tz->__tzyear);
   _timezone = tz->__tzrule[0].offset;  
   _daylight = tz->__tzrule[0].offset != tz->__tzrule[1].offset;
+  return 1;
+}
+
+/* Make F the zone.  _tzname, _timezone, _daylight and the offsets of
+   the rules in TZ are those of its rule if it has one, else of its last
+   transitions.  LOADED is nonzero if F was just read.  */
+static void
+tzset_file (__tzinfo_type *tz, __tzfile_type *f, int loaded)
+{
+  const __ttinfo_type *std = NULL, *dst = NULL, *tt;
+  int i;
+
+  __tzfile = f;
+
+  /* has_rule does not change once readers may see F */
+  if (loaded)
+    f->has_rule = *f->rule != '\0' && tzparse (tz, f->rule);
+  else if (f->has_rule)
+    tzparse (tz, f->rule);
+  if (f->has_rule)
+    return;
+
+  /* over what a rule that is not valid may have set */
+  for (i = f->count - 1; i >= 0 && (std == NULL || dst == NULL); i--)
+    {
+      tt = &f->types[f->type[i]];
+      if (!tt->isdst && std == NULL)
+	std = tt;
+      else if (tt->isdst && dst == NULL)
+	dst = tt;
+    }
+  if (std == NULL)
+    std = &f->types[0];
+
+  _tzname[0] = f->names + std->abbr;
+  _tzname[1] = dst != NULL ? f->names + dst->abbr : _tzname[0];
+  _timezone = std->offset;
+  _daylight = dst != NULL;
+  tz->__tzrule[0].offset = std->offset;
+  tz->__tzrule[1].offset = dst != NULL ? dst->offset : std->offset;
+}
+
+static void
+tzset_env (struct _reent *reent_ptr)
+{
+  char *tzenv;
+  __tzinfo_type *tz = __gettzinfo ();
+  __tzfile_type *f;
+
+  if ((tzenv = _getenv_r (reent_ptr, "TZ")) == NULL)
+      {
+	_timezone = 0;
+	_daylight = 0;
+	_tzname[0] = "GMT";
+	_tzname[1] = "GMT";
+	tz->__tzrule[0].offset = 0;
+	tz->__tzrule[1].offset = 0;
+	free(prev_tzenv);
+	prev_tzenv = NULL;
+	__tzfile = NULL;
+	return;
+      }
+
+  if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
+    return;
+
+  free(prev_tzenv);
+  prev_tzenv = _malloc_r (reent_ptr, strlen(tzenv) + 1);
+  if (prev_tzenv != NULL)
+    strcpy (prev_tzenv, tzenv);
+
+  __tzfile = NULL;
+
+  /* a zone file name follows ':', or is given without an offset */
+  if (*tzenv == ':' || strpbrk (tzenv, "0123456789") == NULL)
+    {
+      for (f = tzfiles; f != NULL; f = f->next)
+	if (strcmp (f->tzenv, tzenv) == 0)
+	  {
+	    tzset_file (tz, f, 0);
+	    return;
+	  }
+
+      f = __tzload_r (reent_ptr, *tzenv == ':' ? tzenv + 1 : tzenv);
+      if (f != NULL
+	  && (f->tzenv = _malloc_r (reent_ptr, strlen (tzenv) + 1)) == NULL)
+	{
+	  _free_r (reent_ptr, f);
+	  f = NULL;
+	}
+      if (f != NULL)
+	{
+	  strcpy (f->tzenv, tzenv);
+	  f->next = tzfiles;
+	  tzfiles = f;
+	  tzset_file (tz, f, 1);
+	  return;
+	}
+    }
+
+  /* ignore implementation-specific format specifier */
+  if (*tzenv == ':')
+    ++tzenv;  
+
+  tzparse (tz, tzenv);
+}
+
+/* Whether TZ may have changed since the zone was last set, as environ
+   has been replaced or changed by the setenv family since then.  Called
+   with the lock held.  */
+int
+__tzsnap_stale (void)
+{
+  return tzsnap_seq == 0 || tzsnap.environ != *p_environ
+	 || tzsnap.env_generation != LOAD (&__env_generation, ACQUIRE);
+}
+
+/* Copy the zone to *SNAP, setting it from TZ first if TZ may have changed
+   since it last was.  Takes no lock unless it must set the zone.  */
+void
+__tzsnap_get (__tzsnap_type *snap)
+{
+  unsigned int seq;
+
+  for (;;)
+    {
+      seq = LOAD (&tzsnap_seq, ACQUIRE);
+      if (seq != 0 && (seq & 1) == 0)
+	{
+	  *snap = tzsnap;
+	  FENCE (ACQUIRE);
+	  if (LOAD (&tzsnap_seq, RELAXED) == seq
+	      && snap->environ == *p_environ
+	      && snap->env_generation == LOAD (&__env_generation, ACQUIRE))
+	    return;
+	}
+
+      TZ_LOCK;
+      if (__tzsnap_stale ())
+	_tzset_unlocked_r (_REENT);
+      TZ_UNLOCK;
+    }
+}
+
+void
+_tzset_unlocked_r (struct _reent *reent_ptr)
+{
+  /* what TZ is read from, before it is */
+  char **env = *p_environ;
+  unsigned int generation = LOAD (&__env_generation, ACQUIRE);
+  unsigned int seq = tzsnap_seq;
+
+  tzset_env (reent_ptr);
+
+  STORE (&tzsnap_seq, seq + 1, RELAXED);
+  FENCE (RELEASE);
+  tzsnap.tz = *__gettzinfo ();
+  tzsnap.daylight = _daylight;
+  tzsnap.file = __tzfile;
+  tzsnap.environ = env;
+  tzsnap.env_generation = generation;
+  STORE (&tzsnap_seq, seq + 2, RELEASE);
 }
 
 void
@@ -46,6 +46,149 @@
 
 #include "xdr_private.h"
 
+/* most bytes of elements to ask x_inline for at once */
+#define XDR_BULK_CHUNK 16384
+
+/*
+ * The size of the elements that elproc translates as one or two whole
+ * words, with no check of their values, or 0 if it is none of those.
+ * *hi is set to the number of the word of a two-word element that goes
+ * first in the stream.
+ */
+static u_int
+bulk_size (xdrproc_t elproc,
+	int *hi)
+{
+  *hi = 0;
+  if (elproc == (xdrproc_t) xdr_int32_t || elproc == (xdrproc_t) xdr_uint32_t
+      || elproc == (xdrproc_t) xdr_u_int32_t)
+    return sizeof (int32_t);
+#if INT_MAX == 0x7fffffff
+  if (elproc == (xdrproc_t) xdr_int || elproc == (xdrproc_t) xdr_u_int)
+    return sizeof (int32_t);
+#endif
+#if LONG_MAX == 0x7fffffffL
+  if (elproc == (xdrproc_t) xdr_long || elproc == (xdrproc_t) xdr_u_long)
+    return sizeof (int32_t);
+#endif
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+  if (elproc == (xdrproc_t) xdr_float)
+    return sizeof (int32_t);
+#if !defined(_DOUBLE_IS_32BITS)
+  if (elproc == (xdrproc_t) xdr_double)
+    {
+#if defined(__IEEE_LITTLE_ENDIAN)
+      *hi = 1;
+#endif
+      return 2 * sizeof (int32_t);
+    }
+#endif /* !_DOUBLE_IS_32BITS */
+#endif /* __IEEE_LITTLE_ENDIAN || __IEEE_BIG_ENDIAN */
+#if defined(___int64_t_defined)
+  if (elproc == (xdrproc_t) xdr_int64_t || elproc == (xdrproc_t) xdr_uint64_t
+      || elproc == (xdrproc_t) xdr_u_int64_t
+      || elproc == (xdrproc_t) xdr_hyper || elproc == (xdrproc_t) xdr_u_hyper
+      || elproc == (xdrproc_t) xdr_longlong_t
+      || elproc == (xdrproc_t) xdr_u_longlong_t)
+    {
+#if BYTE_ORDER == LITTLE_ENDIAN
+      *hi = 1;
+#endif
+      return 2 * sizeof (int32_t);
+    }
+#endif /* ___int64_t_defined */
+  return 0;
+}
+
+/*
+ * Copy nwords words from src to dst, changing the order of their bytes
+ * between host and network order, and swapping the words of each pair
+ * if hi is set.  The same copy encodes and decodes.  It uses __ntohl of
+ * <machine/endian.h>, a builtin the compiler can vectorize, rather than
+ * xdr_ntohl.
+ */
+static void
+swap_words (u_int32_t *__restrict dst,
+	const u_int32_t *__restrict src,
+	u_int nwords,
+	int hi)
+{
+  u_int i;
+
+  if (hi)
+    for (i = 0; i < nwords; i += 2)
+      {
+        dst[i] = __ntohl (src[i + 1]);
+        dst[i + 1] = __ntohl (src[i]);
+      }
+  else
+    for (i = 0; i < nwords; i++)
+      dst[i] = __ntohl (src[i]);
+}
+
+/*
+ * XDR nelem elements at basep in bulk, if elproc is one of the
+ * procedures for fixed-size primitives: a chunk at a time in the buffer
+ * of the stream, where x_inline gives it room, else an element at a time
+ * with elproc.  Returns -1, having done nothing, if elproc is not one of
+ * them or elsize is not the size of its elements.
+ */
+static int
+xdr_bulk (XDR * xdrs,
+	char *basep,
+	u_int nelem,
+	u_int elsize,
+	xdrproc_t elproc)
+{
+  u_int size, n;
+  int hi, failed = 0;
+  int32_t *buf;
+
+  if ((size = bulk_size (elproc, &hi)) == 0 || size != elsize)
+    return -1;
+  if (xdrs->x_op == XDR_FREE)
+    return TRUE;
+
+  while (nelem > 0)
+    {
+      n = MIN (nelem, XDR_BULK_CHUNK / size);
+      while ((buf = XDR_INLINE (xdrs, n * size)) == NULL && n > 1)
+        n /= 2;
+
+      if (buf != NULL)
+        {
+          if (xdrs->x_op == XDR_ENCODE)
+            swap_words ((u_int32_t *) buf, (u_int32_t *) basep,
+                        n * size / sizeof (int32_t), hi);
+          else
+            swap_words ((u_int32_t *) basep, (u_int32_t *) buf,
+                        n * size / sizeof (int32_t), hi);
+          failed = 0;
+        }
+      else
+        {
+          /*
+           * No room even for one element: let elproc fill or empty the
+           * buffer, and give up on x_inline if there is still none, as
+           * the stream may have no buffer to give.
+           */
+          if (failed)
+            break;
+          if (!(*elproc) (xdrs, basep))
+            return FALSE;
+          failed = 1;
+          n = 1;
+        }
+      basep += n * size;
+      nelem -= n;
+    }
+
+  for (; nelem > 0; nelem--, basep += size)
+    if (!(*elproc) (xdrs, basep))
+      return FALSE;
+  return TRUE;
+}
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -107,13 +250,14 @@ xdr_array (XDR * xdrs,
       }
 
   /*
-   * now we xdr each element of array
+   * now we xdr each element of array, in bulk if we can
    */
-  for (i = 0; (i < c) && stat; i++)
-    {
-      stat = (*elproc) (xdrs, target);
-      target += elsize;
-    }
+  if ((stat = xdr_bulk (xdrs, target, c, elsize, elproc)) < 0)
+    for (stat = TRUE, i = 0; (i < c) && stat; i++)
+      {
+        stat = (*elproc) (xdrs, target);
+        target += elsize;
+      }
 
   /*
    * the array may need freeing
@@ -145,6 +289,10 @@ xdr_vector (XDR * xdrs,
 {
   u_int i;
   char *elptr;
+  int stat;
+
+  if ((stat = xdr_bulk (xdrs, basep, nelem, elemsize, xdr_elem)) >= 0)
+    return stat;
 
   elptr = basep;
   for (i = 0; i < nelem; i++)
@@ -124,6 +124,7 @@ typedef struct rec_strm
   caddr_t out_boundry;          /* data cannot up to this address */
   u_int32_t *frag_header;       /* beginning of curren fragment */
   bool_t frag_sent;             /* true if buffer sent in middle of record */
+  int (*writevit) (void *, const struct xdr_iovec *, int);
   /*
    * in-coming bits
    */
@@ -135,6 +136,7 @@ typedef struct rec_strm
   caddr_t in_boundry;           /* can read up to this location */
   long fbtbc;                   /* fragment bytes to be consumed */
   bool_t last_frag;
+  bool_t direct_read;           /* read large data past the buffer */
   u_int sendsize;               /* must be <= INT_MAX */
   u_int recvsize;               /* must be <= INT_MAX */
 
@@ -150,8 +152,10 @@ typedef struct rec_strm
 
 static u_int fix_buf_size (u_int);
 static bool_t flush_out (RECSTREAM *, bool_t);
+static bool_t flush_out_with (RECSTREAM *, const char *, u_int);
 static bool_t fill_input_buf (RECSTREAM *);
 static bool_t get_input_bytes (RECSTREAM *, char *, size_t);
+static bool_t get_direct_bytes (RECSTREAM *, char *, size_t);
 static bool_t set_input_fragment (RECSTREAM *);
 static bool_t skip_input_bytes (RECSTREAM *, long);
 static bool_t realloc_stream (RECSTREAM *, int);
@@ -240,11 +244,13 @@ xdrrec_create (XDR * xdrs,
   rstrm->out_finger += sizeof (u_int32_t);
   rstrm->out_boundry += sendsize;
   rstrm->frag_sent = FALSE;
+  rstrm->writevit = NULL;
   rstrm->in_size = recvsize;
   rstrm->in_boundry = rstrm->in_base;
   rstrm->in_finger = (rstrm->in_boundry += recvsize);
   rstrm->fbtbc = 0;
   rstrm->last_frag = TRUE;
+  rstrm->direct_read = FALSE;
   rstrm->in_haveheader = FALSE;
   rstrm->in_hdrlen = 0;
   rstrm->in_hdrp = (char *) (void *) &rstrm->in_header;
@@ -329,7 +335,13 @@ xdrrec_getbytes (XDR * xdrs,
           continue;
         }
       current = (len < current) ? len : current;
-      if (!get_input_bytes (rstrm, addr, current))
+      if (rstrm->direct_read && !rstrm->nonblock
+          && current >= rstrm->recvsize)
+        {
+          if (!get_direct_bytes (rstrm, addr, current))
+            return FALSE;
+        }
+      else if (!get_input_bytes (rstrm, addr, current))
         return FALSE;
       addr += current;
       rstrm->fbtbc -= current;
@@ -346,6 +358,22 @@ xdrrec_putbytes (XDR * xdrs,
   RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
   size_t current;
 
+  /*
+   * large data goes out from where it is, in the current fragment, but
+   * for the bytes past the last whole unit of the stream, which are
+   * buffered to keep the buffer aligned as it would have been
+   */
+  if (rstrm->writevit != NULL && len >= rstrm->sendsize
+      && len <= (u_int) INT_MAX - rstrm->sendsize)
+    {
+      current = (size_t) ((u_long) rstrm->out_finger -
+                          (u_long) rstrm->out_base + len) % BYTES_PER_XDR_UNIT;
+      if (!flush_out_with (rstrm, addr, len - current))
+        return FALSE;
+      addr += len - current;
+      len = current;
+    }
+
   while (len > 0)
     {
       current = (size_t) ((u_long) rstrm->out_boundry -
@@ -625,6 +653,41 @@ xdrrec_endofrecord (XDR * xdrs,
   return TRUE;
 }
 
+/*
+ * Have opaque data of at least sendsize bytes written straight from
+ * the caller's memory by writevit, which is called like writev with the
+ * buffered bytes and the data.  Returns FALSE if it cannot be set.
+ */
+bool_t
+xdrrec_setwritev (XDR * xdrs,
+	int (*writevit) (void *, const struct xdr_iovec *, int))
+{
+  RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+
+  if (xdrs->x_ops != &xdrrec_ops)
+    return FALSE;
+  rstrm->writevit = writevit;
+  return TRUE;
+}
+
+/*
+ * Have opaque data of at least recvsize bytes read straight into the
+ * caller's memory by readit, past the input buffer.  readit is then
+ * called for up to the rest of the fragment, which may be more than
+ * recvsize bytes.  Does not apply to a non-blocking stream.
+ */
+bool_t
+xdrrec_setdirectread (XDR * xdrs,
+	bool_t direct)
+{
+  RECSTREAM *rstrm = (RECSTREAM *) (xdrs->x_private);
+
+  if (xdrs->x_ops != &xdrrec_ops)
+    return FALSE;
+  rstrm->direct_read = direct;
+  return TRUE;
+}
+
 /*
  * Fill the stream buffer with a record for a non-blocking connection.
  * Return true if a record is available in the buffer, false if not.
@@ -757,6 +820,35 @@ flush_out (RECSTREAM * rstrm,
   return TRUE;
 }
 
+/*
+ * Send the buffer with len bytes at addr appended to the current
+ * fragment, which the record goes on after.
+ */
+static bool_t
+flush_out_with (RECSTREAM * rstrm,
+	const char *addr,
+	u_int len)
+{
+  struct xdr_iovec iov[2];
+  u_int32_t fraglen = (u_int32_t) ((u_long) (rstrm->out_finger) -
+                                   (u_long) (rstrm->frag_header) -
+                                   sizeof (u_int32_t)) + len;
+
+  *(rstrm->frag_header) = htonl (fraglen);
+  iov[0].iov_base = rstrm->out_base;
+  iov[0].iov_len = (size_t) ((u_long) (rstrm->out_finger) -
+                             (u_long) (rstrm->out_base));
+  iov[1].iov_base = (void *) addr;
+  iov[1].iov_len = len;
+  if ((*(rstrm->writevit)) (rstrm->tcp_handle, iov, 2)
+      != (int) (iov[0].iov_len + len))
+    return FALSE;
+  rstrm->frag_header = (u_int32_t *) (void *) rstrm->out_base;
+  rstrm->out_finger = (char *) rstrm->out_base + sizeof (u_int32_t);
+  rstrm->frag_sent = TRUE;
+  return TRUE;
+}
+
 static bool_t                   /* knows nothing about records!  Only about input buffers */
 fill_input_buf (RECSTREAM * rstrm)
 {
@@ -814,6 +906,42 @@ get_input_bytes (RECSTREAM * rstrm,
   return TRUE;
 }
 
+static bool_t                   /* knows nothing about records!  Only about input buffers */
+get_direct_bytes (RECSTREAM * rstrm,
+	char *addr,
+	size_t len)
+{
+  size_t current, done;
+  int n;
+
+  /* the buffered bytes first, then the rest straight from readit */
+  current = (size_t) ((long) rstrm->in_boundry - (long) rstrm->in_finger);
+  current = (len < current) ? len : current;
+  memcpy (addr, rstrm->in_finger, current);
+  rstrm->in_finger += current;
+  addr += current;
+  len -= current;
+
+  for (done = 0; done < len; done += n)
+    {
+      n = (*(rstrm->readit)) (rstrm->tcp_handle, addr + done,
+                              (len - done > INT_MAX) ? INT_MAX
+                              : (int) (len - done));
+      if (n <= 0)
+        return FALSE;
+    }
+
+  /*
+   * The buffer is empty; leave its end where it would be had the bytes
+   * gone through it, so that fill_input_buf keeps the stream aligned.
+   */
+  if (done > 0)
+    rstrm->in_finger = rstrm->in_boundry = rstrm->in_base +
+      ((u_long) (rstrm->in_boundry - rstrm->in_base) + done)
+      % BYTES_PER_XDR_UNIT;
+  return TRUE;
+}
+
 static bool_t                   /* next two bytes of the input stream are treated as a header */
 set_input_fragment (RECSTREAM * rstrm)
 {
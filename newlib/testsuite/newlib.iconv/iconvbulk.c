@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Convert long runs between KOI8-R and UTF-8, which go through the bulk
+   conversion paths, and check that a character which stops a run is
+   dealt with as before: E2BIG with the input just past the characters
+   written, EILSEQ or EINVAL at the bad sequence, '?' for a character
+   KOI8-R lacks.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iconv.h>
+#include <errno.h>
+#include <newlib.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#if defined (_ICONV_ENABLED) \
+ && defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ && defined (_ICONV_TO_ENCODING_KOI8_R) \
+ && defined (_ICONV_FROM_ENCODING_UTF_8) \
+ && defined (_ICONV_TO_ENCODING_UTF_8)
+
+#define LEN 1000
+
+static char koi8[LEN], utf8[3 * LEN], back[LEN + 16];
+
+/* Number of bytes of the UTF-8 for each KOI8-R byte */
+static size_t utf8_len[256];
+
+static size_t
+convert (iconv_t cd, const char *in, size_t inlen, char *out, size_t outlen,
+	 size_t *inleft, size_t *outleft, int *err)
+{
+  char *ip = (char *) in, *op = out;
+  size_t res;
+
+  *inleft = inlen;
+  *outleft = outlen;
+  errno = 0;
+  res = iconv (cd, &ip, inleft, &op, outleft);
+  *err = errno;
+  return res;
+}
+
+int main()
+{
+  iconv_t to_utf8, to_koi8;
+  size_t i, n, size, inleft, outleft, ulen;
+  char c;
+  int err;
+
+  to_utf8 = iconv_open ("UTF-8", "KOI8-R");
+  to_koi8 = iconv_open ("KOI8-R", "UTF-8");
+  CHECK (to_utf8 != (iconv_t) -1 && to_koi8 != (iconv_t) -1);
+
+  for (i = 0; i < 256; i++)
+    {
+      c = i;
+      CHECK (convert (to_utf8, &c, 1, utf8, 3, &inleft, &outleft, &err) == 0);
+      utf8_len[i] = 3 - outleft;
+    }
+  CHECK (utf8_len['a'] == 1 && utf8_len[0xc1] == 2 && utf8_len[0x80] == 3);
+  CHECK (memcmp (utf8, "\xd0\xaa", 2) == 0);
+
+  for (i = 0; i < LEN; i++)
+    koi8[i] = i < 256 ? i : (i * 7 + i / 13) & 0xff;
+
+  CHECK (convert (to_utf8, koi8, LEN, utf8, sizeof utf8, &inleft, &outleft,
+		  &err) == 0 && inleft == 0);
+  ulen = sizeof utf8 - outleft;
+  CHECK (convert (to_koi8, utf8, ulen, back, sizeof back, &inleft, &outleft,
+		  &err) == 0 && inleft == 0 && outleft == sizeof back - LEN);
+  CHECK (memcmp (back, koi8, LEN) == 0);
+
+  /* Out of space after each character */
+  for (size = 0, n = 0; n < 300; size += utf8_len[(unsigned char) koi8[n++]])
+    {
+      CHECK (convert (to_utf8, koi8, LEN, utf8,
+		      size + utf8_len[(unsigned char) koi8[n]] - 1,
+		      &inleft, &outleft, &err) == (size_t) -1 && err == E2BIG);
+      CHECK (inleft == LEN - n
+	     && outleft == utf8_len[(unsigned char) koi8[n]] - 1);
+      CHECK (convert (to_koi8, utf8, ulen, back, n, &inleft, &outleft, &err)
+	     == (size_t) -1 && err == E2BIG);
+      CHECK (inleft == ulen - size && outleft == 0);
+      CHECK (memcmp (back, koi8, n) == 0);
+    }
+
+  /* A character KOI8-R lacks, an invalid and an incomplete sequence */
+  memset (utf8, 'x', 200);
+  memcpy (utf8 + 100, "\xe4\xb8\xad", 3);
+  CHECK (convert (to_koi8, utf8, 200, back, sizeof back, &inleft, &outleft,
+		  &err) == 1 && inleft == 0 && outleft == sizeof back - 198);
+  CHECK (back[99] == 'x' && back[100] == '?' && back[101] == 'x');
+  utf8[100] = '\x80';
+  CHECK (convert (to_koi8, utf8, 200, back, sizeof back, &inleft, &outleft,
+		  &err) == (size_t) -1 && err == EILSEQ && inleft == 100);
+  CHECK (outleft == sizeof back - 100);
+  CHECK (convert (to_koi8, utf8, 101, back, sizeof back, &inleft, &outleft,
+		  &err) == (size_t) -1 && inleft == 1);
+  utf8[100] = '\xd0';
+  CHECK (convert (to_koi8, utf8, 101, back, sizeof back, &inleft, &outleft,
+		  &err) == (size_t) -1 && err == EINVAL && inleft == 1);
+
+#ifdef BENCHMARK
+  {
+    static char big[1 << 16], bigutf8[3 << 16], bigkoi8[1 << 16];
+    clock_t t;
+    long r;
+
+    for (i = 0; i < sizeof big; i++)
+      big[i] = i % 7 == 6 ? ' ' : 0xc0 + i % 32;
+    CHECK (convert (to_utf8, big, sizeof big, bigutf8, sizeof bigutf8,
+		    &inleft, &outleft, &err) == 0);
+    ulen = sizeof bigutf8 - outleft;
+    t = clock ();
+    for (r = 0; r < 2000; r++)
+      convert (to_utf8, big, sizeof big, bigutf8, sizeof bigutf8,
+	       &inleft, &outleft, &err);
+    printf ("KOI8-R to UTF-8: %7.1f MB/s\n", (double) r * sizeof big / 1e6
+	    / ((double) (clock () - t) / CLOCKS_PER_SEC));
+    t = clock ();
+    for (r = 0; r < 2000; r++)
+      convert (to_koi8, bigutf8, ulen, bigkoi8, sizeof bigkoi8,
+	       &inleft, &outleft, &err);
+    printf ("UTF-8 to KOI8-R: %7.1f MB/s\n", (double) r * sizeof big / 1e6
+	    / ((double) (clock () - t) / CLOCKS_PER_SEC));
+    CHECK (memcmp (big, bigkoi8, sizeof big) == 0);
+  }
+#endif
+
+  CHECK (iconv_close (to_utf8) == 0 && iconv_close (to_koi8) == 0);
+  exit (0);
+}
+
+#else
+int main()
+{
+  exit (0);
+}
+#endif
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* The string conversion functions convert UTF-8 in bulk.  They must
+   give the same results as converting one character at a time with
+   mbrtowc and wcrtomb, whatever the input and buffer sizes.  */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <wchar.h>
+#include <errno.h>
+#include <limits.h>
+#include "check.h"
+
+static const char *const pieces[] = {
+  "a", "Hello, world", "0123456789abcdefghijklmnopqrstuv", " ", "\n",
+  "\xc3\xa9", "\xd0\x96", "\xe2\x82\xac", "\xe0\xa0\x80", "\xef\xbf\xbd",
+  "\xed\x9f\xbf", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf",
+  /* Invalid or truncated sequences.  */
+  "\x80", "\xc0\xaf", "\xe0\x80\xaf", "\xf4\x90\x80\x80", "\xc3", "\xe2\x82",
+  "\xff",
+};
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+/* A random string, valid UTF-8 unless INVALID.  */
+static size_t
+make_mbs (char *buf, size_t size, int invalid)
+{
+  size_t len = 0, n;
+  const char *p;
+
+  while (len < size - 40 && rnd (16) != 0)
+    {
+      p = pieces[rnd (invalid ? sizeof pieces / sizeof pieces[0] : 13)];
+      n = strlen (p);
+      memcpy (buf + len, p, n);
+      len += n;
+    }
+  buf[len] = '\0';
+  return len;
+}
+
+static size_t
+ref_mbsnrtowcs (wchar_t *dst, const char **src, size_t nms, size_t len,
+		mbstate_t *ps)
+{
+  const char *s = *src;
+  size_t count = 0, r;
+
+  if (dst == NULL)
+    len = (size_t) -1;
+  while (len > 0)
+    {
+      r = mbrtowc (dst ? dst + count : NULL, s, nms, ps);
+      if (r == (size_t) -2)
+	{
+	  s += nms;
+	  break;
+	}
+      if (r == 0)
+	{
+	  s = NULL;
+	  break;
+	}
+      if (r == (size_t) -1)
+	return r;
+      s += r;
+      nms -= r;
+      count++;
+      len--;
+    }
+  if (dst)
+    *src = s;
+  return count;
+}
+
+static size_t
+ref_wcsnrtombs (char *dst, const wchar_t **src, size_t nwc, size_t len,
+		mbstate_t *ps)
+{
+  const wchar_t *s = *src;
+  char buf[MB_LEN_MAX];
+  size_t n = 0, r;
+  mbstate_t save;
+
+  if (dst == NULL)
+    len = (size_t) -1;
+  for (; nwc > 0 && n < len; nwc--, s++)
+    {
+      save = *ps;
+      r = wcrtomb (buf, *s, ps);
+      if (r == (size_t) -1)
+	return r;
+      if (n + r > len)
+	{
+	  *ps = save;
+	  break;
+	}
+      if (dst)
+	memcpy (dst + n, buf, r);
+      n += r;
+      if (*s == L'\0')
+	{
+	  if (dst)
+	    *src = NULL;
+	  return n - 1;
+	}
+    }
+  if (dst)
+    *src = s;
+  return n;
+}
+
+static void
+check_mbs (const char *mbs, size_t nms, size_t len, int with_dst)
+{
+  wchar_t got[600], want[600];
+  const char *s1 = mbs, *s2 = mbs;
+  mbstate_t st1, st2;
+  size_t r1, r2;
+
+  memset (&st1, 0, sizeof st1);
+  memset (&st2, 0, sizeof st2);
+  errno = 0;
+  r1 = mbsnrtowcs (with_dst ? got : NULL, &s1, nms, len, &st1);
+  CHECK (r1 != (size_t) -1 || errno == EILSEQ);
+  r2 = ref_mbsnrtowcs (with_dst ? want : NULL, &s2, nms, len, &st2);
+  CHECK (r1 == r2);
+  if (r1 == (size_t) -1)
+    return;
+  CHECK (s1 == s2);
+  CHECK (mbsinit (&st1) == mbsinit (&st2));
+  if (with_dst)
+    CHECK (wmemcmp (got, want, r1) == 0);
+}
+
+static void
+check_wcs (const wchar_t *wcs, size_t nwc, size_t len, int with_dst)
+{
+  char got[2400], want[2400];
+  const wchar_t *s1 = wcs, *s2 = wcs;
+  mbstate_t st1, st2;
+  size_t r1, r2;
+
+  memset (&st1, 0, sizeof st1);
+  memset (&st2, 0, sizeof st2);
+  r1 = wcsnrtombs (with_dst ? got : NULL, &s1, nwc, len, &st1);
+  r2 = ref_wcsnrtombs (with_dst ? want : NULL, &s2, nwc, len, &st2);
+  CHECK (r1 == r2);
+  if (r1 == (size_t) -1)
+    return;
+  CHECK (s1 == s2);
+  if (with_dst)
+    CHECK (memcmp (got, want, r1) == 0);
+}
+
+int main()
+{
+  char mbs[600], out[2400];
+  wchar_t wcs[600], wback[600];
+  const char *s;
+  size_t len, n, nwc;
+  FILE *fp;
+  char *mem;
+  int i;
+
+  if (setlocale (LC_ALL, "C.UTF-8") == NULL)
+    /* No multibyte support in this build.  */
+    exit (0);
+
+  for (i = 0; i < 4000; i++)
+    {
+      len = make_mbs (mbs, sizeof mbs, i & 1);
+      /* Whole strings, and stopping after a number of bytes or wide
+	 characters, possibly in the middle of a character.  */
+      check_mbs (mbs, (size_t) -1, sizeof wcs / sizeof wcs[0], 1);
+      check_mbs (mbs, (size_t) -1, 0, 0);
+      check_mbs (mbs, rnd (len + 2), sizeof wcs / sizeof wcs[0], 1);
+      check_mbs (mbs, (size_t) -1, rnd (len + 2), 1);
+      check_mbs (mbs + rnd (len + 1), rnd (len + 2), rnd (len + 2), 1);
+
+      if (i & 1)
+	continue;
+      s = mbs;
+      nwc = mbsrtowcs (wcs, &s, sizeof wcs / sizeof wcs[0], NULL);
+      CHECK (nwc != (size_t) -1 && s == NULL);
+      CHECK (mbstowcs (wback, mbs, sizeof wback / sizeof wback[0]) == nwc);
+      CHECK (wmemcmp (wcs, wback, nwc + 1) == 0);
+      CHECK (mbstowcs (NULL, mbs, 0) == nwc);
+      if (nwc > 0)
+	{
+	  n = rnd (nwc);
+	  CHECK (mbstowcs (wback, mbs, n) == n);
+	  CHECK (wmemcmp (wcs, wback, n) == 0);
+	}
+
+      check_wcs (wcs, (size_t) -1, sizeof out, 1);
+      check_wcs (wcs, (size_t) -1, 0, 0);
+      check_wcs (wcs, rnd (nwc + 2), sizeof out, 1);
+      check_wcs (wcs, (size_t) -1, rnd (len + 2), 1);
+      CHECK (wcstombs (out, wcs, sizeof out) == len);
+      CHECK (strcmp (out, mbs) == 0);
+      CHECK (wcstombs (NULL, wcs, 0) == len);
+      n = rnd (len + 1);
+      memset (out, 'x', sizeof out);
+      CHECK (wcstombs (out, wcs, n) <= n);
+      CHECK (strncmp (out, mbs, wcstombs (out, wcs, n)) == 0);
+    }
+
+  /* Characters no bulk conversion can produce.  */
+  wcs[0] = L'a';
+  wcs[1] = 0x110000;
+  wcs[2] = L'\0';
+  check_wcs (wcs, (size_t) -1, sizeof out, 1);
+  wcs[1] = 0xd800;
+  check_wcs (wcs, (size_t) -1, sizeof out, 1);
+
+  /* The wide stdio functions go through the same code.  */
+  len = make_mbs (mbs, sizeof mbs, 0);
+  mbstowcs (wcs, mbs, sizeof wcs / sizeof wcs[0]);
+  fp = open_memstream (&mem, &n);
+  CHECK (fp != NULL);
+  CHECK (fputws (wcs, fp) >= 0);
+  CHECK (fclose (fp) == 0);
+  CHECK (n == len && memcmp (mem, mbs, len) == 0);
+  fp = fmemopen (mem, n, "r");
+  CHECK (fp != NULL);
+  wback[0] = L'\0';
+  while (fgetws (wback + wcslen (wback),
+		 sizeof wback / sizeof wback[0] - wcslen (wback), fp) != NULL)
+    ;
+  CHECK (wcscmp (wback, wcs) == 0);
+  fclose (fp);
+  free (mem);
+
+  exit (0);
+}
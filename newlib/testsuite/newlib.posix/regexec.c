@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Match patterns using anchors, word boundaries, REG_NEWLINE and
+   REG_NOTBOL/REG_NOTEOL, whose results depend on the character before
+   each position, then search long texts, including one where the
+   matcher has far more states than it can cache, and one where it has
+   too many for a cache to be worth making.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <regex.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#ifdef BENCHMARK
+#define TEXTLEN 1000000
+#define ROUNDS 20
+#else
+#define TEXTLEN 20000
+#define ROUNDS 1
+#endif
+
+struct test {
+  const char *pattern;
+  int cflags;
+  const char *string;
+  int eflags;
+  int so, eo;			/* -1 if there is no match */
+};
+
+#define E REG_EXTENDED
+#define N (REG_EXTENDED | REG_NEWLINE)
+
+static const struct test tests[] = {
+  { "abc", E, "xxabcxx", 0, 2, 5 },
+  { "abc", E, "xxabxx", 0, -1, -1 },
+  { "a+b", E, "caaab", 0, 1, 5 },
+  { "^abc", E, "abc", 0, 0, 3 },
+  { "^abc", E, "abc", REG_NOTBOL, -1, -1 },
+  { "^abc", E, "x\nabc", 0, -1, -1 },
+  { "^abc", N, "x\nabc", 0, 2, 5 },
+  { "^abc", N, "x\nabc", REG_NOTBOL, 2, 5 },
+  { "abc$", E, "abc\nx", 0, -1, -1 },
+  { "abc$", N, "abc\nx", 0, 0, 3 },
+  { "abc$", E, "xabc", REG_NOTEOL, -1, -1 },
+  { "^$", N, "ab\n\ncd", 0, 3, 3 },
+  { "a.c", E, "a\nc", 0, 0, 3 },
+  { "a.c", N, "a\nc", 0, -1, -1 },
+  { "[[:<:]]cat", E, "concat cat", 0, 7, 10 },
+  { "cat[[:>:]]", E, "cats cat", 0, 5, 8 },
+  { "[[:<:]]cat[[:>:]]", E, "cats concat cat.", 0, 12, 15 },
+  { "[[:<:]]cat", E, "cat", REG_NOTBOL, -1, -1 },
+  { "[[:<:]]x", N, "a\nx", 0, 2, 3 },
+  { "(foo|bar)+baz", E, "xfoobarfoobaz", 0, 1, 13 },
+  { "[0-9]+\\.[0-9]+", E, "version 10.25b", 0, 8, 13 },
+  { "ERROR.*disk", E, "INFO ok\nERROR no disk\n", 0, 8, 21 },
+  { "ERROR.*$", N, "INFO ok\nERROR no disk\nINFO", 0, 8, 21 },
+  { "(a|ab)(c|bcd)(d*)", E, "abcd", 0, 0, 4 },
+  { "HELLO", E | REG_ICASE, "say hello", 0, 4, 9 },
+};
+
+static char text[TEXTLEN + 1];
+
+#define BIGREPS 1000
+static char big[5 * BIGREPS + 1];
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+#ifdef BENCHMARK
+static clock_t t;
+#define START() (t = clock ())
+#define STOP(what) printf ("%-20s %6.2f ns per byte\n", what, \
+  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / ((double) TEXTLEN * ROUNDS))
+#else
+#define START()
+#define STOP(what)
+#endif
+
+/* Search the text for pattern ROUNDS times; the match must be at so, eo */
+static void
+search (const char *pattern, int cflags, int so, int eo)
+{
+  regex_t re;
+  regmatch_t pm;
+  int i;
+
+  CHECK (regcomp (&re, pattern, cflags) == 0);
+  START ();
+  for (i = 0; i < ROUNDS; i++)
+    {
+      pm.rm_so = pm.rm_eo = -2;
+      CHECK (regexec (&re, text, 1, &pm, 0) == (so < 0 ? REG_NOMATCH : 0));
+      if (so >= 0)
+	CHECK (pm.rm_so == so && pm.rm_eo == eo);
+    }
+  STOP (pattern);
+  regfree (&re);
+}
+
+int main()
+{
+  const struct test *tp;
+  regex_t re;
+  regmatch_t pm;
+  int i, last;
+
+  for (tp = tests; tp < tests + sizeof tests / sizeof tests[0]; tp++)
+    {
+      CHECK (regcomp (&re, tp->pattern, tp->cflags) == 0);
+      /* Twice, the second time with the transitions already known */
+      for (i = 0; i < 2; i++)
+	{
+	  pm.rm_so = pm.rm_eo = -2;
+	  if (tp->so < 0)
+	    {
+	      CHECK (regexec (&re, tp->string, 1, &pm, tp->eflags) == REG_NOMATCH);
+	    }
+	  else
+	    {
+	      CHECK (regexec (&re, tp->string, 1, &pm, tp->eflags) == 0);
+	      CHECK (pm.rm_so == tp->so && pm.rm_eo == tp->eo);
+	    }
+	}
+      regfree (&re);
+    }
+
+  /* Lines of words, with the only match on the last line */
+  for (i = 0; i < TEXTLEN; i++)
+    text[i] = i % 64 == 63 ? '\n' : rnd (6) == 0 ? ' ' : 'a' + rnd (26);
+  memcpy (text + TEXTLEN - 24, "\nERROR: disk full\n", 18);
+  search ("ERROR: [a-z]+ (full|empty)", E, TEXTLEN - 23, TEXTLEN - 7);
+  search ("^ERROR.*$", N, TEXTLEN - 23, TEXTLEN - 7);
+  search ("[[:<:]](disk|tape)[[:>:]]", E, TEXTLEN - 16, TEXTLEN - 12);
+  search ("[0-9]+\\.[0-9]+", E, -1, -1);
+
+  /* A pattern whose DFA has 2^13 states, more than are cached */
+  for (i = 0; i < TEXTLEN; i++)
+    text[i] = 'a' + rnd (2);
+  for (last = TEXTLEN - 13; text[last] != 'a'; last--)
+    ;
+  search ("(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)",
+	  E, 0, last + 13);
+
+  /* A pattern of 5000 states, which the matcher steps through without a
+     cache each time */
+  for (i = 0; i < BIGREPS; i++)
+    memcpy (big + 5 * i, "(a|b)", 5);
+  text[BIGREPS + 10] = '\0';
+  CHECK (regcomp (&re, big, E) == 0);
+  for (i = 0; i < 3; i++)
+    {
+      pm.rm_so = pm.rm_eo = -2;
+      CHECK (regexec (&re, text, 1, &pm, 0) == 0);
+      CHECK (pm.rm_so == 0 && pm.rm_eo == BIGREPS);
+    }
+  regfree (&re);
+
+  exit (0);
+}
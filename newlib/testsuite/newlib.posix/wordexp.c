@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Expand words using quotes, parameters, arithmetic, tildes and field
+   splitting, and check the errors wordexp reports without running a
+   shell.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wordexp.h>
+#ifdef BENCHMARK
+#include <sys/time.h>
+#endif
+#include "check.h"
+
+struct test {
+  const char *words;
+  int flags;
+  int err;
+  const char *expect[6];	/* NULL terminated */
+};
+
+static const struct test tests[] = {
+  { "a b\t c", 0, 0, { "a", "b", "c" } },
+  { "  ", 0, 0, { NULL } },
+  { "'a b' \"c d\" e\\ f ''", 0, 0, { "a b", "c d", "e f", "" } },
+  { "\"a\\\"b\\$c\\d\"", 0, 0, { "a\"b$c\\d" } },
+  { "$TWO", 0, 0, { "x", "y" } },
+  { "\"$TWO\" ${TWO}z", 0, 0, { "x  y", "x", "yz" } },
+  { "a$EMPTY b", 0, 0, { "a", "b" } },
+  { "$EMPTY", 0, 0, { NULL } },
+  { "\"$EMPTY\"", 0, 0, { "" } },
+  { "${UNSET:-def} ${UNSET-def} ${EMPTY:-def} ${EMPTY-def}", 0, 0,
+    { "def", "def", "def" } },
+  { "${UNSET:-'a b'}", 0, 0, { "a b" } },
+  { "${TWO:+set} ${UNSET:+set}x", 0, 0, { "set", "x" } },
+  { "${#TWO} ${#UNSET}", 0, 0, { "4", "0" } },
+  { "${FILE##*/} ${FILE#/*/} ${FILE%.*} ${FILE%%.*}", 0, 0,
+    { "lib.tar.gz", "local/lib.tar.gz", "/usr/local/lib.tar",
+      "/usr/local/lib" } },
+  { "${FILE#\"/usr\"}", 0, 0, { "/local/lib.tar.gz" } },
+  { "${NEW:=assigned} $NEW", 0, 0, { "assigned", "assigned" } },
+  { "$((1 + 2 * 3)) $(( (FOUR + 1) << 2 )) $((-$FOUR % 3))", 0, 0,
+    { "7", "20", "-1" } },
+  { "$((1 / 0))", 0, WRDE_SYNTAX },
+  { "~ ~/x a~ '~' ~\"\"", 0, 0, { "/home/me", "/home/me/x", "a~", "~",
+				  "~" } },
+  { "$ $1 $#", 0, 0, { "$", "0" } },
+  { "'*' \\? /nonexistent/*", 0, 0, { "*", "?", "/nonexistent/*" } },
+  { "$UNSET", WRDE_UNDEF, WRDE_BADVAL },
+  { "${UNSET}", WRDE_UNDEF, WRDE_BADVAL },
+  { "${UNSET-x}", WRDE_UNDEF, 0, { "x" } },
+  { "${UNSET?}", 0, WRDE_BADVAL },
+  { "$(echo a)", WRDE_NOCMD, WRDE_CMDSUB },
+  { "\"`echo a`\"", WRDE_NOCMD, WRDE_CMDSUB },
+  { "'$(echo a)'", WRDE_NOCMD, 0, { "$(echo a)" } },
+  { "a|b", 0, WRDE_BADCHAR },
+  { "a;b", 0, WRDE_BADCHAR },
+  { "a>b", 0, WRDE_BADCHAR },
+  { "{a}", 0, WRDE_BADCHAR },
+  { "\"a|b\" 'c;d' e\\&f", 0, 0, { "a|b", "c;d", "e&f" } },
+  { "'a", 0, WRDE_SYNTAX },
+  { "\"a", 0, WRDE_SYNTAX },
+  { "${TWO", 0, WRDE_SYNTAX },
+  { "${TWO:x}", 0, WRDE_SYNTAX },
+};
+
+static void
+check_words (const wordexp_t *we, size_t offs, const char *const *expect)
+{
+  size_t i;
+
+  for (i = 0; expect[i] != NULL; i++)
+    {
+      CHECK (i < we->we_wordc);
+      CHECK (strcmp (we->we_wordv[offs + i], expect[i]) == 0);
+    }
+  CHECK (we->we_wordc == i);
+  CHECK (we->we_wordv[offs + i] == NULL);
+}
+
+#ifdef BENCHMARK
+#define ROUNDS 100000
+
+static void
+bench (const char *words, int rounds)
+{
+  wordexp_t we;
+  struct timeval start, end;
+  int i;
+
+  gettimeofday (&start, NULL);
+  for (i = 0; i < rounds; i++)
+    if (wordexp (words, &we, 0) == 0)
+      wordfree (&we);
+  gettimeofday (&end, NULL);
+  printf ("%-40s %10.1f us per call\n", words,
+	  ((end.tv_sec - start.tv_sec) * 1e6
+	   + (end.tv_usec - start.tv_usec)) / rounds);
+}
+#endif
+
+int main()
+{
+  const struct test *tp;
+  static const char *const none[] = { NULL };
+  static const char *const ab[] = { "a", "b", NULL };
+  static const char *const abc[] = { "a", "b", "c", NULL };
+  static const char *const list1[] = { "", "a", "", "b", "", NULL };
+  static const char *const list2[] = { "a", "", "b", "x", NULL };
+  wordexp_t we;
+
+  setenv ("HOME", "/home/me", 1);
+  setenv ("TWO", "x  y", 1);
+  setenv ("EMPTY", "", 1);
+  setenv ("FILE", "/usr/local/lib.tar.gz", 1);
+  setenv ("FOUR", "4", 1);
+  unsetenv ("UNSET");
+  unsetenv ("NEW");
+  unsetenv ("IFS");
+
+  for (tp = tests; tp < tests + sizeof tests / sizeof tests[0]; tp++)
+    {
+      memset (&we, 0, sizeof we);
+      CHECK (wordexp (tp->words, &we, tp->flags) == tp->err);
+      if (tp->err == 0)
+	check_words (&we, 0, tp->expect);
+      wordfree (&we);
+    }
+
+  /* Non-whitespace IFS characters delimit empty fields.  */
+  setenv ("IFS", ": ", 1);
+  setenv ("LIST", ":a: :b::", 1);
+  CHECK (wordexp ("$LIST", &we, 0) == 0);
+  check_words (&we, 0, list1);
+  setenv ("LIST", "a : : b:", 1);
+  CHECK (wordexp ("$LIST x", &we, WRDE_REUSE) == 0);
+  check_words (&we, 0, list2);
+  wordfree (&we);
+  unsetenv ("IFS");
+
+  /* WRDE_DOOFFS, WRDE_APPEND and WRDE_REUSE */
+  we.we_offs = 2;
+  CHECK (wordexp ("a", &we, WRDE_DOOFFS) == 0);
+  CHECK (we.we_wordv[0] == NULL && we.we_wordv[1] == NULL);
+  CHECK (wordexp ("b", &we, WRDE_DOOFFS | WRDE_APPEND) == 0);
+  check_words (&we, 2, ab);
+  CHECK (wordexp ("c", &we, WRDE_DOOFFS | WRDE_APPEND) == 0);
+  check_words (&we, 2, abc);
+  CHECK (wordexp ("$EMPTY", &we, WRDE_DOOFFS | WRDE_APPEND) == 0);
+  check_words (&we, 2, abc);
+  CHECK (wordexp ("a b", &we, WRDE_REUSE) == 0);
+  check_words (&we, 0, ab);
+  CHECK (wordexp ("", &we, WRDE_REUSE) == 0);
+  check_words (&we, 0, none);
+  wordfree (&we);
+
+#ifdef BENCHMARK
+  bench ("${HOME}/etc/${APP:-app}.conf", ROUNDS);
+  bench ("\"$TWO\" 'quoted words' $((FOUR * 2))", ROUNDS);
+  bench ("$(echo ${HOME})/etc/${APP:-app}.conf", ROUNDS / 1000);
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Enter many more keys than hcreate_r was asked for.  Every key must
+   be found again, absent keys must not be, and the ENTRY pointers
+   returned before the table grew must still be valid.  Keys are
+   looked up in a scattered order.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <search.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#ifdef BENCHMARK
+#define NKEYS 1000000
+#else
+#define NKEYS 20000
+#endif
+
+/* Visit every key once, in a scattered order */
+#define STRIDE 7919
+#define SCATTER(i) ((i) * STRIDE % NKEYS)
+
+static char keys[NKEYS][16];
+static ENTRY *entries[NKEYS];
+
+#ifdef BENCHMARK
+static clock_t t;
+#define START() (t = clock ())
+#define STOP(what) printf ("%-6s %6.1f ns per key\n", what, \
+  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / NKEYS)
+#else
+#define START()
+#define STOP(what)
+#endif
+
+int main()
+{
+  struct hsearch_data htab;
+  ENTRY e, *ep;
+  char absent[16];
+  long i, j;
+
+  for (i = 0; i < NKEYS; i++)
+    sprintf (keys[i], "key%ld", i);
+
+  memset (&htab, 0, sizeof htab);
+  CHECK (hcreate_r (16, &htab));
+
+  START ();
+  for (i = 0; i < NKEYS; i++)
+    {
+      e.key = keys[i];
+      e.data = (void *) i;
+      CHECK (hsearch_r (e, ENTER, &entries[i], &htab));
+      CHECK (entries[i] != NULL && entries[i]->key == keys[i]);
+    }
+  STOP ("enter");
+
+  START ();
+  for (i = 0; i < NKEYS; i++)
+    {
+      j = SCATTER (i);
+      e.key = keys[j];
+      CHECK (hsearch_r (e, FIND, &ep, &htab));
+      CHECK (ep == entries[j] && ep->data == (void *) j);
+    }
+  STOP ("find");
+
+  for (i = 0; i < NKEYS; i++)
+    {
+      sprintf (absent, "absent%ld", i);
+      e.key = absent;
+      CHECK (!hsearch_r (e, FIND, &ep, &htab) && ep == NULL);
+    }
+
+  /* Entering a key again returns the existing entry.  */
+  e.key = absent;
+  strcpy (absent, keys[0]);
+  e.data = NULL;
+  CHECK (hsearch_r (e, ENTER, &ep, &htab) && ep == entries[0]);
+  CHECK (ep->key == keys[0] && ep->data == (void *) 0);
+
+  hdestroy_r (&htab);
+  CHECK (htab.htable == NULL);
+
+  /* The non-reentrant interface shares the implementation.  */
+  CHECK (hcreate (1));
+  for (i = 0; i < 1000; i++)
+    {
+      e.key = keys[i];
+      e.data = (void *) i;
+      CHECK (hsearch (e, ENTER) != NULL);
+    }
+  for (i = 0; i < 1000; i++)
+    {
+      e.key = keys[i];
+      ep = hsearch (e, FIND);
+      CHECK (ep != NULL && ep->data == (void *) i);
+    }
+  hdestroy ();
+
+  exit (0);
+}
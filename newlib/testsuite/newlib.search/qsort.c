@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Sort random, sorted, reversed, organ-pipe and many-duplicates arrays
+   of elements of several sizes with qsort and qsort_r.  Each element
+   is its key repeated, so the result must be sorted with every element
+   intact, the comparison function must only be given pointers to
+   elements of the array, and the number of comparisons must stay
+   within a small multiple of n log2 n.  */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define MAXN 20000
+#define MAXSIZE 24
+
+enum { RANDOM, SORTED, REVERSED, ORGAN_PIPE, DUPLICATES, NPATTERNS };
+
+#ifdef BENCHMARK
+static const char *const pattern_names[NPATTERNS] = {
+  "random", "sorted", "reversed", "organ pipe", "duplicates"
+};
+#endif
+
+static uint64_t array[MAXN * MAXSIZE / sizeof (uint64_t)];
+static unsigned long seed = 1;
+static unsigned long compares;
+static size_t elem_size, elem_count;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+/* Whether p points to an element of the array being sorted */
+static int
+in_array (const void *p)
+{
+  size_t off = (const unsigned char *) p - (const unsigned char *) array;
+
+  return (const unsigned char *) p >= (const unsigned char *) array
+	 && off < elem_count * elem_size && off % elem_size == 0;
+}
+
+static int
+compar (const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *) a;
+  uint32_t y = *(const uint32_t *) b;
+
+  CHECK (in_array (a) && in_array (b));
+  compares++;
+  return x < y ? -1 : x > y;
+}
+
+static int
+compar_r (const void *a, const void *b, void *thunk)
+{
+  ++*(unsigned long *) thunk;
+  return compar (a, b);
+}
+
+static void
+fill (size_t n, size_t size, int pattern)
+{
+  unsigned char *p = (unsigned char *) array;
+  uint32_t key;
+  size_t i, j;
+
+  for (i = 0; i < n; i++, p += size)
+    {
+      switch (pattern)
+	{
+	case RANDOM:     key = rnd (1000000); break;
+	case SORTED:     key = i; break;
+	case REVERSED:   key = n - i; break;
+	case ORGAN_PIPE: key = i < n / 2 ? i : n - i; break;
+	default:         key = rnd (10); break;
+	}
+      for (j = 0; j < size; j += sizeof key)
+	memcpy (p + j, &key, sizeof key);
+    }
+}
+
+static void
+check (size_t n, size_t size)
+{
+  unsigned char *p = (unsigned char *) array;
+  uint32_t key, prev = 0;
+  size_t i, j;
+
+  for (i = 0; i < n; i++, p += size)
+    {
+      memcpy (&key, p, sizeof key);
+      CHECK (key >= prev);
+      for (j = sizeof key; j < size; j += sizeof key)
+	CHECK (memcmp (p + j, &key, sizeof key) == 0);
+      prev = key;
+    }
+}
+
+static void
+test (size_t n, size_t size, int pattern)
+{
+  unsigned long bound = 8;
+  unsigned long count = 0;
+  size_t m;
+
+  for (m = n; m > 1; m >>= 1)
+    bound += 3 * n;
+  elem_size = size;
+  elem_count = n;
+
+  fill (n, size, pattern);
+  compares = 0;
+  qsort (array, n, size, compar);
+  check (n, size);
+  CHECK (compares <= bound);
+
+  fill (n, size, pattern);
+  qsort_r (array, n, size, compar_r, &count);
+  check (n, size);
+  CHECK (count <= bound);
+}
+
+int main()
+{
+  static const size_t sizes[] = { 4, 8, 12, 16, 24 };
+  static const size_t counts[] = { 0, 1, 2, 7, 13, 100, 129, 1000, MAXN };
+  size_t i, j;
+  int k;
+#ifdef BENCHMARK
+  clock_t t;
+  int r;
+#endif
+
+  for (i = 0; i < sizeof sizes / sizeof sizes[0]; i++)
+    for (j = 0; j < sizeof counts / sizeof counts[0]; j++)
+      for (k = 0; k < NPATTERNS; k++)
+	test (counts[j], sizes[i], k);
+
+#ifdef BENCHMARK
+  for (i = 0; i < sizeof sizes / sizeof sizes[0]; i++)
+    for (k = 0; k < NPATTERNS; k++)
+      {
+	t = 0;
+	elem_size = sizes[i];
+	elem_count = MAXN;
+	for (r = 0; r < 20; r++)
+	  {
+	    fill (MAXN, sizes[i], k);
+	    t -= clock ();
+	    qsort (array, MAXN, sizes[i], compar);
+	    t += clock ();
+	  }
+	printf ("%2lu bytes, %-10s %8.1f ns per element\n",
+		(unsigned long) sizes[i], pattern_names[k],
+		(double) t / CLOCKS_PER_SEC * 1e9 / (20.0 * MAXN));
+      }
+#endif
+
+  exit (0);
+}
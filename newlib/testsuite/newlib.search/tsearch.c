@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Insert keys in increasing and in random order with tsearch, find
+   them with tfind, delete every other one with tdelete and free the
+   rest with tdestroy.  The tree must stay within the AVL height bound
+   of 1.44 log2 n throughout, and the nodes of the keys that are not
+   deleted must stay the same.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <search.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#ifdef BENCHMARK
+#define NKEYS 1000000
+#else
+#define NKEYS 10000
+#endif
+
+static int keys[NKEYS];
+static int order[NKEYS];
+static void *found[NKEYS];
+static int max_level;
+static int nodes;
+static int destroyed;
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return ((seed >> 16) ^ (seed << 14)) % n;
+}
+
+static int
+compar (const void *a, const void *b)
+{
+  int x = *(const int *) a;
+  int y = *(const int *) b;
+
+  return x < y ? -1 : x > y;
+}
+
+static void
+action (const void *node, VISIT v, int level)
+{
+  if (v == preorder || v == leaf)
+    {
+      nodes++;
+      if (level > max_level)
+	max_level = level;
+    }
+}
+
+static void
+free_key (void *key)
+{
+  CHECK (*(int *) key >= 0 && *(int *) key < NKEYS);
+  destroyed++;
+}
+
+static void
+check_height (void *root, int n)
+{
+  int log2n = 0;
+
+  while ((1 << log2n) < n + 2)
+    log2n++;
+  nodes = 0;
+  max_level = 0;
+  twalk (root, action);
+  CHECK (nodes == n);
+  /* levels count from 0 */
+  CHECK (max_level + 1 <= 1.45 * log2n);
+}
+
+#ifdef BENCHMARK
+static clock_t t;
+#define START() (t = clock ())
+#define STOP(what) printf ("%-8s %-7s %6.1f ns per key\n", name, what, \
+  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / NKEYS)
+#else
+#define START()
+#define STOP(what)
+#endif
+
+static void
+test (const char *name)
+{
+  void *root = NULL;
+  void *p;
+  int i;
+
+  START ();
+  for (i = 0; i < NKEYS; i++)
+    {
+      p = tsearch (&keys[order[i]], &root, compar);
+      CHECK (p != NULL && *(int **) p == &keys[order[i]]);
+      found[order[i]] = p;
+    }
+  STOP ("insert");
+  check_height (root, NKEYS);
+
+  /* Inserting a key again finds the node already there.  */
+  p = tsearch (&order[0], &root, compar);
+  CHECK (p != NULL && *(int **) p == &keys[order[0]]);
+
+  START ();
+  for (i = 0; i < NKEYS; i++)
+    {
+      p = tfind (&keys[i], &root, compar);
+      CHECK (p != NULL && **(int **) p == i);
+    }
+  STOP ("find");
+
+  START ();
+  for (i = 0; i < NKEYS; i += 2)
+    CHECK (tdelete (&keys[order[i]], &root, compar) != NULL);
+  STOP ("delete");
+  check_height (root, NKEYS / 2);
+
+  for (i = 0; i < NKEYS; i++)
+    {
+      p = tfind (&keys[order[i]], &root, compar);
+      CHECK (i % 2 == 0 ? p == NULL : p == found[order[i]]
+	     && **(int **) p == order[i]);
+    }
+  CHECK (tdelete (&keys[order[0]], &root, compar) == NULL);
+
+  destroyed = 0;
+  tdestroy (root, free_key);
+  CHECK (destroyed == NKEYS / 2);
+}
+
+int main()
+{
+  int i, j, k;
+
+  for (i = 0; i < NKEYS; i++)
+    keys[i] = order[i] = i;
+  test ("sorted");
+
+  for (i = NKEYS - 1; i > 0; i--)
+    {
+      j = rnd (i + 1);
+      k = order[i];
+      order[i] = order[j];
+      order[j] = k;
+    }
+  test ("random");
+
+  exit (0);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Reading from a line buffered or unbuffered stream must flush all
+   line buffered output streams, no matter how many other streams are
+   open and how often streams change buffering mode.  */
+
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+
+#define NMEM 256
+#define NLBF 24
+
+static const char tmpname[] = "lbfflush.tmp";
+
+static void
+check_flushed_by_read (const char *expect)
+{
+  FILE *r;
+  char buf[32];
+
+  r = fopen (tmpname, "r");
+  CHECK (r != NULL);
+  CHECK (setvbuf (r, NULL, _IONBF, 0) == 0);
+  memset (buf, 0, sizeof buf);
+  CHECK (fread (buf, 1, sizeof buf - 1, r) == strlen (expect));
+  CHECK (strcmp (buf, expect) == 0);
+  CHECK (fclose (r) == 0);
+}
+
+int main()
+{
+  static char mem[NMEM][16];
+  FILE *fmem[NMEM];
+  FILE *w;
+  int i;
+
+  /* Lots of open streams.  Make some of them line buffered so the
+     registry has to grow, then release part of them again.  */
+  for (i = 0; i < NMEM; i++)
+    {
+      fmem[i] = fmemopen (mem[i], sizeof mem[i], "w");
+      CHECK (fmem[i] != NULL);
+    }
+  for (i = 0; i < NLBF; i++)
+    CHECK (setvbuf (fmem[i], NULL, _IOLBF, 0) == 0);
+  for (i = 0; i < NLBF; i += 2)
+    CHECK (fclose (fmem[i]) == 0);
+  for (i = 1; i < NLBF; i += 4)
+    CHECK (setvbuf (fmem[i], NULL, _IOFBF, 0) == 0);
+
+  w = fopen (tmpname, "w");
+  CHECK (w != NULL);
+  CHECK (setvbuf (w, NULL, _IOLBF, 0) == 0);
+  CHECK (fputs ("abc", w) >= 0);
+  check_flushed_by_read ("abc");
+
+  /* Switching to full buffering takes the stream off the registry.  */
+  CHECK (setvbuf (w, NULL, _IOFBF, 0) == 0);
+  CHECK (setvbuf (w, NULL, _IOLBF, 0) == 0);
+  CHECK (fputs ("def", w) >= 0);
+  check_flushed_by_read ("abcdef");
+
+  /* A reopened stream starts out fully buffered again.  */
+  w = freopen (tmpname, "a", w);
+  CHECK (w != NULL);
+  CHECK (setvbuf (w, NULL, _IOLBF, 0) == 0);
+  CHECK (fputs ("ghi", w) >= 0);
+  check_flushed_by_read ("abcdefghi");
+  CHECK (fclose (w) == 0);
+
+  for (i = 0; i < NMEM; i++)
+    if (i >= NLBF || i % 2)
+      CHECK (fclose (fmem[i]) == 0);
+  remove (tmpname);
+
+  exit (0);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Formats handled by the precompiled format engine must print exactly
+   what vfprintf prints.  A '*' width or precision is never precompiled,
+   so the same conversion written with '*' serves as the reference.  */
+
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "check.h"
+
+static const char *const flagsets[] = {
+  "", "-", "0", "+", " ", "#", "-0", "+0", "#0", "-#", "+ ", "-+#0"
+};
+static const int widths[] = { -1, 0, 1, 3, 8, 30 };
+static const int precs[] = { -1, 0, 1, 3, 12 };
+static const long ivals[] = { 0, 1, -1, 7, 42, -1234, 0x7fff, INT_MAX, INT_MIN };
+
+static void
+check_same (const char *fast, const char *ref)
+{
+  if (strcmp (fast, ref) != 0)
+    {
+      printf ("got \"%s\", expected \"%s\"\n", fast, ref);
+      CHECK (0);
+    }
+}
+
+/* sprintf through printf_compile and vfprintf_compiled */
+static int
+sprintf_compiled (char *buf, const char *fmt, ...)
+{
+  printf_compiled_t *pc;
+  char *mem;
+  size_t size;
+  FILE *fp;
+  va_list ap;
+  int n;
+
+  pc = printf_compile (fmt);
+  CHECK (pc != NULL);
+  fp = open_memstream (&mem, &size);
+  CHECK (fp != NULL);
+  va_start (ap, fmt);
+  n = vfprintf_compiled (fp, pc, ap);
+  va_end (ap);
+  CHECK (fclose (fp) == 0);
+  strcpy (buf, mem);
+  free (mem);
+  printf_compiled_free (pc);
+  return n;
+}
+
+static void
+check_conv (const char *flags, int w, int p, const char *mod, char conv)
+{
+  char fmt[32], reffmt[32], fast[128], ref[128];
+  size_t i;
+  int n, m;
+
+  snprintf (fmt, sizeof fmt, "<%%%s", flags);
+  strcpy (reffmt, fmt);
+  if (w >= 0)
+    snprintf (fmt + strlen (fmt), 8, "%d", w);
+  strcat (reffmt, "*");
+  if (p >= 0)
+    {
+      snprintf (fmt + strlen (fmt), 8, ".%d", p);
+      strcat (reffmt, ".*");
+    }
+  snprintf (fmt + strlen (fmt), 8, "%s%c>", mod, conv);
+  snprintf (reffmt + strlen (reffmt), 8, "%s%c>", mod, conv);
+  if (w < 0)
+    w = 0;
+
+  for (i = 0; i < sizeof ivals / sizeof ivals[0]; i++)
+    {
+      if (conv == 's')
+	{
+	  const char *s = ivals[i] == 0 ? NULL : ivals[i] < 0 ? "" : "hello";
+
+	  n = sprintf_compiled (fast, fmt, s);
+	  m = p >= 0 ? sprintf (ref, reffmt, w, p, s)
+		     : sprintf (ref, reffmt, w, s);
+	}
+      else if (*mod == 'l')
+	{
+	  n = sprintf_compiled (fast, fmt, ivals[i]);
+	  m = p >= 0 ? sprintf (ref, reffmt, w, p, ivals[i])
+		     : sprintf (ref, reffmt, w, ivals[i]);
+	}
+      else
+	{
+	  n = sprintf_compiled (fast, fmt, (int) ivals[i]);
+	  m = p >= 0 ? sprintf (ref, reffmt, w, p, (int) ivals[i])
+		     : sprintf (ref, reffmt, w, (int) ivals[i]);
+	}
+      CHECK (n == m);
+      check_same (fast, ref);
+    }
+}
+
+int main()
+{
+  static const char convs[] = "diuoxXcs";
+  static const char *const mods[] = { "", "h", "l" };
+  char buf[1024], big[600];
+  printf_compiled_t *pc;
+  size_t f, w, p, m;
+  const char *c;
+  FILE *fp;
+  char *mem;
+  size_t size;
+
+  for (c = convs; *c; c++)
+    for (m = 0; m < sizeof mods / sizeof mods[0]; m++)
+      {
+	if ((*c == 'c' || *c == 's') && m > 0)
+	  continue;
+	for (f = 0; f < sizeof flagsets / sizeof flagsets[0]; f++)
+	  for (w = 0; w < sizeof widths / sizeof widths[0]; w++)
+	    for (p = 0; p < sizeof precs / sizeof precs[0]; p++)
+	      check_conv (flagsets[f], widths[w], precs[p], mods[m], *c);
+      }
+
+  /* A few fixed results, in case both engines are wrong the same way.  */
+  sprintf_compiled (buf, "%d|%5d|%-5d|%05d|%+d|% d|%.3d|%5.3d|%x|%#x|%#X|%#o|%#o",
+	   42, 42, 42, -42, 42, 42, 7, -7, 255, 255, 255, 8, 0);
+  check_same (buf, "42|   42|42   |-0042|+42| 42|007| -007|ff|0xff|0XFF|010|0");
+  sprintf_compiled (buf, "%#x|%.0d|%#.0o|%hd|%hu|%lu|%c|%3c|%-3c|", 0, 0, 0,
+	   70000, 70000, 4000000000UL, 'a', 'b', 'c');
+  check_same (buf, "0||0|4464|4464|4000000000|a|  b|c  |");
+  sprintf_compiled (buf, "%s|%.2s|%8.3s|%-8s|%.4s|%%|", "abc", "abc", "abcdef",
+	   "ab", (char *) NULL);
+  check_same (buf, "abc|ab|     abc|ab      |(nul|%|");
+  sprintf_compiled (buf, "%p", (void *) 0x1234);
+  check_same (buf, "0x1234");
+
+  /* Output larger than the internal buffer, both in one piece and as
+     many small pieces.  */
+  memset (big, 'x', sizeof big - 1);
+  big[sizeof big - 1] = '\0';
+  CHECK (sprintf_compiled (buf, "<%s>%300d", big, 5) == 901);
+  CHECK (buf[0] == '<' && buf[600] == '>' && buf[900] == '5');
+  CHECK (strspn (buf + 1, "x") == 599 && strspn (buf + 601, " ") == 299);
+  CHECK (sprintf_compiled (buf, "%s%-300s|%d", big, "a", 1) == 901);
+  CHECK (strncmp (buf + 598, "xa ", 3) == 0 && strcmp (buf + 898, " |1") == 0);
+
+  /* Compiled formats.  */
+  pc = printf_compile ("[%5s|%-4d|%#06x|%c]");
+  CHECK (pc != NULL);
+  fp = open_memstream (&mem, &size);
+  CHECK (fp != NULL);
+  CHECK (fprintf_compiled (fp, pc, "ab", 12, 0x1f, 'z') == 21);
+  CHECK (fprintf_compiled (fp, pc, "", -3, 0, 'y') == 21);
+  CHECK (fclose (fp) == 0);
+  check_same (mem, "[   ab|12  |0x001f|z][     |-3  |000000|y]");
+  free (mem);
+  printf_compiled_free (pc);
+
+  /* Formats beyond the fast path still work, through vfprintf.  */
+  pc = printf_compile ("%*d|%-6.2f|%ld|%s");
+  CHECK (pc != NULL);
+  fp = open_memstream (&mem, &size);
+  CHECK (fp != NULL);
+  CHECK (fprintf_compiled (fp, pc, 4, 7, 1.5, 9L, "s") == 15);
+  CHECK (fclose (fp) == 0);
+  check_same (mem, "   7|1.50  |9|s");
+  free (mem);
+  printf_compiled_free (pc);
+
+  /* The format is copied, and many conversions are fine.  */
+  strcpy (buf, "%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d-");
+  pc = printf_compile (buf);
+  CHECK (pc != NULL);
+  memset (buf, 0, sizeof buf);
+  fp = open_memstream (&mem, &size);
+  CHECK (fp != NULL);
+  CHECK (fprintf_compiled (fp, pc, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0,
+			   1, 2, 3, 4, 5, 6, 7, 8, 9, 0) == 21);
+  CHECK (fclose (fp) == 0);
+  check_same (mem, "12345678901234567890-");
+  free (mem);
+
+  /* Printing to a read-only stream fails.  */
+  fp = fmemopen (big, sizeof big, "r");
+  CHECK (fp != NULL);
+  CHECK (fprintf_compiled (fp, pc, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0,
+			   1, 2, 3, 4, 5, 6, 7, 8, 9, 0) == EOF);
+  CHECK (fclose (fp) == 0);
+  printf_compiled_free (pc);
+  printf_compiled_free (NULL);
+
+  exit (0);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Released FILE slots must be handed out again before new ones are
+   allocated, including slots released by a failed fopen, and streams
+   must stay usable across heavy open/close churn.  A closed standard
+   stream that freopen brings back, or fails to, must be handed out once
+   at most, and only while it is closed.  */
+
+#include <stdio.h>
+#include <string.h>
+#include "check.h"
+
+#define NOPEN 600
+#define NCLOSE 50
+
+static const char tmpname[] = "sfpreuse.tmp";
+static char mem[NOPEN][8];
+static FILE *fp[NOPEN];
+
+static int
+was_closed (FILE *f, FILE **closed)
+{
+  int i;
+
+  for (i = 0; i < NCLOSE; i++)
+    if (closed[i] == f)
+      {
+	closed[i] = NULL;
+	return 1;
+      }
+  return 0;
+}
+
+int main()
+{
+  FILE *closed[NCLOSE];
+  int i, j, round;
+
+  for (i = 0; i < NOPEN; i++)
+    {
+      fp[i] = fmemopen (mem[i], sizeof mem[i], "w+");
+      CHECK (fp[i] != NULL);
+      CHECK (fputc ('a' + i % 26, fp[i]) != EOF);
+    }
+
+  for (round = 0; round < 20; round++)
+    {
+      for (i = 0; i < NCLOSE; i++)
+	{
+	  j = (round * 37 + i * 11) % NOPEN;
+	  while (fp[j] == NULL)
+	    j = (j + 1) % NOPEN;
+	  CHECK (fclose (fp[j]) == 0);
+	  closed[i] = fp[j];
+	  fp[j] = NULL;
+	}
+
+      /* A failing fopen must give its slot back.  */
+      CHECK (fopen ("/nonexistent/sfpreuse", "r") == NULL);
+
+      for (i = 0, j = 0; i < NCLOSE; i++)
+	{
+	  while (fp[j] != NULL)
+	    j++;
+	  fp[j] = fmemopen (mem[j], sizeof mem[j], "w+");
+	  CHECK (fp[j] != NULL);
+	  CHECK (was_closed (fp[j], closed));
+	  CHECK (fputc ('a' + j % 26, fp[j]) != EOF);
+	}
+    }
+
+  for (i = 0; i < NOPEN; i++)
+    {
+      CHECK (fflush (fp[i]) == 0);
+      CHECK (mem[i][0] == 'a' + i % 26);
+      CHECK (fclose (fp[i]) == 0);
+    }
+
+  CHECK (fclose (stdin) == 0);
+  CHECK (freopen ("/nonexistent/sfpreuse", "r", stdin) == NULL);
+  CHECK (fclose (stderr) == 0);
+  CHECK (freopen (tmpname, "w", stderr) == stderr);
+  for (i = 0; i < NOPEN; i++)
+    {
+      fp[i] = fmemopen (mem[i], sizeof mem[i], "w+");
+      CHECK (fp[i] != NULL && fp[i] != stderr);
+      for (j = 0; j < i; j++)
+	CHECK (fp[j] != fp[i]);
+    }
+  CHECK (fputs ("stderr", stderr) >= 0);
+  CHECK (fclose (stderr) == 0);
+  for (i = 0; i < NOPEN; i++)
+    CHECK (fclose (fp[i]) == 0);
+
+  fp[0] = fopen (tmpname, "r");
+  CHECK (fp[0] != NULL);
+  CHECK (fgets (mem[0], sizeof mem[0], fp[0]) != NULL);
+  CHECK (strcmp (mem[0], "stderr") == 0);
+  CHECK (fclose (fp[0]) == 0);
+  remove (tmpname);
+
+  exit (0);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* arc4random_buf must fill exactly the bytes asked for, at every length
+   and alignment, with bytes that look random, and no two threads may be
+   given the same bytes.  Each struct _reent below stands in for one
+   thread.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <reent.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define NTHREADS 4
+#define NDRAWS 64
+#define GUARD 0x5a
+#define BIGLEN (1 << 20)
+
+static struct _reent threads[NTHREADS];
+static unsigned char draws[NTHREADS + 1][NDRAWS][16];
+static unsigned char big[BIGLEN + 32];
+
+/* Check the bytes around those arc4random_buf fills at P.  */
+static void
+fill (unsigned char *p, size_t len)
+{
+  memset (p - 16, GUARD, len + 32);
+  arc4random_buf (p, len);
+  CHECK (p[-1] == GUARD && p[len] == GUARD);
+  CHECK (memcmp (p - 16, p - 15, 15) == 0);
+  CHECK (memcmp (p + len, p + len + 1, 15) == 0);
+}
+
+/* The count of each byte value in LEN bytes must be near LEN / 256.  */
+static void
+check_spread (const unsigned char *p, size_t len)
+{
+  static size_t count[256];
+  size_t i;
+
+  memset (count, 0, sizeof count);
+  for (i = 0; i < len; i++)
+    count[p[i]]++;
+  for (i = 0; i < 256; i++)
+    CHECK (count[i] > len / 256 * 7 / 8 && count[i] < len / 256 * 9 / 8);
+}
+
+static void
+draw (int t)
+{
+  uint32_t w[2];
+  int i;
+
+  for (i = 0; i < NDRAWS; i++)
+    {
+      arc4random_buf (draws[t][i], 8);
+      w[0] = arc4random ();
+      w[1] = arc4random ();
+      memcpy (draws[t][i] + 8, w, 8);
+    }
+}
+
+#ifdef BENCHMARK
+static void
+bench (const char *what)
+{
+  clock_t c;
+  uint32_t x = 0;
+  long n;
+
+  c = clock ();
+  for (n = 0; n < 20000000; n++)
+    x += arc4random ();
+  printf ("%s arc4random:     %6.1f ns per call (%u)\n", what,
+	  (double) (clock () - c) / CLOCKS_PER_SEC * 1e9 / n, x & 1);
+  c = clock ();
+  for (n = 0; n < 1000; n++)
+    arc4random_buf (big, BIGLEN);
+  printf ("%s arc4random_buf: %6.1f MB/s\n", what,
+	  (double) n * BIGLEN / 1e6 / ((double) (clock () - c) / CLOCKS_PER_SEC));
+}
+#endif
+
+int main()
+{
+  size_t len, align;
+  int t, u, i, j;
+  uint32_t x;
+
+  for (len = 0; len <= 2200; len += len < 80 ? 1 : 37)
+    for (align = 0; align < 8; align++)
+      fill (big + 16 + align, len);
+  fill (big + 16, BIGLEN);
+  check_spread (big + 16, BIGLEN);
+
+  for (i = 0; i < 100000; i++)
+    {
+      x = arc4random_uniform (1000);
+      CHECK (x < 1000);
+    }
+  CHECK (arc4random_uniform (1) == 0);
+
+  /* The global generator and each thread's give different bytes.  */
+  draw (NTHREADS);
+#ifndef __DYNAMIC_REENT__
+  for (t = 0; t < NTHREADS; t++)
+    {
+      _REENT_INIT_PTR (&threads[t]);
+      _impure_ptr = &threads[t];
+      draw (t);
+      fill (big + 16 + t, BIGLEN - t);
+      check_spread (big + 16 + t, BIGLEN - t);
+      _impure_ptr = _global_impure_ptr;
+    }
+#else
+  for (t = 0; t < NTHREADS; t++)
+    draw (t);
+#endif
+  for (t = 0; t <= NTHREADS; t++)
+    for (u = 0; u <= t; u++)
+      for (i = 0; i < NDRAWS; i++)
+	for (j = 0; j < (u == t ? i : NDRAWS); j++)
+	  CHECK (memcmp (draws[t][i], draws[u][j], 16) != 0);
+
+#ifdef BENCHMARK
+  bench ("global");
+#ifndef __DYNAMIC_REENT__
+  _impure_ptr = &threads[0];
+  bench ("thread");
+  _impure_ptr = _global_impure_ptr;
+#endif
+#endif
+
+  for (t = 0; t < NTHREADS; t++)
+    {
+      _reclaim_reent (&threads[t]);
+      CHECK (_REENT_ARC4RANDOM (&threads[t]) == NULL);
+    }
+
+  exit (0);
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Binary to decimal conversion: the table driven paths in dtoa_fast.c
+   and the Bigint code in dtoa.c must agree on every result.  Define
+   EXHAUSTIVE to try every float rather than a sample.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "check.h"
+
+#ifdef EXHAUSTIVE
+#define STRIDE 1
+#else
+#define STRIDE 9973
+#endif
+
+extern char *__dtoa (double, int, int, int *, int *, char **);
+
+union fbits
+{
+  float f;
+  uint32_t u;
+};
+
+union dbits
+{
+  double d;
+  uint64_t u;
+};
+
+static void
+check_str (const char *got, const char *want)
+{
+  if (strcmp (got, want) != 0)
+    {
+      printf ("got \"%s\", expected \"%s\"\n", got, want);
+      CHECK (0);
+    }
+}
+
+/* The shortest digits of D must read back as D.  */
+static void
+check_shortest (double d)
+{
+  char buf[64], *digits, *end;
+  int decpt, sign;
+
+  digits = __dtoa (d, 0, 0, &decpt, &sign, &end);
+  CHECK (end - digits <= 17);
+  CHECK (end == digits + 1 || end[-1] != '0');
+  sprintf (buf, "%s.%se%d", sign ? "-" : "", digits, decpt);
+  CHECK (strtod (buf, NULL) == d);
+}
+
+static void
+check_fixed (const char *fmt, double d, const char *want)
+{
+  char buf[128];
+
+  sprintf (buf, fmt, d);
+  check_str (buf, want);
+}
+
+int main()
+{
+  static const struct { const char *fmt; double d; const char *want; } fixed[] =
+  {
+    /* Exact ties are rounded to even.  */
+    { "%.2f", 0.125, "0.12" },
+    { "%.2f", 0.375, "0.38" },
+    { "%.0f", 2.5, "2" },
+    { "%.0f", 0.5, "0" },
+    { "%.1e", 2.25, "2.2e+00" },
+    /* Rounding carries into a new digit.  */
+    { "%.2f", 9.999, "10.00" },
+    { "%.3g", 999.9, "1e+03" },
+    { "%.4e", 99999.5, "1.0000e+05" },
+    { "%.1f", 1e-30, "0.0" },
+    { "%.0f", 1e20, "100000000000000000000" },
+    { "%.17g", 0.1, "0.10000000000000001" },
+    { "%.16g", 0.1, "0.1" },
+    { "%.15g", 5e-324, "4.94065645841247e-324" },
+    { "%.17g", 1.7976931348623157e308, "1.7976931348623157e+308" },
+    { "%.3f", 1234567.0005, "1234567.001" },
+    { "%.10f", 1.0 / 3, "0.3333333333" },
+    { "%g", 1e23, "1e+23" },
+    { "%.20e", 1.0 / 3, "3.33333333333333314830e-01" },
+  };
+  char buf[64], *digits, *end;
+  union fbits fb;
+  union dbits db;
+  uint64_t x;
+  uint32_t u;
+  int decpt, sign;
+  size_t i;
+
+  for (i = 0; i < sizeof fixed / sizeof fixed[0]; i++)
+    check_fixed (fixed[i].fmt, fixed[i].d, fixed[i].want);
+
+  /* Shortest digits.  */
+  digits = __dtoa (0.1, 0, 0, &decpt, &sign, &end);
+  check_str (digits, "1");
+  CHECK (decpt == 0 && sign == 0);
+  digits = __dtoa (-1e23, 0, 0, &decpt, &sign, &end);
+  check_str (digits, "1");
+  CHECK (decpt == 24 && sign == 1);
+  digits = __dtoa (5e-324, 0, 0, &decpt, &sign, &end);
+  check_str (digits, "5");
+  CHECK (decpt == -323);
+  digits = __dtoa (123456789012345680.0, 0, 0, &decpt, &sign, &end);
+  check_str (digits, "12345678901234568");
+  CHECK (decpt == 18);
+
+  /* Rounding to the right of all digits gives none.  */
+  digits = __dtoa (0.004, 3, 2, &decpt, &sign, &end);
+  CHECK (*digits == '\0' && decpt == -2);
+
+  /* Every float, or a sample of them, printed with enough digits reads
+     back as itself, and so do the shortest digits of its double.  */
+  for (u = 0; u < 0x7f800000; u += STRIDE)
+    {
+      fb.u = u;
+      sprintf (buf, "%.9g", (double) fb.f);
+      CHECK ((float) strtod (buf, NULL) == fb.f);
+      sprintf (buf, "%.8e", (double) fb.f);
+      CHECK ((float) strtod (buf, NULL) == fb.f);
+      check_shortest (fb.f);
+    }
+
+  /* A sample of doubles, spread over all exponents.  */
+  for (x = 1; x < 0x7ff0000000000000ULL; x += 0x00004d5e6f708193ULL)
+    {
+      db.u = x;
+      sprintf (buf, "%.17g", db.d);
+      CHECK (strtod (buf, NULL) == db.d);
+      check_shortest (db.d);
+      check_shortest (-db.d);
+    }
+
+  exit (0);
+}
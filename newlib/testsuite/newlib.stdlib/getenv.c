@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Look up variables in a 500-entry environment while setenv, putenv
+   and unsetenv change it and while environ is assigned other arrays.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define NVARS 500
+
+extern char **environ;
+
+static char names[NVARS][16];
+static char values[NVARS][16];
+
+static void
+check_all (int from, int to)
+{
+  int i;
+  char *v;
+
+  for (i = 0; i < NVARS; i++)
+    {
+      v = getenv (names[i]);
+      if (i >= from && i < to)
+	CHECK (v != NULL && strcmp (v, values[i]) == 0);
+      if (i < from || i >= to)
+	CHECK (v == NULL);
+    }
+}
+
+int main()
+{
+  static char *env1[] = { "A=1", "B=2", "A=3", "AB=4", NULL };
+  static char *env2[] = { "B=5", NULL };
+  static char putvar[] = "PUT=put";
+  char **saved, *tmp;
+  int i;
+#ifdef BENCHMARK
+  clock_t t;
+  long n;
+#endif
+
+  for (i = 0; i < NVARS; i++)
+    {
+      sprintf (names[i], "VAR_%d", i);
+      sprintf (values[i], "value%d", i);
+      CHECK (setenv (names[i], values[i], 1) == 0);
+    }
+  check_all (0, NVARS);
+  CHECK (getenv ("VAR_") == NULL && getenv ("VAR_1=") == NULL);
+
+  /* Rewriting and removing variables */
+  CHECK (setenv (names[7], "no", 0) == 0);
+  CHECK (strcmp (getenv (names[7]), values[7]) == 0);
+  CHECK (setenv (names[7], "a much longer value than before", 1) == 0);
+  CHECK (strcmp (getenv (names[7]), "a much longer value than before") == 0);
+  CHECK (setenv (names[7], values[7], 1) == 0);
+  for (i = 0; i < NVARS / 2; i++)
+    CHECK (unsetenv (names[i]) == 0);
+  check_all (NVARS / 2, NVARS);
+  for (i = 0; i < NVARS / 2; i++)
+    CHECK (setenv (names[i], values[i], 1) == 0);
+  check_all (0, NVARS);
+  CHECK (putenv (putvar) == 0);
+  CHECK (strcmp (getenv ("PUT"), "put") == 0);
+
+  /* Assigning environ, with the first of repeated names winning */
+  saved = environ;
+  environ = env1;
+  CHECK (strcmp (getenv ("A"), "1") == 0);
+  CHECK (strcmp (getenv ("AB"), "4") == 0);
+  CHECK (getenv (names[0]) == NULL);
+  environ = env2;
+  CHECK (getenv ("A") == NULL && strcmp (getenv ("B"), "5") == 0);
+  environ = saved;
+  check_all (0, NVARS);
+
+  /* Changing the entries of environ in place */
+  environ = env1;
+  CHECK (strcmp (getenv ("A"), "1") == 0);
+  env1[0] = "B=6";
+  CHECK (strcmp (getenv ("A"), "3") == 0 && strcmp (getenv ("B"), "6") == 0);
+  CHECK (setenv ("B", "a longer value", 1) == 0);
+  CHECK (strcmp (env1[0], "B=a longer value") == 0);
+  CHECK (strcmp (getenv ("B"), "a longer value") == 0);
+  env1[0] = NULL;
+  CHECK (getenv ("A") == NULL && getenv ("B") == NULL);
+  environ = saved;
+  check_all (0, NVARS);
+  tmp = getenv (names[NVARS / 2]);
+  for (i = 0; strchr (saved[i], '=') + 1 != tmp; i++)
+    ;
+  tmp = saved[i];
+  saved[i] = saved[i + 1];
+  saved[i + 1] = tmp;
+  check_all (0, NVARS);
+  CHECK (setenv (names[NVARS / 2], "a longer value", 1) == 0);
+  CHECK (strcmp (strchr (saved[i + 1], '=') + 1, "a longer value") == 0);
+  CHECK (setenv (names[NVARS / 2], values[NVARS / 2], 1) == 0);
+  check_all (0, NVARS);
+
+#ifdef BENCHMARK
+  t = clock ();
+  for (n = 0; n < 10000000; n++)
+    CHECK (getenv (names[n % NVARS]) != NULL);
+  printf ("getenv, %d variables: %6.1f ns per call\n", NVARS,
+	  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / n);
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Replay an allocation trace shaped like a long running service: many
+   small objects with random lifetimes and a few large buffers.  Blocks
+   must keep their contents, and replaying the trace a second time, on
+   the heap the first replay left behind, must not grow the heap by
+   more than a quarter.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define NSLOTS 1000
+#define NEVENTS 50000
+
+static unsigned short slot_of[NEVENTS];
+static unsigned short size_of[NEVENTS];
+static unsigned char *slots[NSLOTS];
+static size_t sizes[NSLOTS];
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+static void
+make_trace (void)
+{
+  unsigned r;
+  int i;
+
+  for (i = 0; i < NEVENTS; i++)
+    {
+      /* Low slots are reused quickly, high slots live long.  */
+      slot_of[i] = rnd (8) != 0 ? rnd (NSLOTS / 10) : rnd (NSLOTS);
+      r = rnd (100);
+      size_of[i] = r < 80 ? 1 + rnd (128) : r < 97 ? 128 + rnd (900)
+		   : 1024 + rnd (15000);
+    }
+}
+
+static void
+replay (int check)
+{
+  unsigned char *p;
+  size_t i, j, n;
+
+  for (i = 0; i < NEVENTS; i++)
+    {
+      j = slot_of[i];
+      p = slots[j];
+      if (p == NULL)
+	{
+	  n = size_of[i];
+	  p = malloc (n);
+	  CHECK (p != NULL);
+	  memset (p, (int) j, n);
+	  slots[j] = p;
+	  sizes[j] = n;
+	}
+      else
+	{
+	  if (check)
+	    for (n = 0; n < sizes[j]; n++)
+	      CHECK (p[n] == (unsigned char) j);
+	  free (p);
+	  slots[j] = NULL;
+	}
+    }
+  for (j = 0; j < NSLOTS; j++)
+    {
+      free (slots[j]);
+      slots[j] = NULL;
+    }
+}
+
+int main()
+{
+  struct mallinfo mi;
+  size_t arena;
+#ifdef BENCHMARK
+  clock_t t;
+  int k;
+#endif
+
+  make_trace ();
+
+  replay (1);
+  mi = mallinfo ();
+  CHECK (mi.uordblks + mi.fordblks == mi.arena);
+  arena = mi.arena;
+
+  replay (1);
+  mi = mallinfo ();
+  CHECK (mi.arena <= arena + arena / 4);
+
+#ifdef BENCHMARK
+  t = clock ();
+  for (k = 0; k < 100; k++)
+    replay (0);
+  t = clock () - t;
+  mi = mallinfo ();
+  printf ("%.1f ns per call, heap %lu bytes\n",
+	  (double) t / CLOCKS_PER_SEC * 1e9 / (100.0 * (NEVENTS + NSLOTS)),
+	  (unsigned long) mi.arena);
+#endif
+
+  exit (0);
+}
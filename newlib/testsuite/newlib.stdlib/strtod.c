@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Decimal to binary conversion: inputs the table driven path decides,
+   inputs it has to leave to the Bigint code, and the functions built
+   on strtod.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <wchar.h>
+#include "check.h"
+
+union dbits
+{
+  double d;
+  uint64_t u;
+};
+
+static uint64_t
+bits (double d)
+{
+  union dbits b;
+
+  b.d = d;
+  return b.u;
+}
+
+static void
+check_conv (const char *s, double want, int err)
+{
+  char *end;
+  double d;
+
+  errno = 0;
+  d = strtod (s, &end);
+  if (bits (d) != bits (want) || *end != '\0' || errno != err)
+    {
+      printf ("strtod (\"%s\") = %.17g, expected %.17g\n", s, d, want);
+      CHECK (0);
+    }
+}
+
+int main()
+{
+  static const struct { const char *s; double d; int err; } cases[] =
+  {
+    { "0.1", 0.1, 0 },
+    { "123456789012345678", 123456789012345680.0, 0 },
+    { "1.7976931348623157e308", DBL_MAX, 0 },
+    { "1.7976931348623158e308", DBL_MAX, 0 },
+    { "1.7976931348623159e308", HUGE_VAL, ERANGE },
+    { "2.2250738585072014e-308", DBL_MIN, 0 },
+    { "2.2250738585072011e-308", 2.2250738585072009e-308, 0 },
+    { "4.9406564584124654e-324", 4.9406564584124654e-324, 0 },
+    { "2.4703282292062328e-324", 4.9406564584124654e-324, 0 },
+    { "1e-400", 0.0, ERANGE },
+    { "1e400", HUGE_VAL, ERANGE },
+    /* Exactly halfway between two doubles, rounded to even.  */
+    { "9007199254740993", 9007199254740992.0, 0 },
+    { "9007199254740995", 9007199254740996.0, 0 },
+    { "90071992547409930e-1", 9007199254740992.0, 0 },
+    { "1.00000000000000011102230246251565404236316680908203125", 1.0, 0 },
+    /* Just above halfway, beyond the 19th digit.  */
+    { "1.000000000000000111022302462515654042363166809082031250001",
+      1.0000000000000002, 0 },
+    { "9007199254740993.0000000000000000000000001", 9007199254740994.0, 0 },
+    /* Many digits, decided by the first 19.  */
+    { "3.14159265358979323846264338327950288419716939937510", 3.141592653589793, 0 },
+    { "0.000000000000000000000000000000000000000000001234567890123456789012", 1.234567890123456789012e-45, 0 },
+    { "123456789012345678901234567890e-20", 1234567890.1234567890123456789, 0 },
+  };
+  union dbits b;
+  uint64_t x;
+  char buf[64];
+  double d;
+  float f;
+  size_t i;
+
+  for (i = 0; i < sizeof cases / sizeof cases[0]; i++)
+    check_conv (cases[i].s, cases[i].d, cases[i].err);
+
+  /* A sample of doubles, spread over all exponents, read back from
+     their shortest unambiguous and from longer representations.  */
+  for (x = 1; x < 0x7ff0000000000000ULL; x += 0x00003fb72ea61d95ULL)
+    {
+      b.u = x;
+      sprintf (buf, "%.17g", b.d);
+      check_conv (buf, b.d, 0);
+      sprintf (buf, "%.25e", b.d);
+      check_conv (buf, b.d, 0);
+    }
+
+  /* The same conversion through the other entry points.  */
+  CHECK (strtof ("1.00000011920928955078125", NULL) == 1.00000012f);
+  CHECK (strtof ("3.4028235e38", NULL) == FLT_MAX);
+  CHECK (wcstod (L"2.2250738585072011e-308", NULL) == 2.2250738585072009e-308);
+  CHECK (wcstod (L" 0.30000000000000004", NULL) == 0.30000000000000004);
+  CHECK (sscanf ("1.7976931348623157e308 8.5e-1", "%lf %f", &d, &f) == 2);
+  CHECK (d == DBL_MAX && f == 0.85f);
+
+  exit (0);
+}
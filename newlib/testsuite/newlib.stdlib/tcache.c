@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Small chunks freed through a thread's struct _reent are kept for
+   that thread.  Blocks must never overlap, whichever thread frees
+   them, mallinfo must count cached chunks as free, and _reclaim_reent
+   must give them back.  Each struct _reent below stands in for one
+   thread.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <reent.h>
+#include "check.h"
+
+#define NTHREADS 4
+#define NBLOCKS 200
+
+static struct _reent threads[NTHREADS];
+static unsigned char *blocks[NBLOCKS];
+static size_t sizes[NBLOCKS];
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+static void
+check_mallinfo (struct _reent *r, int inuse)
+{
+  struct mallinfo mi = _mallinfo_r (r);
+
+  CHECK (mi.uordblks + mi.fordblks == mi.arena);
+  if (inuse >= 0)
+    CHECK (mi.uordblks == inuse);
+}
+
+static void
+check_blocks (void)
+{
+  size_t i, j;
+
+  for (i = 0; i < NBLOCKS; i++)
+    for (j = 0; j < sizes[i]; j++)
+      CHECK (blocks[i] == NULL || blocks[i][j] == (unsigned char) i);
+}
+
+int main()
+{
+  struct mallinfo mi0, mi1;
+  struct _reent *r;
+  void *p, *q;
+  size_t i, k;
+
+  for (i = 0; i < NTHREADS; i++)
+    _REENT_INIT_PTR (&threads[i]);
+  r = &threads[0];
+
+  mi0 = _mallinfo_r (_REENT);
+
+  /* A freed small chunk is handed straight back, and counts as free
+     while it waits.  */
+  _free_r (r, _malloc_r (r, 200));
+  mi1 = _mallinfo_r (r);
+  p = _malloc_r (r, 40);
+  CHECK (p != NULL);
+  _free_r (r, p);
+  check_mallinfo (r, mi1.uordblks);
+  q = _malloc_r (r, 40);
+  CHECK (q == p);
+  _free_r (r, q);
+
+  /* Even if another thread allocated it.  */
+  p = _malloc_r (&threads[1], 100);
+  _free_r (r, p);
+  CHECK (_malloc_r (r, 100) == p);
+  _free_r (r, p);
+
+  /* Large chunks and the global struct _reent are never cached.  */
+  mi1 = _mallinfo_r (r);
+  p = _malloc_r (r, 4000);
+  _free_r (r, p);
+  check_mallinfo (r, mi1.uordblks);
+  p = _malloc_r (_REENT, 40);
+  _free_r (_REENT, p);
+  check_mallinfo (r, mi1.uordblks);
+
+  /* Random traffic from all threads, with realloc.  */
+  for (k = 0; k < 20000; k++)
+    {
+      i = rnd (NBLOCKS);
+      r = &threads[rnd (NTHREADS)];
+      if (blocks[i] == NULL)
+	{
+	  sizes[i] = rnd (8) == 0 ? rnd (2000) : rnd (600);
+	  blocks[i] = _malloc_r (r, sizes[i]);
+	  CHECK (blocks[i] != NULL);
+	}
+      else if (rnd (4) == 0)
+	{
+	  sizes[i] = rnd (600);
+	  blocks[i] = _realloc_r (r, blocks[i], sizes[i]);
+	  CHECK (blocks[i] != NULL || sizes[i] == 0);
+	}
+      else
+	{
+	  _free_r (r, blocks[i]);
+	  blocks[i] = NULL;
+	  sizes[i] = 0;
+	}
+      if (blocks[i] != NULL)
+	memset (blocks[i], (int) i, sizes[i]);
+      if (k % 1000 == 0)
+	{
+	  check_blocks ();
+	  check_mallinfo (r, -1);
+	}
+    }
+  check_blocks ();
+
+  for (i = 0; i < NBLOCKS; i++)
+    _free_r (&threads[rnd (NTHREADS)], blocks[i]);
+  check_mallinfo (_REENT, -1);
+
+  /* Once all threads are gone, the heap is as it was.  */
+  for (i = 0; i < NTHREADS; i++)
+    _reclaim_reent (&threads[i]);
+  check_mallinfo (_REENT, mi0.uordblks);
+
+  exit (0);
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check strlen, strnlen, strchr, memchr, memrchr, memcmp, strcmp,
+   strncmp and memmove against simple byte loops for every alignment of
+   their arguments within 64 bytes and every length up to a few times
+   the widest vector.  */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define MAXALIGN 64
+#define MAXLEN 300		/* for the one-argument functions */
+#define MAXCMP 160		/* for the two-argument ones */
+#define BUFSIZE (MAXALIGN + MAXLEN + 64)
+
+#define TARGET 'X'
+
+static unsigned char buf1[BUFSIZE] __attribute__ ((aligned (64)));
+static unsigned char buf2[BUFSIZE] __attribute__ ((aligned (64)));
+static unsigned char ref[BUFSIZE] __attribute__ ((aligned (64)));
+
+/* Fill n bytes at p with bytes that are neither NUL nor TARGET, some of
+   them with the top bit set.  */
+static void
+fill (unsigned char *p, size_t n, unsigned seed)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    p[i] = 'a' + (i * 7 + seed) % 26 + ((i + seed) % 5 == 0 ? 0x80 : 0);
+}
+
+static int
+sign (int x)
+{
+  return (x > 0) - (x < 0);
+}
+
+static void
+test_one_arg (size_t align, size_t len)
+{
+  unsigned char *s = buf1 + align;
+  size_t pos[3], i, n;
+  int k;
+
+  /* TARGET just before and after the string must not be found.  */
+  memset (buf1, TARGET, sizeof buf1);
+  fill (s, len, align);
+  s[len] = '\0';
+
+  CHECK (strlen ((char *) s) == len);
+  CHECK (strnlen ((char *) s, 0) == 0);
+  CHECK (strnlen ((char *) s, len / 2) == len / 2);
+  CHECK (strnlen ((char *) s, len) == len);
+  CHECK (strnlen ((char *) s, len + 1) == len);
+  CHECK (strnlen ((char *) s, SIZE_MAX) == len);
+  CHECK (strchr ((char *) s, '\0') == (char *) s + len);
+  CHECK (strchr ((char *) s, TARGET) == NULL);
+  CHECK (memchr (s, TARGET, len) == NULL);
+  CHECK (memrchr (s, TARGET, len) == NULL);
+  CHECK (memchr (s, '\0', len + 1) == s + len);
+
+  if (len == 0)
+    return;
+  pos[0] = 0;
+  pos[1] = len / 3;
+  pos[2] = len - 1;
+  for (k = 0; k < 3; k++)
+    {
+      s[pos[k]] = TARGET;
+      CHECK (strchr ((char *) s, TARGET) == (char *) s + pos[0]);
+      CHECK (memchr (s, TARGET, len) == s + pos[0]);
+      CHECK (memrchr (s, TARGET, len) == s + pos[k]);
+      n = pos[k];
+      CHECK (memchr (s, TARGET, n) == (n > pos[0] ? s + pos[0] : NULL));
+      CHECK (memrchr (s + n, TARGET, len - n) == s + pos[k]);
+      CHECK (strchr ((char *) s, s[len - 1]) != NULL);
+      for (i = 0; i < k; i++)
+	CHECK (memrchr (s, TARGET, pos[i] + 1) == s + pos[i]);
+    }
+}
+
+static void
+test_cmp (size_t a1, size_t a2, size_t len)
+{
+  unsigned char *s1 = buf1 + a1;
+  unsigned char *s2 = buf2 + a2;
+  size_t pos[3];
+  int k, c;
+
+  memset (buf1, 0x55, sizeof buf1);
+  memset (buf2, 0xaa, sizeof buf2);
+  fill (s1, len, 3);
+  fill (s2, len, 3);
+  s1[len] = s2[len] = '\0';
+
+  CHECK (memcmp (s1, s2, len) == 0);
+  CHECK (strcmp ((char *) s1, (char *) s2) == 0);
+  CHECK (strncmp ((char *) s1, (char *) s2, len) == 0);
+  CHECK (strncmp ((char *) s1, (char *) s2, len + 1) == 0);
+  CHECK (strncmp ((char *) s1, (char *) s2, SIZE_MAX) == 0);
+  /* Bytes after the terminators differ */
+  CHECK (strncmp ((char *) s1, (char *) s2, len + 10) == 0);
+
+  if (len == 0)
+    return;
+  pos[0] = 0;
+  pos[1] = len / 2;
+  pos[2] = len - 1;
+  for (k = 0; k < 3; k++)
+    {
+      c = s2[pos[k]];
+      s2[pos[k]] = c ^ 0x80;
+      CHECK (sign (memcmp (s1, s2, len)) == sign (s1[pos[k]] - s2[pos[k]]));
+      CHECK (sign (memcmp (s2, s1, len)) == sign (s2[pos[k]] - s1[pos[k]]));
+      CHECK (memcmp (s1, s2, pos[k]) == 0);
+      CHECK (sign (strcmp ((char *) s1, (char *) s2))
+	     == sign (s1[pos[k]] - s2[pos[k]]));
+      CHECK (sign (strncmp ((char *) s1, (char *) s2, len))
+	     == sign (s1[pos[k]] - s2[pos[k]]));
+      CHECK (strncmp ((char *) s1, (char *) s2, pos[k]) == 0);
+
+      /* A string that ends before the other */
+      s2[pos[k]] = '\0';
+      CHECK (strcmp ((char *) s1, (char *) s2) > 0);
+      CHECK (strcmp ((char *) s2, (char *) s1) < 0);
+      CHECK (strncmp ((char *) s1, (char *) s2, pos[k] + 1) > 0);
+      s2[pos[k]] = c;
+    }
+}
+
+static void
+test_move (size_t from, size_t to, size_t len)
+{
+  size_t i;
+  void *r;
+
+  fill (buf1, sizeof buf1, 5);
+  memcpy (ref, buf1, sizeof buf1);
+  for (i = 0; i < len; i++)
+    ref[to + i] = buf1[from + i];
+  r = memmove (buf1 + to, buf1 + from, len);
+  CHECK (r == buf1 + to);
+  CHECK (memcmp (buf1, ref, sizeof buf1) == 0);
+
+  /* And between different buffers */
+  fill (buf2, sizeof buf2, 7);
+  memcpy (ref, buf2, sizeof buf2);
+  for (i = 0; i < len; i++)
+    ref[to + i] = buf1[from + i];
+  CHECK (memmove (buf2 + to, buf1 + from, len) == buf2 + to);
+  CHECK (memcmp (buf2, ref, sizeof buf2) == 0);
+}
+
+#ifdef BENCHMARK
+#define BENCH_LEN 4096
+#define BENCH_ROUNDS 200000
+
+static unsigned char big1[BENCH_LEN + 64] __attribute__ ((aligned (64)));
+static unsigned char big2[BENCH_LEN + 64] __attribute__ ((aligned (64)));
+static volatile size_t sink;
+
+#define BENCH(name, call)						\
+  do									\
+    {									\
+      clock_t t = clock ();						\
+      long r;								\
+      for (r = 0; r < BENCH_ROUNDS; r++)				\
+	sink += (size_t) (call);					\
+      t = clock () - t;							\
+      printf ("%-8s %6.2f GB/s\n", name, (double) BENCH_LEN		\
+	      * BENCH_ROUNDS / ((double) t / CLOCKS_PER_SEC) / 1e9);	\
+    }									\
+  while (0)
+
+static void
+benchmark (void)
+{
+  fill (big1, BENCH_LEN, 1);
+  memcpy (big2, big1, BENCH_LEN);
+  big1[BENCH_LEN] = big2[BENCH_LEN] = '\0';
+
+  BENCH ("strlen", strlen ((char *) big1));
+  BENCH ("strnlen", strnlen ((char *) big1, BENCH_LEN + 1));
+  BENCH ("strchr", strchr ((char *) big1, TARGET));
+  BENCH ("memchr", memchr (big1, TARGET, BENCH_LEN));
+  BENCH ("memrchr", memrchr (big1, TARGET, BENCH_LEN));
+  BENCH ("memcmp", memcmp (big1, big2, BENCH_LEN));
+  BENCH ("strcmp", strcmp ((char *) big1, (char *) big2));
+  BENCH ("strncmp", strncmp ((char *) big1, (char *) big2, BENCH_LEN));
+  BENCH ("memmove", memmove (big1 + 1, big1, BENCH_LEN - 1));
+}
+#endif
+
+int
+main (void)
+{
+  size_t a1, a2, len;
+
+  for (a1 = 0; a1 < MAXALIGN; a1++)
+    for (len = 0; len <= MAXLEN; len++)
+      test_one_arg (a1, len);
+
+  for (a1 = 0; a1 < MAXALIGN / 2; a1++)
+    for (a2 = 0; a2 < MAXALIGN / 2; a2++)
+      for (len = 0; len <= MAXCMP; len++)
+	test_cmp (a1, a2, len);
+
+  for (a1 = 0; a1 < MAXALIGN; a1 += 3)
+    for (a2 = 0; a2 < MAXALIGN; a2++)
+      for (len = 0; len <= MAXCMP; len++)
+	test_move (a1, a2, len);
+
+#ifdef BENCHMARK
+  benchmark ();
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check strstr, memmem and strcasestr against simple loops on random
+   haystacks over small alphabets, where needles match at both ends
+   often, and on haystacks that make the candidate filter give up.  */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+#define MAXHAY 5000
+#define MAXNEEDLE 40
+
+static char hay[MAXHAY + 1];
+static char needle[MAXNEEDLE + 1];
+
+static unsigned long seed = 1;
+
+static unsigned
+rnd (unsigned n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+static char *
+ref_strstr (const char *h, const char *n, int icase)
+{
+  size_t len = strlen (n);
+
+  for (;; h++)
+    {
+      if ((icase ? strncasecmp (h, n, len) : strncmp (h, n, len)) == 0)
+	return (char *) h;
+      if (*h == '\0')
+	return NULL;
+    }
+}
+
+static void *
+ref_memmem (const char *h, size_t hlen, const char *n, size_t nlen)
+{
+  size_t i;
+
+  for (i = 0; i + nlen <= hlen; i++)
+    if (memcmp (h + i, n, nlen) == 0)
+      return (void *) (h + i);
+  return NULL;
+}
+
+static void
+check (size_t hlen, size_t nlen)
+{
+  CHECK (strstr (hay, needle) == ref_strstr (hay, needle, 0));
+  CHECK (strcasestr (hay, needle) == ref_strstr (hay, needle, 1));
+  CHECK (memmem (hay, hlen, needle, nlen)
+	 == ref_memmem (hay, hlen, needle, nlen));
+}
+
+#ifdef BENCHMARK
+#define TEXTLEN 1000000
+#define ROUNDS 50
+
+static const char *const words[] = {
+  "the", "of", "and", "to", "in", "is", "was", "that", "for", "on",
+  "with", "as", "by", "at", "from", "this", "which", "error", "request",
+  "server", "connection", "timeout", "value", "returned", "while",
+  "reading", "disk", "block", "user", "session", "started", "closed",
+};
+
+static char text[TEXTLEN + 1];
+static char *volatile vtext = text;	/* Keep calls in the loops */
+
+static void
+bench (const char *what, const char *n)
+{
+  size_t nlen = strlen (n);
+  clock_t t;
+  int i;
+
+  t = clock ();
+  for (i = 0; i < ROUNDS; i++)
+    CHECK (strstr (vtext, n) == NULL);
+  printf ("%-10s %-18s strstr %5.2f", what, n,
+	  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / TEXTLEN / ROUNDS);
+  t = clock ();
+  for (i = 0; i < ROUNDS; i++)
+    CHECK (memmem (vtext, TEXTLEN, n, nlen) == NULL);
+  printf (" memmem %5.2f",
+	  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / TEXTLEN / ROUNDS);
+  t = clock ();
+  for (i = 0; i < ROUNDS; i++)
+    CHECK (strcasestr (vtext, n) == NULL);
+  printf (" strcasestr %5.2f ns per byte\n",
+	  (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / TEXTLEN / ROUNDS);
+}
+
+static void
+benchmark (void)
+{
+  const char *w;
+  size_t i;
+
+  for (i = 0; i < TEXTLEN; )
+    {
+      w = words[rnd (sizeof words / sizeof words[0])];
+      while (*w && i < TEXTLEN)
+	text[i++] = *w++;
+      if (i < TEXTLEN)
+	text[i++] = rnd (12) == 0 ? '\n' : ' ';
+    }
+  bench ("english", "fox");
+  bench ("english", "the dog");
+  bench ("english", "connection reset");
+  bench ("english", "segmentation fault");
+
+  memset (text, 'a', TEXTLEN);
+  bench ("adversary", "aab");
+  bench ("adversary", "aaaaaaab");
+  bench ("adversary", "abaaaaaa");
+  bench ("adversary", "aaaaaaaaaaaaaaab");
+  bench ("adversary", "abaaaaaaaaaaaaaa");
+}
+#endif
+
+int
+main (void)
+{
+  static const char alphabet[] = "aAbBz\x80";
+  size_t hlen, nlen, i;
+  int n;
+
+  for (n = 0; n < 100000; n++)
+    {
+      hlen = rnd (n % 20 == 0 ? MAXHAY : 300);
+      nlen = rnd (MAXNEEDLE);
+      for (i = 0; i < hlen; i++)
+	hay[i] = alphabet[rnd (2 + n % 4)];
+      hay[hlen] = '\0';
+      for (i = 0; i < nlen; i++)
+	needle[i] = alphabet[rnd (1 + n % 3)];
+      needle[nlen] = '\0';
+      if (nlen <= hlen && rnd (2))
+	memcpy (hay + rnd (hlen - nlen + 1), needle, nlen);
+      check (hlen, nlen);
+    }
+
+  /* Needles that match at both ends everywhere, found at the end */
+  for (nlen = 2; nlen <= MAXNEEDLE; nlen++)
+    {
+      memset (hay, 'a', MAXHAY);
+      memset (needle, 'a', nlen);
+      needle[1] = 'B';
+      needle[nlen] = '\0';
+      check (MAXHAY, nlen);
+      hay[MAXHAY - 1 - nlen] = 'b';
+      check (MAXHAY, nlen);
+      CHECK (strcasestr (hay, needle) == hay + MAXHAY - 2 - nlen);
+    }
+
+#ifdef BENCHMARK
+  benchmark ();
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check the column widths of characters of each kind, and wcswidth on
+   strings that mix runs of ASCII with them, stopping at NUL or after n
+   characters.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <newlib.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+struct width {
+  wint_t c;
+  int width;
+};
+
+static const struct width widths[] = {
+  { 0, 0 }, { L' ', 1 }, { L'a', 1 }, { L'~', 1 },
+#ifdef _MB_CAPABLE
+  { 1, -1 }, { 0x7f, -1 }, { 0x9f, -1 },
+  { 0xa0, 1 }, { 0xa1, 1 }, { 0xad, 1 }, { 0x300, 0 }, { 0x36f, 0 },
+  { 0x370, 1 }, { 0x1100, 2 }, { 0x1160, 0 }, { 0x200b, 0 }, { 0x3000, 2 },
+  { 0x4e2d, 2 }, { 0xd800, -1 }, { 0xdfff, -1 }, { 0xfeff, 0 },
+  { 0xff21, 2 }, { 0x1f600, 2 }, { 0x20000, 2 }, { 0xe0100, 0 },
+  { 0x10ffff, 1 }, { 0x110000, 1 },
+#else
+  /* without multibyte support, the ASCII control characters take no
+     columns, and the characters past ASCII are not printable */
+  { 1, 0 }, { 0x7f, 0 }, { 0x9f, -1 },
+#endif
+};
+
+#define LEN 200
+
+static wchar_t str[LEN + 1];
+
+int main()
+{
+  size_t i, j, n;
+  int expect;
+
+  for (i = 0; i < sizeof widths / sizeof widths[0]; i++)
+    CHECK (wcwidth (widths[i].c) == widths[i].width);
+
+  /* One character of each width in a run of ASCII, at each position */
+  for (i = 0; i < sizeof widths / sizeof widths[0]; i++)
+    for (j = 0; j < 12 && widths[i].c <= (wint_t) WCHAR_MAX; j++)
+      {
+	wmemset (str, L'x', LEN);
+	str[LEN] = 0;
+	str[j] = widths[i].c;
+	for (n = 0; n < 16; n++)
+	  {
+	    if (n <= j)
+	      expect = n;
+	    else if (widths[i].c == 0)
+	      expect = j;
+	    else if (widths[i].width < 0)
+	      expect = -1;
+	    else
+	      expect = n - 1 + widths[i].width;
+	    CHECK (wcswidth (str, n) == expect);
+	  }
+	CHECK (wcswidth (str, LEN + 10) == (widths[i].c == 0 ? (int) j
+					    : widths[i].width < 0 ? -1
+					    : LEN - 1 + widths[i].width));
+      }
+  CHECK (wcswidth (L"", 5) == 0);
+  CHECK (wcswidth (NULL, 5) == 0);
+
+#ifdef BENCHMARK
+  {
+    static wchar_t text[4096];
+    clock_t t;
+    long r;
+
+    for (i = 0; i < 4095; i++)
+      text[i] = i % 61 == 60 ? 0x4e2d : L'a' + i % 26;
+    t = clock ();
+    for (r = 0; r < 100000; r++)
+      CHECK (wcswidth (text, 4096) > 0);
+    printf ("wcswidth, mostly ASCII: %5.2f ns per character\n",
+	    (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / 4096 / r);
+    for (i = 0; i < 4095; i++)
+      text[i] = 0x4e00 + i % 500;
+    t = clock ();
+    for (r = 0; r < 10000; r++)
+      CHECK (wcswidth (text, 4096) > 0);
+    printf ("wcswidth, CJK:          %5.2f ns per character\n",
+	    (double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / 4096 / r);
+  }
+#endif
+
+  exit (0);
+}
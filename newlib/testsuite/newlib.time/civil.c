@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Compare mktime and gmtime_r in UTC with a reference that steps through
+   the years and months one at a time, as mktime used to, on random dates
+   in ten thousand years either side of the epoch and on fields far out
+   of their ranges.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "check.h"
+
+#define ISLEAP(y) ((y) % 4 == 0 && ((y) % 100 != 0 || (y) % 400 == 0))
+
+static const int month_days[12] =
+  { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+static int
+days_in_month (long year, int mon)
+{
+  return month_days[mon] + (mon == 1 && ISLEAP (year));
+}
+
+/* Normalize TM like mktime, a field at a time, and return the days
+   since the epoch.  */
+static long
+reference (struct tm *tm)
+{
+  long sec = tm->tm_sec, min = tm->tm_min, hour = tm->tm_hour;
+  long mday = tm->tm_mday, mon = tm->tm_mon, year = tm->tm_year + 1900L;
+  long days, y;
+  int m;
+
+  min += sec / 60 - (sec % 60 < 0);
+  sec = (sec % 60 + 60) % 60;
+  hour += min / 60 - (min % 60 < 0);
+  min = (min % 60 + 60) % 60;
+  mday += hour / 24 - (hour % 24 < 0);
+  hour = (hour % 24 + 24) % 24;
+  year += mon / 12 - (mon % 12 < 0);
+  mon = (mon % 12 + 12) % 12;
+
+  while (mday < 1)
+    {
+      if (--mon < 0)
+	{
+	  mon = 11;
+	  year--;
+	}
+      mday += days_in_month (year, mon);
+    }
+  while (mday > days_in_month (year, mon))
+    {
+      mday -= days_in_month (year, mon);
+      if (++mon > 11)
+	{
+	  mon = 0;
+	  year++;
+	}
+    }
+
+  tm->tm_sec = sec;
+  tm->tm_min = min;
+  tm->tm_hour = hour;
+  tm->tm_mday = mday;
+  tm->tm_mon = mon;
+  tm->tm_year = year - 1900;
+  tm->tm_yday = mday - 1;
+  for (m = 0; m < mon; m++)
+    tm->tm_yday += days_in_month (year, m);
+
+  days = tm->tm_yday;
+  for (y = 1970; y < year; y++)
+    days += 365 + ISLEAP (y);
+  for (y = year; y < 1970; y++)
+    days -= 365 + ISLEAP (y);
+  tm->tm_wday = ((days + 4) % 7 + 7) % 7;
+  return days;
+}
+
+static unsigned long state = 1;
+
+static long
+rnd (long lo, long hi)
+{
+  state = state * 1103515245 + 12345;
+  return lo + (long) ((state >> 8) % (unsigned long) (hi - lo + 1));
+}
+
+static int
+same (const struct tm *a, const struct tm *b)
+{
+  return a->tm_year == b->tm_year && a->tm_mon == b->tm_mon
+	 && a->tm_mday == b->tm_mday && a->tm_hour == b->tm_hour
+	 && a->tm_min == b->tm_min && a->tm_sec == b->tm_sec
+	 && a->tm_wday == b->tm_wday && a->tm_yday == b->tm_yday;
+}
+
+int main()
+{
+  struct tm tm, ref, gm;
+  time_t t, max;
+  long days, n;
+  int far;
+
+  CHECK (setenv ("TZ", "UTC0", 1) == 0);
+  tzset ();
+
+  /* the largest time_t, which is signed */
+  max = (time_t) ((((time_t) 1 << (sizeof (time_t) * 8 - 2)) - 1) * 2 + 1);
+
+  for (n = 0; n < 40000; n++)
+    {
+      memset (&tm, 0, sizeof tm);
+      far = n % 4;
+      tm.tm_year = far == 0 ? rnd (-11900, 8100) : rnd (-100, 200);
+      tm.tm_mon = far == 1 ? rnd (-1000, 1000) : rnd (0, 11);
+      tm.tm_mday = far == 1 ? rnd (-100000, 100000) : rnd (1, 31);
+      tm.tm_hour = far == 2 ? rnd (-100000, 100000) : rnd (0, 23);
+      tm.tm_min = far == 2 ? rnd (-100000, 100000) : rnd (0, 59);
+      tm.tm_sec = far == 3 ? rnd (-10000000, 10000000) : rnd (0, 59);
+      tm.tm_isdst = 0;
+      ref = tm;
+      days = reference (&ref);
+
+      t = mktime (&tm);
+      if (days > max / 86400 - 1 || days < -(max / 86400) + 1)
+	{
+	  /* at or beyond the ends of a 32-bit time_t */
+	  if (days > max / 86400 + 1 || days < -(max / 86400) - 2)
+	    CHECK (t == (time_t) -1);
+	  continue;
+	}
+      CHECK (t == (time_t) days * 86400 + ref.tm_hour * 3600L
+		  + ref.tm_min * 60 + ref.tm_sec);
+      CHECK (same (&tm, &ref) && tm.tm_isdst == 0);
+      CHECK (gmtime_r (&t, &gm) == &gm && same (&gm, &ref));
+    }
+
+  /* The ends of the range of time_t, or of tm_year for a 64-bit one,
+     where mktime and gmtime_r fail rather than let tm_year wrap */
+  if (sizeof (time_t) == 4)
+    {
+      CHECK (gmtime_r (&max, &gm) == &gm);
+      CHECK (mktime (&gm) == max);
+      gm.tm_sec++;
+      CHECK (mktime (&gm) == (time_t) -1);
+      t = -max - 1;
+      CHECK (gmtime_r (&t, &gm) == &gm);
+      CHECK (mktime (&gm) == t);
+      gm.tm_sec--;
+      CHECK (mktime (&gm) == (time_t) -1);
+    }
+  else
+    {
+      /* any int tm_year, even one past INT_MAX - 1900 */
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = INT_MAX - 1900;
+      tm.tm_mday = 32;
+      CHECK ((t = mktime (&tm)) != (time_t) -1);
+      CHECK (tm.tm_year == INT_MAX - 1900 && tm.tm_mon == 1
+	     && tm.tm_mday == 1);
+      CHECK (gmtime_r (&t, &gm) == &gm && same (&gm, &tm));
+
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = INT_MAX;
+      tm.tm_mon = 11;
+      tm.tm_mday = 31;
+      tm.tm_hour = 23;
+      tm.tm_min = 59;
+      tm.tm_sec = 59;
+      CHECK ((t = mktime (&tm)) != (time_t) -1);
+      CHECK (tm.tm_year == INT_MAX && tm.tm_yday == 364);
+      CHECK (gmtime_r (&t, &gm) == &gm && same (&gm, &tm));
+
+      /* a year past INT_MAX fails, leaving the fields as they were */
+      tm.tm_sec = 60;
+      ref = tm;
+      CHECK (mktime (&tm) == (time_t) -1);
+      CHECK (memcmp (&tm, &ref, sizeof tm) == 0);
+      t++;
+      CHECK (gmtime_r (&t, &gm) == NULL);
+
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = INT_MAX - 5;
+      tm.tm_mon = 11;
+      tm.tm_mday = 3000;
+      ref = tm;
+      CHECK (mktime (&tm) == (time_t) -1);
+      CHECK (memcmp (&tm, &ref, sizeof tm) == 0);
+
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = INT_MAX;
+      tm.tm_mon = 12;
+      tm.tm_mday = 1;
+      ref = tm;
+      CHECK (mktime (&tm) == (time_t) -1);
+      CHECK (memcmp (&tm, &ref, sizeof tm) == 0);
+
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = INT_MIN;
+      tm.tm_mday = 1;
+      CHECK ((t = mktime (&tm)) != (time_t) -1);
+      CHECK (gmtime_r (&t, &gm) == &gm && same (&gm, &tm));
+      tm.tm_sec = -1;
+      ref = tm;
+      CHECK (mktime (&tm) == (time_t) -1);
+      CHECK (memcmp (&tm, &ref, sizeof tm) == 0);
+      t--;
+      CHECK (gmtime_r (&t, &gm) == NULL);
+
+      /* carries out of fields at the ends of int */
+      memset (&tm, 0, sizeof tm);
+      tm.tm_year = 70;
+      tm.tm_mday = 1;
+      tm.tm_sec = INT_MAX;
+      tm.tm_min = INT_MAX;
+      tm.tm_hour = INT_MAX;
+      ref = tm;
+      days = reference (&ref);
+      CHECK (mktime (&tm) == (time_t) days * 86400 + ref.tm_hour * 3600L
+			     + ref.tm_min * 60 + ref.tm_sec);
+      CHECK (same (&tm, &ref));
+    }
+
+#ifdef BENCHMARK
+  {
+    static const int years[3] = { 70, 3000, -5000 };
+    clock_t c;
+    long r;
+    int i;
+
+    for (i = 0; i < (sizeof (time_t) > 4 ? 3 : 1); i++)
+      {
+	c = clock ();
+	for (r = 0; r < 1000000; r++)
+	  {
+	    memset (&tm, 0, sizeof tm);
+	    tm.tm_year = years[i] + r % 50;
+	    tm.tm_mday = 1 + r % 28;
+	    tm.tm_sec = r % 86400;
+	    t = mktime (&tm);
+	  }
+	printf ("mktime, tm_year %5d:   %6.1f ns per call\n", years[i],
+		(double) (clock () - c) / CLOCKS_PER_SEC * 1e9 / r);
+	c = clock ();
+	for (r = 0; r < 1000000; r++)
+	  {
+	    t = (time_t) (years[i] - 70) * 31556952 + r * 997;
+	    gmtime_r (&t, &gm);
+	  }
+	printf ("gmtime_r, tm_year %5d: %6.1f ns per call\n", years[i],
+		(double) (clock () - c) / CLOCKS_PER_SEC * 1e9 / r);
+      }
+  }
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Write a TZif version 2 zone file with the European rules, whose
+   transitions start daylight saving time a week early in 2003, and
+   whose TZ string covers the years after 2009.  Check localtime_r and
+   mktime through the transitions, the rule, and the times a transition
+   skips or repeats, that tzname and timezone come from the file, and
+   that strftime gives the offset and name of each time.  Then check a
+   file whose TZ string is not valid, which keeps its last transitions.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+
+#define FILENAME "tzfile.tzif"
+#define RULE "TST-1TDT,M3.5.0,M10.5.0/3"
+#define BADNAME "tzbad.tzif"
+#define BADRULE "TST-1TDT,M3.5.0,M13.5.0/3"
+
+#define FIRST 2000
+#define LAST 2009
+#define EARLY 2003
+
+/* Offsets east of UTC of the three types: LMT, TST and TDT */
+static const long offsets[3] = { 3208, 3600, 7200 };
+
+static time_t at[2 * (LAST - FIRST + 1) + 1];
+static unsigned char types[2 * (LAST - FIRST + 1) + 1];
+static int count;
+
+/* Whether TZ names the zone file */
+static int from_file;
+
+static long
+days_from_civil (int y, int m, int d)
+{
+  long era;
+  int yoe, doy;
+
+  y -= m <= 2;
+  era = (y >= 0 ? y : y - 399) / 400;
+  yoe = y - era * 400;
+  doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+/* 01:00 UTC on the last Sunday of month M of year Y */
+static time_t
+last_sunday (int y, int m)
+{
+  long days = days_from_civil (y, m + 1, 1) - 1;
+
+  days -= (days + 4) % 7;	/* 1970-01-01 was a Thursday */
+  return (time_t) days * 86400 + 3600;
+}
+
+/* The offset east of UTC at T */
+static long
+offset_at (time_t t)
+{
+  int y;
+  time_t start;
+
+  if (t < at[0])
+    return offsets[0];
+  y = 1970 + (int) (t / 86400 / 365.2425);
+  if (y < FIRST)
+    return offsets[1];
+  start = last_sunday (y, 3);
+  if (y == EARLY)
+    start -= 7 * 86400;
+  return t >= start && t < last_sunday (y, 10) ? offsets[2] : offsets[1];
+}
+
+static unsigned char *
+put32 (unsigned char *p, long v)
+{
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+  return p + 4;
+}
+
+/* Header and data of a block with times of SIZE bytes */
+static unsigned char *
+put_block (unsigned char *p, int size)
+{
+  static const char names[] = "LMT\0TST\0TDT";
+  int i;
+
+  memcpy (p, "TZif2", 5);
+  memset (p + 5, 0, 15);
+  p = put32 (p + 20, 0);
+  p = put32 (p, 0);
+  p = put32 (p, 0);
+  p = put32 (p, count);
+  p = put32 (p, 3);
+  p = put32 (p, sizeof names);
+  for (i = 0; i < count; i++)
+    {
+      if (size == 8)
+	p = put32 (p, at[i] < 0 ? -1 : 0);
+      p = put32 (p, (long) at[i]);
+    }
+  memcpy (p, types, count);
+  p += count;
+  for (i = 0; i < 3; i++)
+    {
+      p = put32 (p, offsets[i]);
+      *p++ = i == 2;
+      *p++ = 4 * i;
+    }
+  memcpy (p, names, sizeof names);
+  return p + sizeof names;
+}
+
+/* Write the zone to file NAME, with TZ string TZSTR */
+static void
+write_zone (const char *name, const char *tzstr)
+{
+  static unsigned char buf[1024];
+  unsigned char *p;
+  FILE *fp;
+  int y;
+
+  at[0] = -1830383032;	/* 1912 */
+  types[0] = 1;
+  count = 1;
+  for (y = FIRST; y <= LAST; y++)
+    {
+      at[count] = last_sunday (y, 3) - (y == EARLY ? 7 * 86400 : 0);
+      types[count++] = 2;
+      at[count] = last_sunday (y, 10);
+      types[count++] = 1;
+    }
+
+  p = put_block (buf, 4);
+  p = put_block (p, 8);
+  p += sprintf ((char *) p, "\n%s\n", tzstr);
+
+  fp = fopen (name, "wb");
+  CHECK (fp != NULL);
+  CHECK (fwrite (buf, 1, p - buf, fp) == (size_t) (p - buf));
+  CHECK (fclose (fp) == 0);
+}
+
+/* strftime of localtime_r of T gives OFFSET and the name of its type */
+static void
+check_format (time_t t, long offset)
+{
+  static const char *const names[3] = { "LMT", "TST", "TDT" };
+  char buf[16], expect[16];
+  struct tm tm;
+  int i;
+
+  for (i = 0; i < 2 && offsets[i] != offset; i++)
+    ;
+  sprintf (expect, "%+03ld%02ld %s", offset / 3600, labs (offset / 60) % 60,
+	   names[i]);
+  CHECK (localtime_r (&t, &tm) == &tm);
+  CHECK (strftime (buf, sizeof buf, "%z %Z", &tm) > 0);
+  CHECK (strcmp (buf, expect) == 0);
+}
+
+/* localtime_r of T, and mktime of the result back to T */
+static void
+check_time (time_t t)
+{
+  struct tm tm, gm, tm2;
+  time_t l;
+
+  CHECK (localtime_r (&t, &tm) == &tm);
+  l = t + offset_at (t);
+  gmtime_r (&l, &gm);
+  CHECK (tm.tm_year == gm.tm_year && tm.tm_mon == gm.tm_mon
+	 && tm.tm_mday == gm.tm_mday && tm.tm_hour == gm.tm_hour
+	 && tm.tm_min == gm.tm_min && tm.tm_sec == gm.tm_sec
+	 && tm.tm_wday == gm.tm_wday && tm.tm_yday == gm.tm_yday);
+  CHECK (tm.tm_isdst == (offset_at (t) == offsets[2]));
+
+  tm2 = tm;
+  CHECK (mktime (&tm2) == t);
+  CHECK (memcmp (&tm, &tm2, sizeof tm) == 0);
+
+  check_format (t, offset_at (t));
+}
+
+/* mktime of local time H:30 on the last Sunday of month M of year Y,
+   with ISDST, is EXPECT.  Where the transitions of the file apply, it
+   also moves the time to hour HOUR; for a POSIX TZ string a skipped time
+   is left as it was given.  */
+static void
+check_mktime (int y, int m, int h, int isdst, time_t expect, int hour)
+{
+  int skipped = h != hour && !(from_file && y <= LAST);
+
+  struct tm tm;
+
+  memset (&tm, 0, sizeof tm);
+  tm.tm_year = y - 1900;
+  tm.tm_mon = m - 1;
+  tm.tm_hour = h;
+  tm.tm_min = 30;
+  tm.tm_isdst = isdst;
+  /* find the Sunday */
+  tm.tm_mday = (int) ((last_sunday (y, m) - 3600) / 86400
+		      - days_from_civil (y, m, 1)) + 1;
+  CHECK (mktime (&tm) == expect);
+  if (skipped)
+    return;
+  CHECK (tm.tm_hour == hour && tm.tm_min == 30);
+  CHECK (tm.tm_isdst == (offset_at (expect) == offsets[2]));
+}
+
+static void
+check_zone (int file)
+{
+  time_t t;
+  int y;
+
+  from_file = file;
+  CHECK (strcmp (_tzname[0], "TST") == 0 && strcmp (_tzname[1], "TDT") == 0);
+  CHECK (_timezone == -3600 && _daylight);
+
+  /* Before the first transition, if the file gives it */
+  if (file)
+    {
+      check_time (at[0] - 1);
+      check_time (at[0]);
+      check_time (-2000000000);
+    }
+
+  for (y = file ? FIRST - 1 : LAST + 1; y <= LAST + 3; y++)
+    {
+      for (t = last_sunday (y, 3) - 3600; t < last_sunday (y, 3) + 3600;
+	   t += 599)
+	check_time (t);
+      for (t = last_sunday (y, 10) - 3600; t < last_sunday (y, 10) + 3600;
+	   t += 599)
+	check_time (t);
+      for (t = last_sunday (y, 1); t < last_sunday (y, 12); t += 86400 / 7)
+	check_time (t);
+      if (y == EARLY && file)
+	check_time (last_sunday (y, 3) - 3 * 86400);
+      if (y < FIRST)
+	continue;
+
+      /* 02:30 is skipped in March, and moved to 03:30 TDT unless
+	 tm_isdst asks for TDT; it comes twice in October.  */
+      if (y != EARLY || !file)
+	{
+	  check_mktime (y, 3, 2, -1, last_sunday (y, 3) + 1800, 3);
+	  check_mktime (y, 3, 2, 0, last_sunday (y, 3) + 1800, 3);
+	  check_mktime (y, 3, 2, 1, last_sunday (y, 3) - 1800, 1);
+	}
+      check_mktime (y, 10, 2, 1, last_sunday (y, 10) - 1800, 2);
+      check_mktime (y, 10, 2, 0, last_sunday (y, 10) + 1800, 2);
+      check_mktime (y, 10, 1, -1, last_sunday (y, 10) - 3600 - 1800, 1);
+      check_mktime (y, 10, 3, -1, last_sunday (y, 10) + 3600 + 1800, 3);
+    }
+}
+
+int main()
+{
+  int y;
+
+  write_zone (FILENAME, RULE);
+  write_zone (BADNAME, BADRULE);
+
+  CHECK (setenv ("TZDIR", ".", 1) == 0);
+  CHECK (setenv ("TZ", ":" FILENAME, 1) == 0);
+  tzset ();
+  check_zone (1);
+
+  /* The same rule as a POSIX TZ string, for the years it covers */
+  CHECK (setenv ("TZ", RULE, 1) == 0);
+  tzset ();
+  check_zone (0);
+
+  /* And back to the file, which is kept from before */
+  CHECK (setenv ("TZ", ":" FILENAME, 1) == 0);
+  tzset ();
+  check_zone (1);
+
+  /* The types of the last transitions stand for the rule that is not
+     valid, and not the offsets of the zone before */
+  CHECK (setenv ("TZ", "XST5", 1) == 0);
+  tzset ();
+  CHECK (setenv ("TZ", ":" BADNAME, 1) == 0);
+  tzset ();
+  CHECK (strcmp (_tzname[0], "TST") == 0 && strcmp (_tzname[1], "TDT") == 0);
+  CHECK (_timezone == -3600 && _daylight);
+  check_format (at[0] - 1, offsets[0]);
+  for (y = FIRST; y <= LAST; y++)
+    {
+      check_format (last_sunday (y, 1), offsets[1]);
+      check_format (last_sunday (y, 7), offsets[2]);
+    }
+  check_format (last_sunday (LAST + 1, 7), offsets[1]);
+  check_format (last_sunday (LAST + 50, 1), offsets[1]);
+
+#ifdef BENCHMARK
+  {
+    static const char *const tzs[2] = { ":" FILENAME, RULE };
+    struct tm tm;
+    clock_t c;
+    time_t t;
+    long n, k;
+    int i;
+
+    for (i = 0; i < 2; i++)
+      {
+	CHECK (setenv ("TZ", tzs[i], 1) == 0);
+	tzset ();
+	c = clock ();
+	/* 1970 to 2100 */
+	for (n = 0, k = 0; k < 1135000; k++)
+	  {
+	    t = (time_t) k * 3607;
+	    localtime_r (&t, &tm);
+	    n++;
+	  }
+	printf ("localtime_r, TZ=%-26s %6.1f ns per call\n", tzs[i],
+		(double) (clock () - c) / CLOCKS_PER_SEC * 1e9 / n);
+      }
+  }
+#endif
+
+  remove (FILENAME);
+  remove (BADNAME);
+  exit (0);
+}
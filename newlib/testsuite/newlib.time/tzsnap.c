@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check that localtime_r and mktime see TZ changed by setenv, putenv,
+   unsetenv and a new environ without a call of tzset, and a TZ changed
+   in place in environ after one.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "check.h"
+
+#if defined (BENCHMARK) && defined (_POSIX_THREADS)
+#include <pthread.h>
+#endif
+
+extern char **environ;
+
+/* localtime_r of 2000-01-01 00:00:00 UTC is at HOUR:MIN, and mktime of
+   it is the time again */
+static void
+check_zone (int hour, int min)
+{
+  time_t t = 946684800;
+  struct tm tm;
+
+  CHECK (localtime_r (&t, &tm) == &tm);
+  CHECK (tm.tm_hour == hour && tm.tm_min == min);
+  CHECK (tm.tm_mday == (hour < 12 ? 1 : 31));
+  CHECK (mktime (&tm) == t);
+}
+
+#if defined (BENCHMARK) && defined (_POSIX_THREADS)
+#define CALLS 2000000
+
+static void *
+convert (void *arg)
+{
+  struct tm tm;
+  time_t t;
+  long n;
+
+  for (n = 0; n < CALLS; n++)
+    {
+      t = 946684800 + n * 3607;
+      localtime_r (&t, &tm);
+    }
+  return arg;
+}
+
+static double
+seconds (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+#endif
+
+int main()
+{
+  static char tz_ist[] = "TZ=IST-5:30";
+  char *env[2] = { tz_ist, NULL };
+  char **old_environ;
+
+  CHECK (setenv ("TZ", "EST5", 1) == 0);
+  tzset ();
+  check_zone (19, 0);
+
+  CHECK (setenv ("TZ", "JST-9", 1) == 0);
+  check_zone (9, 0);
+  CHECK (strcmp (_tzname[0], "JST") == 0 && _timezone == -9 * 3600);
+
+  CHECK (unsetenv ("TZ") == 0);
+  check_zone (0, 0);
+
+  CHECK (putenv ("TZ=CET-1CEST,M3.5.0,M10.5.0/3") == 0);
+  check_zone (1, 0);
+
+  /* a value that fits over the old one is copied into it */
+  CHECK (setenv ("TZ", "MSK-3", 1) == 0);
+  check_zone (3, 0);
+
+  old_environ = environ;
+  environ = env;
+  check_zone (5, 30);
+
+  /* changed in place, so only tzset sees it */
+  strcpy (tz_ist, "TZ=NPT-5:45");
+  tzset ();
+  check_zone (5, 45);
+
+  environ = old_environ;
+  check_zone (3, 0);
+
+#if defined (BENCHMARK) && defined (_POSIX_THREADS)
+  {
+    pthread_t threads[8];
+    double s;
+    int n, i;
+
+    CHECK (setenv ("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1) == 0);
+    tzset ();
+    for (n = 1; n <= 8; n *= 2)
+      {
+	s = seconds ();
+	for (i = 0; i < n; i++)
+	  CHECK (pthread_create (&threads[i], NULL, convert, NULL) == 0);
+	for (i = 0; i < n; i++)
+	  CHECK (pthread_join (threads[i], NULL) == 0);
+	printf ("localtime_r, %d threads: %6.1f ns per call in each\n", n,
+		(seconds () - s) * 1e9 / CALLS);
+      }
+  }
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Classify and convert characters from the ASCII and Latin-1 ranges,
+   from other scripts, and from the edges of the Unicode tables.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <wctype.h>
+#include <newlib.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
+#include "check.h"
+
+struct conv {
+  wint_t upper, lower;
+};
+
+static const struct conv convs[] = {
+  { L'A', L'a' }, { L'Z', L'z' }, { 0xc0, 0xe0 }, { 0xde, 0xfe },
+  { 0x178, 0xff }, { 0x100, 0x101 }, { 0x139, 0x13a }, { 0x1c4, 0x1c6 },
+  { 0x391, 0x3b1 }, { 0x410, 0x430 }, { 0x10a0, 0x2d00 },
+  { 0x1e9e, 0xdf }, { 0x2c6f, 0x250 }, { 0xff21, 0xff41 },
+  { 0x10400, 0x10428 }, { 0x1e900, 0x1e922 },
+};
+
+static const wint_t uncased[] = {
+  0, L'0', L'@', L'[', L'`', L'{', 0x7f, 0xaa, 0xd7, 0xf7, 0x4e2d,
+  0x1f600, 0xe0100, 0x10ffff, 0x110000, WEOF,
+};
+
+int main()
+{
+  const struct conv *cv;
+  size_t i;
+
+#ifdef _MB_CAPABLE
+  for (cv = convs; cv < convs + sizeof convs / sizeof convs[0]; cv++)
+    {
+      CHECK (towlower (cv->upper) == cv->lower);
+      CHECK (towupper (cv->lower) == cv->upper || cv->lower == 0xdf
+	     || cv->upper == 0x178);
+      CHECK (towupper (cv->upper) == cv->upper || cv->upper == 0x1c4);
+      CHECK (towlower (cv->lower) == cv->lower);
+      CHECK (iswalpha (cv->upper) && iswalpha (cv->lower));
+    }
+  CHECK (towupper (0xff) == 0x178 && towupper (0x1c5) == 0x1c4);
+  CHECK (towlower (0x1c5) == 0x1c6 && towupper (0x1c6) == 0x1c4);
+  CHECK (towupper (0xb5) == 0x39c && towupper (0x131) == L'I');
+  CHECK (towlower (0x130) == L'i');
+  for (i = 0; i < sizeof uncased / sizeof uncased[0]; i++)
+    {
+      CHECK (towupper (uncased[i]) == uncased[i]);
+      CHECK (towlower (uncased[i]) == uncased[i]);
+    }
+
+  CHECK (iswupper (0xc0) && iswlower (0xe0) && !iswupper (0xd7));
+  CHECK (iswalpha (0xaa) && iswalpha (0x4e2d) && iswalpha (0x20000));
+  CHECK (iswalpha (0x16a0) && iswalnum (0x2160));
+  CHECK (!iswalpha (0xd7) && !iswalpha (0x1f600) && !iswalpha (0x110000));
+  CHECK (iswspace (0x2003) && iswspace (0x3000) && iswspace (0xa0));
+  CHECK (iswblank (0x1680) && !iswblank (0x2028));
+  CHECK (iswpunct (0xbf) && iswpunct (0x3001) && iswpunct (0x1f600));
+  CHECK (iswcntrl (0x85) && iswcntrl (0x2028) && !iswcntrl (0xa0));
+  CHECK (iswprint (0x20) && iswprint (0xe0100) && !iswprint (0x378));
+  CHECK (iswgraph (0x1f600) && !iswgraph (0xe0001));
+  CHECK (!iswprint (0x10ffff) && !iswprint (0xd800));
+#endif
+  CHECK (towupper (L'q') == L'Q' && towlower (L'Q') == L'q');
+  CHECK (iswalpha (L'q') && !iswalpha (L'1') && iswspace (L' '));
+
+#ifdef BENCHMARK
+  {
+    static const wint_t chars[] = { L'a', 0xe9, 0x3b1, 0x4e2d, 0x1f600 };
+    volatile wint_t sink;
+    clock_t t;
+    long n;
+
+    for (i = 0; i < sizeof chars / sizeof chars[0]; i++)
+      {
+	printf ("U+%05X", (unsigned) chars[i]);
+	t = clock ();
+	for (n = 0; n < 10000000; n++)
+	  sink = iswalpha (chars[i]);
+	printf (" iswalpha %5.1f", (double) (clock () - t) / CLOCKS_PER_SEC
+				   * 1e9 / n);
+	t = clock ();
+	for (n = 0; n < 10000000; n++)
+	  sink = iswspace (chars[i]);
+	printf (" iswspace %5.1f", (double) (clock () - t) / CLOCKS_PER_SEC
+				   * 1e9 / n);
+	t = clock ();
+	for (n = 0; n < 10000000; n++)
+	  sink = towupper (chars[i]);
+	printf (" towupper %5.1f ns per call\n",
+		(double) (clock () - t) / CLOCKS_PER_SEC * 1e9 / n);
+      }
+  }
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check that xdr_array and xdr_vector of the fixed-size primitives
+   encode the same bytes as their element procedures called one at a
+   time, and decode them back, in memory streams, aligned or not, in
+   record streams whose buffers end in the middle of elements, and with
+   xdr_sizeof.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+#include "check.h"
+
+#define N 1000
+#define BUFSIZE (N * 8 + 64)
+
+/* The same procedures, called where xdr_array does not know them */
+static bool_t
+each_int (XDR *x, int *p)
+{
+  return xdr_int (x, p);
+}
+
+static bool_t
+each_u_int32 (XDR *x, u_int32_t *p)
+{
+  return xdr_u_int32_t (x, p);
+}
+
+static bool_t
+each_float (XDR *x, float *p)
+{
+  return xdr_float (x, p);
+}
+
+static bool_t
+each_double (XDR *x, double *p)
+{
+  return xdr_double (x, p);
+}
+
+static bool_t
+each_int64 (XDR *x, int64_t *p)
+{
+  return xdr_int64_t (x, p);
+}
+
+static const struct
+{
+  const char *name;
+  u_int size;
+  xdrproc_t proc, each;
+} kinds[] =
+{
+  { "int", sizeof (int), (xdrproc_t) xdr_int, (xdrproc_t) each_int },
+  { "u_int32_t", sizeof (u_int32_t), (xdrproc_t) xdr_u_int32_t,
+    (xdrproc_t) each_u_int32 },
+  { "float", sizeof (float), (xdrproc_t) xdr_float, (xdrproc_t) each_float },
+  { "double", sizeof (double), (xdrproc_t) xdr_double,
+    (xdrproc_t) each_double },
+  { "int64_t", sizeof (int64_t), (xdrproc_t) xdr_int64_t,
+    (xdrproc_t) each_int64 },
+};
+
+#define NKINDS (sizeof (kinds) / sizeof (kinds[0]))
+
+static double data[N], back[N];
+static char expect[BUFSIZE], got[BUFSIZE + 1];
+
+/* The record stream writes to and reads from rec */
+static char rec[3 * BUFSIZE];
+static int rec_len, rec_pos;
+
+static int
+rec_write (void *handle, void *buf, int len)
+{
+  CHECK (rec_len + len <= (int) sizeof rec);
+  memcpy (rec + rec_len, buf, len);
+  rec_len += len;
+  return len;
+}
+
+static int
+rec_read (void *handle, void *buf, int len)
+{
+  if (len > rec_len - rec_pos)
+    len = rec_len - rec_pos;
+  if (len == 0)
+    return -1;
+  memcpy (buf, rec + rec_pos, len);
+  rec_pos += len;
+  return len;
+}
+
+static unsigned long state = 1;
+
+static void
+fill (void *p, size_t len)
+{
+  unsigned char *s = p;
+
+  while (len-- > 0)
+    {
+      state = state * 1103515245 + 12345;
+      *s++ = state >> 16;
+    }
+}
+
+/* Encode n elements of kind k with proc into buf, of len bytes, and
+   return the bytes used, or 0 if it failed */
+static u_int
+encode_mem (int k, xdrproc_t proc, char *buf, u_int len, u_int n, int vector)
+{
+  XDR x;
+  char *p = (char *) data;
+  u_int count = n, pos;
+  bool_t ok;
+
+  xdrmem_create (&x, buf, len, XDR_ENCODE);
+  if (vector)
+    ok = xdr_vector (&x, p, n, kinds[k].size, proc);
+  else
+    ok = xdr_array (&x, &p, &count, N, kinds[k].size, proc);
+  pos = xdr_getpos (&x);
+  xdr_destroy (&x);
+  return ok ? pos : 0;
+}
+
+/* What xdr_sizeof measures */
+static int sizeof_kind;
+static u_int sizeof_n;
+
+static bool_t
+encode_data (XDR *x, void *unused)
+{
+  char *p = (char *) data;
+  u_int count = sizeof_n;
+
+  return xdr_array (x, &p, &count, N, kinds[sizeof_kind].size,
+		    kinds[sizeof_kind].proc);
+}
+
+static void
+check_decode_mem (int k, char *buf, u_int len, u_int n)
+{
+  XDR x;
+  char *p = NULL;
+  u_int count;
+
+  xdrmem_create (&x, buf, len, XDR_DECODE);
+  CHECK (xdr_array (&x, &p, &count, N, kinds[k].size, kinds[k].proc));
+  CHECK (count == n
+	 && (n == 0 || memcmp (p, data, n * kinds[k].size) == 0));
+  CHECK (xdr_getpos (&x) == len);
+  xdr_destroy (&x);
+
+  xdrmem_create (&x, buf, len, XDR_FREE);
+  CHECK (xdr_array (&x, &p, &count, N, kinds[k].size, kinds[k].proc));
+  CHECK (p == NULL);
+  xdr_destroy (&x);
+}
+
+static void
+check_rec (int k, u_int bufsize, u_int n)
+{
+  XDR x;
+  char *p = (char *) data;
+  u_int count = n;
+
+  rec_len = rec_pos = 0;
+  xdrrec_create (&x, bufsize, bufsize, NULL, rec_read, rec_write);
+  x.x_op = XDR_ENCODE;
+  CHECK (xdr_array (&x, &p, &count, N, kinds[k].size, kinds[k].proc));
+  CHECK (xdr_vector (&x, p, n, kinds[k].size, kinds[k].proc));
+  CHECK (xdrrec_endofrecord (&x, TRUE));
+  xdr_destroy (&x);
+
+  memset (back, 0, sizeof back);
+  xdrrec_create (&x, bufsize, bufsize, NULL, rec_read, rec_write);
+  x.x_op = XDR_DECODE;
+  CHECK (xdrrec_skiprecord (&x));
+  p = (char *) back;
+  CHECK (xdr_array (&x, &p, &count, N, kinds[k].size, kinds[k].proc));
+  CHECK (count == n && memcmp (back, data, n * kinds[k].size) == 0);
+  memset (back, 0, sizeof back);
+  CHECK (xdr_vector (&x, p, n, kinds[k].size, kinds[k].proc));
+  CHECK (memcmp (back, data, n * kinds[k].size) == 0);
+  CHECK (xdrrec_eof (&x));
+  xdr_destroy (&x);
+}
+
+int main()
+{
+  u_int k, n, len, i;
+  static const u_int counts[] = { 0, 1, 2, 3, 31, 512, N };
+
+  for (k = 0; k < NKINDS; k++)
+    for (i = 0; i < sizeof counts / sizeof counts[0]; i++)
+      {
+	n = counts[i];
+	fill (data, sizeof data);
+
+	len = encode_mem (k, kinds[k].each, expect, sizeof expect, n, 0);
+	CHECK (len == 4 + n * kinds[k].size);
+	CHECK (encode_mem (k, kinds[k].proc, got, sizeof got, n, 0) == len);
+	CHECK (memcmp (got, expect, len) == 0);
+	CHECK (encode_mem (k, kinds[k].proc, got, sizeof got, n, 1)
+	       == len - 4);
+	CHECK (memcmp (got, expect + 4, len - 4) == 0);
+
+	/* a buffer one byte short, and one not aligned for x_inline */
+	if (n > 0)
+	  CHECK (encode_mem (k, kinds[k].proc, got, len - 1, n, 0) == 0);
+	CHECK (encode_mem (k, kinds[k].proc, got + 1, sizeof got - 1, n, 0)
+	       == len);
+	CHECK (memcmp (got + 1, expect, len) == 0);
+
+	sizeof_kind = k;
+	sizeof_n = n;
+	CHECK (xdr_sizeof ((xdrproc_t) encode_data, NULL) == len);
+	check_decode_mem (k, expect, len, n);
+	memcpy (got + 1, expect, len);
+	check_decode_mem (k, got + 1, len, n);
+
+	check_rec (k, 100, n);
+	check_rec (k, 4000, n);
+      }
+
+#ifdef BENCHMARK
+  {
+    static const int ks[2] = { 0, 3 };
+    XDR x;
+    char *buf, *p;
+    u_int count;
+    clock_t c;
+    double secs;
+    int r, j, op;
+
+    count = 1000000;
+    p = malloc (count * sizeof (double));
+    buf = malloc (count * sizeof (double) + 4);
+    CHECK (p != NULL && buf != NULL);
+    fill (p, count * sizeof (double));
+    for (j = 0; j < 2; j++)
+      for (op = 0; op < 2; op++)
+	{
+	  k = ks[j];
+	  c = clock ();
+	  for (r = 0; r < 20; r++)
+	    {
+	      xdrmem_create (&x, buf, count * kinds[k].size + 4,
+			     op ? XDR_DECODE : XDR_ENCODE);
+	      CHECK (xdr_array (&x, &p, &count, count, kinds[k].size,
+				kinds[k].proc));
+	      xdr_destroy (&x);
+	    }
+	  secs = (double) (clock () - c) / CLOCKS_PER_SEC;
+	  printf ("xdr_array %s %-7s %8.1f MB/s\n", op ? "decode" : "encode",
+		  kinds[k].name, r * count * kinds[k].size / secs / 1e6);
+	}
+  }
+#endif
+
+  exit (0);
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 by Red Hat, Incorporated. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check that records with opaque data of all sizes, sent with and
+   without a vectored writer, decode the same with and without direct
+   reads, when readit returns short counts.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+#include "check.h"
+
+#define BUFSIZE 4000
+#define MAXDATA (1024 * 1024 + 3)
+#define NRECS 6
+
+static const u_int sizes[NRECS] = { 0, 3, BUFSIZE - 1, BUFSIZE, 100001,
+				    MAXDATA };
+
+static char *data, *back;
+
+/* The stream, written to and read from memory */
+static char *stream;
+static size_t stream_len, stream_pos, stream_max;
+static int short_reads;
+static int writes;
+
+static unsigned long state = 1;
+
+static unsigned long
+rnd (void)
+{
+  state = state * 1103515245 + 12345;
+  return state >> 8;
+}
+
+static int
+put (const void *buf, size_t len)
+{
+  if (stream != NULL)
+    {
+      CHECK (stream_len + len <= stream_max);
+      memcpy (stream + stream_len, buf, len);
+    }
+  stream_len += len;
+  return (int) len;
+}
+
+static int
+writeit (void *handle, void *buf, int len)
+{
+  CHECK (len <= BUFSIZE);
+  writes++;
+  return put (buf, len);
+}
+
+static int
+writevit (void *handle, const struct xdr_iovec *iov, int n)
+{
+  int i, len = 0;
+
+  writes++;
+  for (i = 0; i < n; i++)
+    len += put (iov[i].iov_base, iov[i].iov_len);
+  return len;
+}
+
+static int
+readit (void *handle, void *buf, int len)
+{
+  if (short_reads && len > 1)
+    len = 1 + rnd () % len;
+  if ((size_t) len > stream_len - stream_pos)
+    len = stream_len - stream_pos;
+  if (len == 0)
+    return -1;
+  memcpy (buf, stream + stream_pos, len);
+  stream_pos += len;
+  return len;
+}
+
+/* Record i: an int, data[i..] as bytes, and another int */
+static void
+encode (int vectored)
+{
+  XDR x;
+  char *p;
+  u_int len;
+  int i, a, b;
+
+  stream_len = 0;
+  writes = 0;
+  xdrrec_create (&x, BUFSIZE, BUFSIZE, NULL, readit, writeit);
+  if (vectored)
+    CHECK (xdrrec_setwritev (&x, writevit));
+  x.x_op = XDR_ENCODE;
+  for (i = 0; i < NRECS; i++)
+    {
+      a = i;
+      b = -i;
+      p = data + i;
+      len = sizes[i];
+      CHECK (xdr_int (&x, &a));
+      CHECK (xdr_bytes (&x, &p, &len, MAXDATA));
+      CHECK (xdr_int (&x, &b));
+      /* batch the small records; the last one is large */
+      CHECK (xdrrec_endofrecord (&x, len >= BUFSIZE));
+    }
+  xdr_destroy (&x);
+}
+
+static void
+decode (int direct)
+{
+  XDR x;
+  char *p;
+  u_int len;
+  int i, a, b;
+
+  stream_pos = 0;
+  xdrrec_create (&x, BUFSIZE, BUFSIZE, NULL, readit, writeit);
+  CHECK (xdrrec_setdirectread (&x, direct));
+  x.x_op = XDR_DECODE;
+  for (i = 0; i < NRECS; i++)
+    {
+      CHECK (xdrrec_skiprecord (&x));
+      p = back;
+      CHECK (xdr_int (&x, &a) && a == i);
+      CHECK (xdr_bytes (&x, &p, &len, MAXDATA) && len == sizes[i]);
+      CHECK (memcmp (back, data + i, len) == 0);
+      CHECK (xdr_int (&x, &b) && b == -i);
+    }
+  CHECK (xdrrec_eof (&x));
+  xdr_destroy (&x);
+}
+
+int main()
+{
+  XDR x;
+  char buf[16];
+  size_t i;
+  int vectored, direct, plain_writes;
+
+  data = malloc (MAXDATA + NRECS);
+  back = malloc (MAXDATA);
+  stream_max = 2 * NRECS * (MAXDATA + 16);
+  stream = malloc (stream_max);
+  CHECK (data != NULL && back != NULL && stream != NULL);
+  for (i = 0; i < MAXDATA + NRECS; i++)
+    data[i] = rnd ();
+
+  xdrmem_create (&x, buf, sizeof buf, XDR_ENCODE);
+  CHECK (!xdrrec_setwritev (&x, writevit) && !xdrrec_setdirectread (&x, 1));
+
+  plain_writes = 0;
+  for (vectored = 0; vectored < 2; vectored++)
+    {
+      encode (vectored);
+      if (vectored)
+	CHECK (writes < plain_writes / 10);
+      plain_writes = writes;
+      for (direct = 0; direct < 2; direct++)
+	for (short_reads = 0; short_reads < 2; short_reads++)
+	  decode (direct);
+    }
+
+#ifdef BENCHMARK
+  {
+    clock_t c;
+    char *p;
+    u_int len;
+    int r;
+
+    free (stream);
+    for (vectored = 0; vectored < 2; vectored++)
+      {
+	stream = NULL;
+	stream_len = 0;
+	xdrrec_create (&x, 0, 0, NULL, readit, writeit);
+	if (vectored)
+	  xdrrec_setwritev (&x, writevit);
+	x.x_op = XDR_ENCODE;
+	c = clock ();
+	for (r = 0; r < 2000; r++)
+	  {
+	    p = data;
+	    len = 1024 * 1024;
+	    CHECK (xdr_bytes (&x, &p, &len, MAXDATA));
+	    CHECK (xdrrec_endofrecord (&x, TRUE));
+	  }
+	printf ("xdrrec encode, 1 MB records%s: %8.1f MB/s\n",
+		vectored ? ", vectored" : "",
+		r * (1024 * 1024 / 1e6)
+		/ ((double) (clock () - c) / CLOCKS_PER_SEC));
+	xdr_destroy (&x);
+      }
+
+    stream = malloc (stream_max);
+    CHECK (stream != NULL);
+    encode (1);
+    short_reads = 0;
+    for (direct = 0; direct < 2; direct++)
+      {
+	c = clock ();
+	for (r = 0; r < 100; r++)
+	  decode (direct);
+	printf ("xdrrec decode, %d records%s: %8.1f MB/s\n", NRECS,
+		direct ? ", direct" : "",
+		r * (double) stream_len / 1e6
+		/ ((double) (clock () - c) / CLOCKS_PER_SEC));
+      }
+  }
+#endif
+
+  exit (0);
+}
@@ -31,6 +31,9 @@ details. */
 /* FIXME: Once things stabilize, bump up to a few minutes.  */
 #define FORK_WAIT_TIMEOUT (300 * 1000)     /* 300 seconds */
 
+/* Bumped in the child so that arc4random rekeys every generator.  */
+extern "C" int __arc4random_forkgen;
+
 static int dofork (bool *with_forkables);
 class frok
 {
@@ -164,6 +167,7 @@ frok::child (volatile char * volatile here)
 
   HANDLE& hParent = ch.parent;
 
+  __arc4random_forkgen++;
   sync_with_parent ("after longjmp", true);
   debug_printf ("child is running.  pid %d, ppid %d, stack here %p",
 		myself->pid, myself->ppid, __builtin_frame_address (0));